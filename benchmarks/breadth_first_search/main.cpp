@@ -0,0 +1,175 @@
+// This benchmark runs breadth-first searches over RMAT graphs of 2^scale
+// vertices and 16 undirected edges per vertex, generated in memory with
+// the skewed degree distribution of the Graph500 generator:
+//   taskflow  : tf::FlowBuilder::bfs
+//   sequential: a queue-based search on the calling thread
+//
+// Each round searches from a random vertex with at least one edge, and
+// only the search is timed.
+//
+// Example: ./breadth_first_search -m taskflow -s 22 -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/bfs.hpp>
+#include <CLI11.hpp>
+#include <random>
+
+struct CSR {
+  std::vector<size_t> offsets;
+  std::vector<uint32_t> edges;
+};
+
+// generates the undirected RMAT graph of 2^scale vertices and
+// 16 * 2^scale edges, each edge falling into the quadrants of the adjacency
+// matrix with the probabilities (0.57, 0.19, 0.19, 0.05) at every level
+CSR make_rmat(size_t scale, std::mt19937_64& rng) {
+
+  size_t N = size_t{1} << scale;
+  size_t M = 16 * N;
+
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  std::vector<std::pair<uint32_t, uint32_t>> list;
+  list.reserve(M);
+
+  for(size_t i=0; i<M; i++) {
+    uint32_t u = 0, v = 0;
+    for(size_t b=0; b<scale; b++) {
+      double r = dist(rng);
+      u = (u << 1) | (r >= 0.76);
+      v = (v << 1) | ((r >= 0.57 && r < 0.76) || r >= 0.95);
+    }
+    if(u != v) {
+      list.emplace_back(u, v);
+    }
+  }
+
+  CSR g;
+  g.offsets.assign(N + 1, 0);
+  for(auto [u, v] : list) {
+    g.offsets[u+1]++;
+    g.offsets[v+1]++;
+  }
+  for(size_t i=0; i<N; i++) {
+    g.offsets[i+1] += g.offsets[i];
+  }
+  g.edges.resize(g.offsets[N]);
+  auto pos = g.offsets;
+  for(auto [u, v] : list) {
+    g.edges[pos[u]++] = v;
+    g.edges[pos[v]++] = u;
+  }
+  return g;
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor,
+  const CSR& g, size_t source, std::vector<int>& levels
+) {
+
+  tf::Taskflow taskflow;
+
+  taskflow.bfs(
+    g.offsets.begin(), g.offsets.end(), g.edges.begin(), source, levels.begin()
+  );
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "sequential") {
+    std::fill(levels.begin(), levels.end(), -1);
+    std::vector<uint32_t> queue {static_cast<uint32_t>(source)};
+    levels[source] = 0;
+    for(size_t i=0; i<queue.size(); i++) {
+      uint32_t u = queue[i];
+      for(size_t e=g.offsets[u]; e<g.offsets[u+1]; e++) {
+        uint32_t v = g.edges[e];
+        if(levels[v] == -1) {
+          levels[v] = levels[u] + 1;
+          queue.push_back(v);
+        }
+      }
+    }
+  }
+  else {
+    executor.run(taskflow).wait();
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void bfs(
+  const std::string& model,
+  const size_t S,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::mt19937_64 rng(2023);
+
+  std::cout << std::setw(12) << "scale"
+            << std::setw(12) << "edges"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t scale=12; scale<=S; scale+=2) {
+
+    CSR g = make_rmat(scale, rng);
+
+    size_t N = g.offsets.size() - 1;
+
+    std::vector<int> levels(N);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      size_t source;
+      do {
+        source = rng() % N;
+      } while(g.offsets[source] == g.offsets[source+1]);
+      runtime += measure_time(model, executor, g, source, levels).count();
+    }
+
+    std::cout << std::setw(12) << scale
+              << std::setw(12) << g.edges.size()
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"BFS"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t S {20};
+  app.add_option("-s,--scale", S, "largest graph of 2^scale vertices (default=20)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model, "model name taskflow|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "sequential") {
+          return "model name should be \"taskflow\" or \"sequential\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "scale=" << S << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  bfs(model, S, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+// This benchmark computes the N-th Fibonacci number by the naive recursion
+// of examples/fibonacci.cpp, forking the two recursive calls at every level:
+//   tf-subflow: two tasks of a tf::Subflow followed by tf::Subflow::join
+//   tf-invoke : tf::Runtime::parallel_invoke
+//   sequential: the plain recursion on the calling thread
+//
+// Example: ./fork_join -m tf-invoke -n 30 -t 4 -r 5
+#include <taskflow/taskflow.hpp>
+#include <CLI11.hpp>
+
+int fib_subflow(int n, tf::Subflow& sbf) {
+  if(n < 2) return n;
+  int res1, res2;
+  sbf.emplace([&res1, n] (tf::Subflow& sbf) { res1 = fib_subflow(n - 1, sbf); });
+  sbf.emplace([&res2, n] (tf::Subflow& sbf) { res2 = fib_subflow(n - 2, sbf); });
+  sbf.join();
+  return res1 + res2;
+}
+
+int fib_invoke(int n, tf::Runtime& rt) {
+  if(n < 2) return n;
+  int res1, res2;
+  rt.parallel_invoke(
+    [&res1, n] (tf::Runtime& rt) { res1 = fib_invoke(n - 1, rt); },
+    [&res2, n] (tf::Runtime& rt) { res2 = fib_invoke(n - 2, rt); }
+  );
+  return res1 + res2;
+}
+
+int fib_sequential(int n) {
+  return n < 2 ? n : fib_sequential(n - 1) + fib_sequential(n - 2);
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor, int n, int& res
+) {
+
+  tf::Taskflow taskflow;
+
+  if(model == "tf-subflow") {
+    taskflow.emplace([&res, n] (tf::Subflow& sbf) { res = fib_subflow(n, sbf); });
+  }
+  else if(model == "tf-invoke") {
+    taskflow.emplace([&res, n] (tf::Runtime& rt) { res = fib_invoke(n, rt); });
+  }
+  else {
+    taskflow.emplace([&res, n] () { res = fib_sequential(n); });
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  executor.run(taskflow).wait();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void fibonacci(
+  const std::string& model,
+  const int N,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::cout << std::setw(12) << "n"
+            << std::setw(12) << "fib(n)"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(int n=10; n<=N; n+=5) {
+
+    double runtime {0.0};
+    int res {0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(model, executor, n, res).count();
+    }
+
+    std::cout << std::setw(12) << n
+              << std::setw(12) << res
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"Fork-Join"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  int N {30};
+  app.add_option("-n,--num", N, "largest Fibonacci number to compute (default=30)");
+
+  std::string model = "tf-invoke";
+  app.add_option("-m,--model", model, "model name tf-subflow|tf-invoke|sequential (default=tf-invoke)")
+     ->check([] (const std::string& m) {
+        if(m != "tf-subflow" && m != "tf-invoke" && m != "sequential") {
+          return "model name should be \"tf-subflow\", \"tf-invoke\", or \"sequential\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "N=" << N << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  fibonacci(model, N, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+// This benchmark measures the time to construct and destroy a taskflow
+// under three models:
+//   pool   : tasks are animated from and recycled to the default node pool
+//   arena  : tasks are bump-allocated from a tf::MonotonicArena that is
+//            reset in one step when the taskflow is destroyed
+//   builder: tasks and dependencies are created in parallel by
+//            tf::GraphBuilder on an executor
+//
+// In the pool and arena models, each thread builds a taskflow of N tasks,
+// where every task precedes its next two tasks, and then destroys it,
+// which mimics transient per-request graphs built concurrently by a server.
+// The arena of each thread is reused across taskflows.
+// In the builder model, all threads cooperate on one such taskflow.
+//
+// Example: ./graph_construction -m builder -t 4 -r 5
+#include <taskflow/taskflow.hpp>
+#include <CLI11.hpp>
+
+void build(tf::Taskflow& taskflow, size_t N) {
+
+  std::vector<tf::Task> tasks(N);
+
+  for(size_t i=0; i<N; ++i) {
+    tasks[i] = taskflow.emplace([](){});
+  }
+
+  for(size_t i=0; i+2<N; ++i) {
+    tasks[i].precede(tasks[i+1], tasks[i+2]);
+  }
+}
+
+void build(tf::Taskflow& taskflow, tf::Executor& executor, size_t N) {
+
+  tf::GraphBuilder builder(taskflow, executor);
+
+  builder.reserve(N);
+
+  builder.build([&](size_t i){
+    builder.task(i).work([](){});
+    if(i+2 < N) {
+      builder.precede(i, i+1);
+      builder.precede(i, i+2);
+    }
+  });
+
+  builder.finalize();
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, unsigned num_threads, size_t N
+) {
+
+  if(model == "builder") {
+    tf::Executor executor(num_threads);
+    auto beg = std::chrono::high_resolution_clock::now();
+    {
+      tf::Taskflow taskflow;
+      build(taskflow, executor, N);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+  }
+
+  std::vector<tf::MonotonicArena> arenas(num_threads);
+
+  std::vector<std::thread> threads;
+
+  auto run = [&] (unsigned t) {
+    if(model == "pool") {
+      tf::Taskflow taskflow;
+      build(taskflow, N);
+    }
+    else if(model == "arena") {
+      tf::Taskflow taskflow(arenas[t]);
+      build(taskflow, N);
+    }
+    else assert(false);
+  };
+
+  // warm up the allocators so that each round measures the steady state
+  for(unsigned t=0; t<num_threads; ++t) {
+    run(t);
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  for(unsigned t=0; t<num_threads; ++t) {
+    threads.emplace_back(run, t);
+  }
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void graph_construction(
+  const std::string& model,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t N=10; N<=1000000; N*=10) {
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(model, num_threads, N).count();
+    }
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"GraphConstruction"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  std::string model = "arena";
+  app.add_option("-m,--model", model, "model name pool|arena|builder (default=arena)")
+     ->check([] (const std::string& m) {
+        if(m != "pool" && m != "arena" && m != "builder") {
+          return "model name should be \"pool\", \"arena\", or \"builder\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  graph_construction(model, num_threads, num_rounds);
+
+  return 0;
+}
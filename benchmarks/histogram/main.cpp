@@ -0,0 +1,129 @@
+// This benchmark counts N integers into bins of their keys, for numbers of
+// bins from a few (hot bins) to more than the elements (sparse bins):
+//   taskflow  : tf::FlowBuilder::histogram
+//   atomic    : tf::FlowBuilder::for_each with an atomic increment per element
+//   sequential: a loop on the calling thread
+//
+// With -d hot, nine in ten elements fall into the first bin.
+//
+// Example: ./histogram -m taskflow -d hot -n 100000000 -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <taskflow/algorithm/reduce.hpp>
+#include <CLI11.hpp>
+
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor,
+  const std::vector<size_t>& input, size_t K
+) {
+
+  auto key = [] (size_t v) { return v; };
+
+  std::vector<size_t> bins(K, 0);
+  std::vector<std::atomic<size_t>> atomic_bins(model == "atomic" ? K : 0);
+
+  tf::Taskflow taskflow;
+
+  if(model == "taskflow") {
+    taskflow.histogram(input.begin(), input.end(), bins, key);
+  }
+  else if(model == "atomic") {
+    taskflow.for_each(input.begin(), input.end(), [&] (size_t v) {
+      atomic_bins[key(v)].fetch_add(1, std::memory_order_relaxed);
+    });
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "sequential") {
+    for(auto v : input) {
+      bins[key(v)]++;
+    }
+  }
+  else {
+    executor.run(taskflow).wait();
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void histogram(
+  const std::string& model,
+  const std::string& distribution,
+  const size_t N,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::vector<size_t> input(N);
+
+  std::cout << std::setw(12) << "bins"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t K=16; K<=(size_t{1}<<24); K*=16) {
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      for(auto& i : input) {
+        i = (distribution == "hot" && ::rand() % 10) ? 0 : ::rand() % K;
+      }
+      runtime += measure_time(model, executor, input, K).count();
+    }
+
+    std::cout << std::setw(12) << K
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"Histogram"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t N {10000000};
+  app.add_option("-n,--num_elements", N, "number of elements (default=10000000)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model, "model name taskflow|atomic|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "atomic" && m != "sequential") {
+          return "model name should be \"taskflow\", \"atomic\", or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string distribution = "uniform";
+  app.add_option("-d,--distribution", distribution,
+    "key distribution uniform|hot (default=uniform)")
+     ->check([] (const std::string& d) {
+        if(d != "uniform" && d != "hot") {
+          return "distribution should be \"uniform\" or \"hot\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "distribution=" << distribution << ' '
+            << "num_elements=" << N << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  histogram(model, distribution, N, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include "matrix_multiplication.hpp"
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/matmul.hpp>
+#include <Eigen/Dense>
+
+// unlike the other models, which multiply arrays of rows with the naive
+// loop nest, the blocked models multiply contiguous row-major matrices,
+// and only the multiplication is timed
+
+using RowMajorMatrix = Eigen::Matrix<
+  double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor
+>;
+
+inline void init_dense(RowMajorMatrix& A, RowMajorMatrix& B) {
+  A.resize(N, N);
+  B.resize(N, N);
+  for(int i=0; i<N; ++i) {
+    for(int j=0; j<N; ++j) {
+      A(i, j) = i + j;
+      B(i, j) = i * j;
+    }
+  }
+}
+
+// matrix_multiplication_taskflow_gemm
+std::chrono::microseconds measure_time_taskflow_gemm(unsigned num_threads) {
+
+  RowMajorMatrix A, B, C(N, N);
+  init_dense(A, B);
+
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  taskflow.matmul(A.data(), B.data(), C.data(), N, N, N);
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  executor.run(taskflow).get();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+// matrix_multiplication_eigen
+std::chrono::microseconds measure_time_eigen(unsigned num_threads) {
+
+  RowMajorMatrix A, B, C(N, N);
+  init_dense(A, B);
+
+  Eigen::setNbThreads(num_threads);
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  C.noalias() = A * B;
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
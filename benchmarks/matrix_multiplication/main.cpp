@@ -32,6 +32,12 @@ void matrix_multiplication(
       else if(model == "omp") {
         runtime += measure_time_omp(num_threads).count();
       }
+      else if(model == "tf-gemm") {
+        runtime += measure_time_taskflow_gemm(num_threads).count();
+      }
+      else if(model == "eigen") {
+        runtime += measure_time_eigen(num_threads).count();
+      }
       else assert(false);
     }
 
@@ -54,10 +60,10 @@ int main(int argc, char* argv[]) {
   app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
 
   std::string model = "tf";
-  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+  app.add_option("-m,--model", model, "model name tbb|omp|tf|tf-gemm|eigen (default=tf)")
      ->check([] (const std::string& m) {
-        if(m != "tbb" && m != "tf" && m != "omp") {
-          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        if(m != "tbb" && m != "tf" && m != "omp" && m != "tf-gemm" && m != "eigen") {
+          return "model name should be \"tbb\", \"omp\", \"tf\", \"tf-gemm\", or \"eigen\"";
         }
         return "";
      });
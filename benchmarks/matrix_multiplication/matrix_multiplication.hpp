@@ -15,6 +15,8 @@ extern double **a, **b, **c;
 std::chrono::microseconds measure_time_taskflow(unsigned);
 std::chrono::microseconds measure_time_tbb(unsigned);
 std::chrono::microseconds measure_time_omp(unsigned);
+std::chrono::microseconds measure_time_taskflow_gemm(unsigned);
+std::chrono::microseconds measure_time_eigen(unsigned);
 
 inline void allocate_matrix() {
   a = static_cast<double**>(std::malloc(N * sizeof(double*)));
@@ -0,0 +1,144 @@
+// This benchmark measures the allocation rate of tf::Node objects
+// under three allocation models:
+//   new  : the default operator new/delete
+//   pool : tf::ObjectPool (hashed local heap under a mutex per operation)
+//   cache: tf::ObjectPool with a per-thread tf::ObjectCache in front
+//
+// Each thread repeatedly animates a small batch of nodes and recycles
+// them, which mimics the allocation pattern of async tasks and
+// parallel-for chunks spawned by a worker.
+//
+// Example: ./object_pool -m cache -t 64 -r 5
+#include <taskflow/taskflow.hpp>
+#include <CLI11.hpp>
+
+constexpr size_t batch_size = 32;
+
+using node_pool_t = tf::ObjectPool<tf::Node>;
+
+void run_new(size_t N) {
+  std::vector<tf::Node*> nodes(batch_size);
+  for(size_t i=0; i<N; i+=batch_size) {
+    for(auto& n : nodes) {
+      n = new tf::Node();
+    }
+    for(auto& n : nodes) {
+      delete n;
+    }
+  }
+}
+
+void run_pool(node_pool_t& pool, size_t N) {
+  std::vector<tf::Node*> nodes(batch_size);
+  for(size_t i=0; i<N; i+=batch_size) {
+    for(auto& n : nodes) {
+      n = pool.animate();
+    }
+    for(auto& n : nodes) {
+      pool.recycle(n);
+    }
+  }
+}
+
+void run_cache(node_pool_t& pool, size_t N) {
+  tf::ObjectCache<tf::Node> cache;
+  std::vector<tf::Node*> nodes(batch_size);
+  for(size_t i=0; i<N; i+=batch_size) {
+    for(auto& n : nodes) {
+      n = pool.animate(cache);
+    }
+    for(auto& n : nodes) {
+      pool.recycle(cache, n);
+    }
+  }
+  pool.flush(cache);
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, unsigned num_threads, size_t N
+) {
+
+  node_pool_t pool(num_threads);
+
+  std::vector<std::thread> threads;
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  for(unsigned t=0; t<num_threads; ++t) {
+    threads.emplace_back([&](){
+      if(model == "new") {
+        run_new(N);
+      }
+      else if(model == "pool") {
+        run_pool(pool, N);
+      }
+      else if(model == "cache") {
+        run_cache(pool, N);
+      }
+      else assert(false);
+    });
+  }
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void object_pool(
+  const std::string& model,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t N=batch_size; N<=10000000; N*=10) {
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(model, num_threads, N).count();
+    }
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"ObjectPool"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  std::string model = "cache";
+  app.add_option("-m,--model", model, "model name new|pool|cache (default=cache)")
+     ->check([] (const std::string& m) {
+        if(m != "new" && m != "pool" && m != "cache") {
+          return "model name should be \"new\", \"pool\", or \"cache\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  object_pool(model, num_threads, num_rounds);
+
+  return 0;
+}
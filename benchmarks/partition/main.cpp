@@ -0,0 +1,142 @@
+// This benchmark filters N integers by a predicate that keeps a given
+// percentage of them (the selectivity), from 0% to 100%:
+//   taskflow  : tf::FlowBuilder::copy_if, remove_if, partition,
+//               or stable_partition
+//   sequential: the std:: counterpart on the calling thread
+//
+// Example: ./partition -m taskflow -a copy_if -n 100000000 -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/partition.hpp>
+#include <CLI11.hpp>
+
+std::chrono::microseconds measure_time(
+  const std::string& model, const std::string& algorithm,
+  tf::Executor& executor, std::vector<int>& input, std::vector<int>& output,
+  int selectivity
+) {
+
+  // values are uniform in [0, 100)
+  auto pred = [selectivity] (int v) { return v < selectivity; };
+
+  std::vector<int>::iterator res;
+
+  tf::Taskflow taskflow;
+
+  if(algorithm == "copy_if") {
+    taskflow.copy_if(input.begin(), input.end(), output.begin(), res, pred);
+  }
+  else if(algorithm == "remove_if") {
+    taskflow.remove_if(input.begin(), input.end(), res, pred);
+  }
+  else if(algorithm == "partition") {
+    taskflow.partition(input.begin(), input.end(), res, pred);
+  }
+  else {
+    taskflow.stable_partition(input.begin(), input.end(), res, pred);
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "taskflow") {
+    executor.run(taskflow).wait();
+  }
+  else if(algorithm == "copy_if") {
+    res = std::copy_if(input.begin(), input.end(), output.begin(), pred);
+  }
+  else if(algorithm == "remove_if") {
+    res = std::remove_if(input.begin(), input.end(), pred);
+  }
+  else if(algorithm == "partition") {
+    res = std::partition(input.begin(), input.end(), pred);
+  }
+  else {
+    res = std::stable_partition(input.begin(), input.end(), pred);
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void partition(
+  const std::string& model,
+  const std::string& algorithm,
+  const size_t N,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::vector<int> input(N), output(N);
+
+  std::cout << std::setw(12) << "selectivity"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(int selectivity : {0, 1, 10, 25, 50, 75, 90, 99, 100}) {
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      for(auto& i : input) {
+        i = ::rand() % 100;
+      }
+      runtime += measure_time(
+        model, algorithm, executor, input, output, selectivity
+      ).count();
+    }
+
+    std::cout << std::setw(11) << selectivity << '%'
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"Partition"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t N {10000000};
+  app.add_option("-n,--num_elements", N, "number of elements (default=10000000)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model, "model name taskflow|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "sequential") {
+          return "model name should be \"taskflow\" or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "copy_if";
+  app.add_option("-a,--algorithm", algorithm,
+    "algorithm copy_if|remove_if|partition|stable_partition (default=copy_if)")
+     ->check([] (const std::string& a) {
+        if(a != "copy_if" && a != "remove_if" && a != "partition" &&
+           a != "stable_partition") {
+          return "algorithm should be \"copy_if\", \"remove_if\", \"partition\", "
+                 "or \"stable_partition\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
+            << "num_elements=" << N << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  partition(model, algorithm, N, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+// This benchmark measures a parallel for_each_index over N elements
+// under the partitioners of tf::FlowBuilder::for_each_index:
+//   guided  : tf::GuidedPartitioner (default)
+//   dynamic : tf::DynamicPartitioner
+//   static  : tf::StaticPartitioner
+//   adaptive: tf::AdaptivePartitioner
+//
+// The benchmark sweeps a grid of the number of elements N and the cost of
+// each element, measured in rounds of a dependent arithmetic chain
+// (about one nanosecond per round), and skips the points whose total work
+// exceeds about one second.
+// The chunk size passed to the partitioner is zero by default,
+// which selects the default chunk size of each partitioner.
+//
+// Example: ./partitioner -m adaptive -t 4 -r 5 -c 16
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <CLI11.hpp>
+
+inline double element(size_t i, size_t cost) {
+  double x = static_cast<double>(i);
+  for(size_t k=0; k<cost; ++k) {
+    x = x * 0.999999 + 1.0;
+  }
+  return x;
+}
+
+template <typename P>
+std::chrono::microseconds measure_time(
+  tf::Executor& executor, std::vector<double>& data, size_t cost, P part
+) {
+
+  tf::Taskflow taskflow;
+
+  taskflow.for_each_index(size_t{0}, data.size(), size_t{1}, [&, cost](size_t i){
+    data[i] = element(i, cost);
+  }, part);
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  executor.run(taskflow).wait();
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor,
+  std::vector<double>& data, size_t cost, size_t chunk_size
+) {
+  if(model == "guided") {
+    return measure_time(executor, data, cost, tf::GuidedPartitioner(chunk_size));
+  }
+  else if(model == "dynamic") {
+    return measure_time(executor, data, cost, tf::DynamicPartitioner(chunk_size));
+  }
+  else if(model == "static") {
+    return measure_time(executor, data, cost, tf::StaticPartitioner(chunk_size));
+  }
+  else if(model == "adaptive") {
+    return measure_time(executor, data, cost, tf::AdaptivePartitioner(chunk_size));
+  }
+  else assert(false);
+  return std::chrono::microseconds(0);
+}
+
+void partitioner(
+  const std::string& model,
+  const unsigned num_threads,
+  const unsigned num_rounds,
+  const size_t chunk_size
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "cost"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t cost=1; cost<=4096; cost*=16) {
+    for(size_t N=100; N<=10000000 && N*cost<=1000000000; N*=10) {
+
+      std::vector<double> data(N);
+
+      double runtime {0.0};
+
+      for(unsigned j=0; j<num_rounds; ++j) {
+        runtime += measure_time(model, executor, data, cost, chunk_size).count();
+      }
+
+      std::cout << std::setw(12) << N
+                << std::setw(12) << cost
+                << std::setw(12) << runtime / num_rounds / 1e3
+                << std::endl;
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"Partitioner"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t chunk_size {0};
+  app.add_option("-c,--chunk_size", chunk_size, "chunk size (default=0)");
+
+  std::string model = "guided";
+  app.add_option("-m,--model", model, "model name guided|dynamic|static|adaptive (default=guided)")
+     ->check([] (const std::string& m) {
+        if(m != "guided" && m != "dynamic" && m != "static" && m != "adaptive") {
+          return "model name should be \"guided\", \"dynamic\", \"static\", or \"adaptive\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << "chunk_size=" << chunk_size << ' '
+            << std::endl;
+
+  partitioner(model, num_threads, num_rounds, chunk_size);
+
+  return 0;
+}
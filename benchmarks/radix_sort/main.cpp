@@ -0,0 +1,173 @@
+// This benchmark sorts N random keys, or N key-value pairs with -b, with:
+//   radix     : tf::FlowBuilder::radix_sort (tf::FlowBuilder::sort_by_key)
+//   pdqsort   : tf::FlowBuilder::sort with an explicit comparator, which
+//               never selects the radix sort
+//               (tf::FlowBuilder::sort_by_key with an explicit comparator)
+//   sequential: std::sort (std::stable_sort of key-value pairs)
+//
+// Example: ./radix_sort -m radix -k float -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/sort.hpp>
+#include <CLI11.hpp>
+
+template <typename K>
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor, bool by_key,
+  std::vector<K>& keys, std::vector<uint32_t>& values
+) {
+
+  std::chrono::high_resolution_clock::time_point beg, end;
+
+  tf::Taskflow taskflow;
+
+  if(model == "radix") {
+    if(by_key) {
+      taskflow.sort_by_key(keys.begin(), keys.end(), values.begin());
+    }
+    else {
+      taskflow.radix_sort(keys.begin(), keys.end());
+    }
+  }
+  else if(model == "pdqsort") {
+    if(by_key) {
+      taskflow.sort_by_key(keys.begin(), keys.end(), values.begin(), std::less<K>());
+    }
+    else {
+      taskflow.sort(keys.begin(), keys.end(), std::less<K>());
+    }
+  }
+
+  beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "sequential") {
+    if(by_key) {
+      std::vector<std::pair<K, uint32_t>> kv(keys.size());
+      for(size_t i=0; i<keys.size(); i++) {
+        kv[i] = {keys[i], values[i]};
+      }
+      std::stable_sort(kv.begin(), kv.end(), [](const auto& a, const auto& b){
+        return a.first < b.first;
+      });
+      for(size_t i=0; i<keys.size(); i++) {
+        keys[i] = kv[i].first;
+        values[i] = kv[i].second;
+      }
+    }
+    else {
+      std::sort(keys.begin(), keys.end());
+    }
+  }
+  else {
+    executor.run(taskflow).wait();
+  }
+
+  end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+template <typename K>
+void radix_sort(
+  const std::string& model,
+  const unsigned num_threads,
+  const unsigned num_rounds,
+  const bool by_key
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::mt19937_64 rng(0);
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::setw(12) << "Mkeys/s"
+            << std::endl;
+
+  for(size_t N=10; N<=100000000; N*=10) {
+
+    std::vector<K> keys(N);
+    std::vector<uint32_t> values(N);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+
+      // keys spread over the full range of the type
+      for(size_t i=0; i<N; i++) {
+        uint64_t bits = rng();
+        if(std::is_floating_point<K>::value) {
+          keys[i] = static_cast<K>(static_cast<int64_t>(bits)) / static_cast<K>(1e9);
+        }
+        else {
+          std::memcpy(&keys[i], &bits, sizeof(K));
+        }
+        values[i] = static_cast<uint32_t>(i);
+      }
+
+      runtime += measure_time(model, executor, by_key, keys, values).count();
+    }
+
+    runtime /= num_rounds;
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / 1e3
+              << std::setw(12) << (runtime > 0 ? N / runtime : 0.0)
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"RadixSort"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  std::string model = "radix";
+  app.add_option("-m,--model", model, "model name radix|pdqsort|sequential (default=radix)")
+     ->check([] (const std::string& m) {
+        if(m != "radix" && m != "pdqsort" && m != "sequential") {
+          return "model name should be \"radix\", \"pdqsort\", or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string key_type = "int32";
+  app.add_option("-k,--key_type", key_type, "key type int32|int64|float|double (default=int32)")
+     ->check([] (const std::string& k) {
+        if(k != "int32" && k != "int64" && k != "float" && k != "double") {
+          return "key type should be \"int32\", \"int64\", \"float\", or \"double\"";
+        }
+        return "";
+     });
+
+  bool by_key {false};
+  app.add_flag("-b,--by_key", by_key, "sort 32-bit values by their keys");
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "key_type=" << key_type << ' '
+            << "by_key=" << by_key << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  if(key_type == "int32") {
+    radix_sort<int32_t>(model, num_threads, num_rounds, by_key);
+  }
+  else if(key_type == "int64") {
+    radix_sort<int64_t>(model, num_threads, num_rounds, by_key);
+  }
+  else if(key_type == "float") {
+    radix_sort<float>(model, num_threads, num_rounds, by_key);
+  }
+  else {
+    radix_sort<double>(model, num_threads, num_rounds, by_key);
+  }
+
+  return 0;
+}
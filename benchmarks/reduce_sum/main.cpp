@@ -3,12 +3,14 @@
 
 void reduce_sum(
   const std::string& model,
+  const std::string& algorithm,
   const unsigned num_threads,
   const unsigned num_rounds
   ) {
 
   std::cout << std::setw(12) << "size"
             << std::setw(12) << "runtime"
+            << std::setw(12) << "GB/s"
             << std::endl;
 
   for(size_t N=10; N<=1000000000; N = N*10) {
@@ -19,19 +21,24 @@ void reduce_sum(
 
     for(unsigned j=0; j<num_rounds; ++j) {
       if(model == "tf") {
-        runtime += measure_time_taskflow(num_threads).count();
+        runtime += measure_time_taskflow(num_threads, algorithm).count();
+      }
+      else if(model == "tf-generic") {
+        runtime += measure_time_taskflow_generic(num_threads, algorithm).count();
       }
       else if(model == "tbb") {
-        runtime += measure_time_tbb(num_threads).count();
+        runtime += measure_time_tbb(num_threads, algorithm).count();
       }
       else if(model == "omp") {
-        runtime += measure_time_omp(num_threads).count();
+        runtime += measure_time_omp(num_threads, algorithm).count();
       }
       else assert(false);
     }
 
+    // the bandwidth of reading the elements once
     std::cout << std::setw(12) << N
               << std::setw(12) << runtime / num_rounds / 1e3
+              << std::setw(12) << N * sizeof(double) * num_rounds / runtime / 1e3
               << std::endl;
   }
 }
@@ -47,10 +54,19 @@ int main(int argc, char* argv[]) {
   app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
 
   std::string model = "tf";
-  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+  app.add_option("-m,--model", model, "model name tbb|omp|tf|tf-generic (default=tf)")
      ->check([] (const std::string& m) {
-        if(m != "tbb" && m != "tf" && m != "omp") {
-          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        if(m != "tbb" && m != "tf" && m != "omp" && m != "tf-generic") {
+          return "model name should be \"tbb\", \"omp\", \"tf\", or \"tf-generic\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "sum";
+  app.add_option("-a,--algorithm", algorithm, "algorithm sum|norm (default=sum)")
+     ->check([] (const std::string& a) {
+        if(a != "sum" && a != "norm") {
+          return "algorithm should be \"sum\" or \"norm\"";
         }
         return "";
      });
@@ -58,11 +74,12 @@ int main(int argc, char* argv[]) {
   CLI11_PARSE(app, argc, argv);
 
   std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
             << "num_threads=" << num_threads << ' '
             << "num_rounds=" << num_rounds << ' '
             << std::endl;
 
-  reduce_sum(model, num_threads, num_rounds);
+  reduce_sum(model, algorithm, num_threads, num_rounds);
 
   return 0;
 }
@@ -2,21 +2,31 @@
 #include <omp.h>
 
 // reduce_sum_omp
-void reduce_sum_omp(unsigned nthreads) {
+void reduce_sum_omp(unsigned nthreads, const std::string& algorithm) {
 
   omp_set_num_threads(nthreads);
 
   double sum = 0.0;
 
-  #pragma omp parallel for reduction(+: sum)
-  for(size_t i=0; i<vec.size(); ++i) {
-    sum += vec[i];
+  if(algorithm == "sum") {
+    #pragma omp parallel for reduction(+: sum)
+    for(size_t i=0; i<vec.size(); ++i) {
+      sum += vec[i];
+    }
+  }
+  else {
+    #pragma omp parallel for reduction(+: sum)
+    for(size_t i=0; i<vec.size(); ++i) {
+      sum += vec[i] * vec[i];
+    }
   }
 }
 
-std::chrono::microseconds measure_time_omp(unsigned num_threads) {
+std::chrono::microseconds measure_time_omp(
+  unsigned num_threads, const std::string& algorithm
+) {
   auto beg = std::chrono::high_resolution_clock::now();
-  reduce_sum_omp(num_threads);
+  reduce_sum_omp(num_threads, algorithm);
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
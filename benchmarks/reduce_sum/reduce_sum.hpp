@@ -8,10 +8,16 @@
 #include <random>
 #include <cmath>
 #include <atomic>
+#include <numeric>
+#include <string>
+#include <vector>
 
 inline std::vector<double> vec;
 
-std::chrono::microseconds measure_time_taskflow(unsigned);
-std::chrono::microseconds measure_time_tbb(unsigned);
-std::chrono::microseconds measure_time_omp(unsigned);
+// sum: the sum of the elements
+// norm: the sum of the squares of the elements
+std::chrono::microseconds measure_time_taskflow(unsigned, const std::string&);
+std::chrono::microseconds measure_time_taskflow_generic(unsigned, const std::string&);
+std::chrono::microseconds measure_time_tbb(unsigned, const std::string&);
+std::chrono::microseconds measure_time_omp(unsigned, const std::string&);
 
@@ -2,23 +2,62 @@
 #include <taskflow/taskflow.hpp>
 #include <taskflow/algorithm/reduce.hpp>
 
-void reduce_sum_taskflow(unsigned num_threads) {
+// reduce_sum_taskflow: std::plus takes the vectorized kernel
+void reduce_sum_taskflow(unsigned num_threads, const std::string& algorithm) {
 
   tf::Executor executor(num_threads);
   tf::Taskflow taskflow;
 
-  double result;
+  double result = 0.0;
 
-  taskflow.reduce(vec.begin(), vec.end(), result, [](double l, double r){
-    return l + r;
-  });
+  if(algorithm == "sum") {
+    taskflow.reduce(vec.begin(), vec.end(), result, std::plus<double>());
+  }
+  else {
+    taskflow.transform_reduce(vec.begin(), vec.end(), result,
+      std::plus<double>(), [](double d){ return d * d; }
+    );
+  }
 
   executor.run(taskflow).get();
 }
 
-std::chrono::microseconds measure_time_taskflow(unsigned num_threads) {
+// reduce_sum_taskflow_generic: a lambda takes the element-by-element loop
+void reduce_sum_taskflow_generic(unsigned num_threads, const std::string& algorithm) {
+
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  double result = 0.0;
+
+  if(algorithm == "sum") {
+    taskflow.reduce(vec.begin(), vec.end(), result, [](double l, double r){
+      return l + r;
+    });
+  }
+  else {
+    taskflow.transform_reduce(vec.begin(), vec.end(), result,
+      [](double l, double r){ return l + r; }, [](double d){ return d * d; }
+    );
+  }
+
+  executor.run(taskflow).get();
+}
+
+std::chrono::microseconds measure_time_taskflow(
+  unsigned num_threads, const std::string& algorithm
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  reduce_sum_taskflow(num_threads, algorithm);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+std::chrono::microseconds measure_time_taskflow_generic(
+  unsigned num_threads, const std::string& algorithm
+) {
   auto beg = std::chrono::high_resolution_clock::now();
-  reduce_sum_taskflow(num_threads);
+  reduce_sum_taskflow_generic(num_threads, algorithm);
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
@@ -4,16 +4,21 @@
 #include <tbb/global_control.h>
 
 // reduce_sum_tbb
-void reduce_sum_tbb(unsigned num_threads) {
+void reduce_sum_tbb(unsigned num_threads, const std::string& algorithm) {
 
   tbb::global_control c(
     tbb::global_control::max_allowed_parallelism, num_threads
   );
 
+  bool norm = (algorithm == "norm");
+
   tbb::parallel_reduce(
     tbb::blocked_range<double*>(vec.data(), vec.data() + vec.size()),
     0.0,
-    [](const tbb::blocked_range<double*>& r, double value) {
+    [norm](const tbb::blocked_range<double*>& r, double value) {
+      if(norm) {
+        return std::inner_product(r.begin(), r.end(), r.begin(), value);
+      }
       return std::accumulate(r.begin(), r.end(), value);
     },
     [](double l, double r) -> double {
@@ -24,9 +29,11 @@ void reduce_sum_tbb(unsigned num_threads) {
   //std::cout << reduce_sum() << std::endl;
 }
 
-std::chrono::microseconds measure_time_tbb(unsigned num_threads) {
+std::chrono::microseconds measure_time_tbb(
+  unsigned num_threads, const std::string& algorithm
+) {
   auto beg = std::chrono::high_resolution_clock::now();
-  reduce_sum_tbb(num_threads);
+  reduce_sum_tbb(num_threads, algorithm);
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
@@ -0,0 +1,109 @@
+// This benchmark measures the bandwidth of a SAXPY transform
+//   y[i] = a * x[i] + y[i]
+// over single-precision vectors of N elements:
+//   taskflow  : tf::FlowBuilder::transform with tf::StaticPartitioner
+//   sequential: std::transform on the calling thread
+//
+// Each element reads eight bytes and writes four bytes, and the reported
+// bandwidth counts these twelve bytes per element. Vectors that exceed
+// the last-level cache should approach the memory bandwidth of the machine.
+//
+// Example: ./saxpy -m taskflow -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/transform.hpp>
+#include <CLI11.hpp>
+
+std::chrono::microseconds measure_time(
+  const std::string& model, tf::Executor& executor,
+  float a, std::vector<float>& x, std::vector<float>& y
+) {
+
+  auto saxpy = [a] (float xi, float yi) { return a * xi + yi; };
+
+  std::chrono::high_resolution_clock::time_point beg, end;
+
+  if(model == "taskflow") {
+    tf::Taskflow taskflow;
+    taskflow.transform(
+      x.begin(), x.end(), y.begin(), y.begin(), saxpy, tf::StaticPartitioner()
+    );
+    beg = std::chrono::high_resolution_clock::now();
+    executor.run(taskflow).wait();
+    end = std::chrono::high_resolution_clock::now();
+  }
+  else if(model == "sequential") {
+    beg = std::chrono::high_resolution_clock::now();
+    std::transform(x.begin(), x.end(), y.begin(), y.begin(), saxpy);
+    end = std::chrono::high_resolution_clock::now();
+  }
+  else assert(false);
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void saxpy(
+  const std::string& model,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::setw(12) << "GB/s"
+            << std::endl;
+
+  for(size_t N=1000; N<=100000000; N*=10) {
+
+    std::vector<float> x(N, 1.0f);
+    std::vector<float> y(N, 2.0f);
+
+    // first touch
+    measure_time(model, executor, 0.5f, x, y);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(model, executor, 0.5f, x, y).count();
+    }
+
+    runtime /= num_rounds;
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / 1e3
+              << std::setw(12) << (runtime > 0 ? 12.0 * N / runtime / 1e3 : 0.0)
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"SAXPY"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model, "model name taskflow|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "sequential") {
+          return "model name should be \"taskflow\" or \"sequential\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  saxpy(model, num_threads, num_rounds);
+
+  return 0;
+}
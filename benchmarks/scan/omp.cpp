@@ -0,0 +1,25 @@
+#include "scan.hpp"
+#include <omp.h>
+
+// scan_omp
+// uses the inscan reduction of OpenMP 5.0
+void scan_omp(unsigned nthreads) {
+
+  omp_set_num_threads(nthreads);
+
+  int sum = 0;
+
+  #pragma omp parallel for reduction(inscan, +: sum)
+  for(size_t i=0; i<input.size(); ++i) {
+    sum += input[i];
+    #pragma omp scan inclusive(sum)
+    output[i] = sum;
+  }
+}
+
+std::chrono::microseconds measure_time_omp(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  scan_omp(num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
@@ -0,0 +1,18 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <atomic>
+#include <vector>
+
+inline std::vector<int> input;
+inline std::vector<int> output;
+
+std::chrono::microseconds measure_time_taskflow(unsigned);
+std::chrono::microseconds measure_time_omp(unsigned);
+std::chrono::microseconds measure_time_std(unsigned);
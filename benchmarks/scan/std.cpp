@@ -0,0 +1,25 @@
+#include "scan.hpp"
+#include <numeric>
+#include <execution>
+#include <tbb/global_control.h>
+
+// scan_std
+// the parallel policy of libstdc++ runs on TBB, whose number of threads
+// is limited through a global control object
+void scan_std(unsigned nthreads) {
+
+  tbb::global_control control(
+    tbb::global_control::max_allowed_parallelism, nthreads
+  );
+
+  std::inclusive_scan(
+    std::execution::par, input.begin(), input.end(), output.begin()
+  );
+}
+
+std::chrono::microseconds measure_time_std(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  scan_std(num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
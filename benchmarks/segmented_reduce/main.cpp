@@ -0,0 +1,161 @@
+// This benchmark sums the events of S users, whose numbers of events follow
+// a log-normal distribution with a median of about 3 and a mean of about 20,
+// such that a few users hold most of the events:
+//   taskflow   : tf::FlowBuilder::segmented_reduce or segmented_inclusive_scan
+//   per-segment: tf::FlowBuilder::for_each_index with one iteration
+//                per user, which balances the users rather than the events
+//   sequential : a loop over the users on the calling thread
+//
+// Example: ./segmented_reduce -m taskflow -a reduce -s 1000000 -t 4 -r 10
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/segmented.hpp>
+#include <CLI11.hpp>
+#include <random>
+
+std::chrono::microseconds measure_time(
+  const std::string& model, const std::string& algorithm,
+  tf::Executor& executor, const std::vector<size_t>& offsets,
+  const std::vector<double>& values, std::vector<double>& output
+) {
+
+  size_t S = offsets.size() - 1;
+
+  // reduces or scans segment s
+  auto segment = [&] (size_t s) {
+    auto b = values.begin() + offsets[s];
+    auto e = values.begin() + offsets[s+1];
+    if(algorithm == "reduce") {
+      output[s] = std::accumulate(b, e, 0.0);
+    }
+    else {
+      std::partial_sum(b, e, output.begin() + offsets[s]);
+    }
+  };
+
+  tf::Taskflow taskflow;
+
+  if(model == "taskflow") {
+    if(algorithm == "reduce") {
+      taskflow.segmented_reduce(
+        values.begin(), offsets.begin(), offsets.end(), output.begin(),
+        0.0, std::plus<double>()
+      );
+    }
+    else {
+      taskflow.segmented_inclusive_scan(
+        values.begin(), offsets.begin(), offsets.end(), output.begin(),
+        std::plus<double>()
+      );
+    }
+  }
+  else if(model == "per-segment") {
+    taskflow.for_each_index(size_t{0}, S, size_t{1}, segment);
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "sequential") {
+    for(size_t s=0; s<S; s++) {
+      segment(s);
+    }
+  }
+  else {
+    executor.run(taskflow).wait();
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void segmented_reduce(
+  const std::string& model,
+  const std::string& algorithm,
+  const size_t S,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::mt19937_64 rng(2023);
+  std::lognormal_distribution<double> length(1.0, 2.0);
+  std::uniform_real_distribution<double> value(0.0, 1.0);
+
+  std::cout << std::setw(12) << "segments"
+            << std::setw(12) << "elements"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t s=std::min(S, size_t{1000}); s<=S; s*=10) {
+
+    std::vector<size_t> offsets {0};
+    for(size_t i=0; i<s; i++) {
+      offsets.push_back(offsets.back() + static_cast<size_t>(length(rng)));
+    }
+
+    std::vector<double> values(offsets.back());
+    for(auto& v : values) {
+      v = value(rng);
+    }
+
+    std::vector<double> output(algorithm == "reduce" ? s : values.size());
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(model, algorithm, executor, offsets, values, output).count();
+    }
+
+    std::cout << std::setw(12) << s
+              << std::setw(12) << values.size()
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"SegmentedReduce"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t S {1000000};
+  app.add_option("-s,--num_segments", S, "largest number of segments (default=1000000)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model,
+    "model name taskflow|per-segment|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "per-segment" && m != "sequential") {
+          return "model name should be \"taskflow\", \"per-segment\", or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "reduce";
+  app.add_option("-a,--algorithm", algorithm, "algorithm reduce|scan (default=reduce)")
+     ->check([] (const std::string& a) {
+        if(a != "reduce" && a != "scan") {
+          return "algorithm should be \"reduce\" or \"scan\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
+            << "num_segments=" << S << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  segmented_reduce(model, algorithm, S, num_threads, num_rounds);
+
+  return 0;
+}
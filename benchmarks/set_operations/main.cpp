@@ -0,0 +1,150 @@
+// This benchmark joins and deduplicates two sorted lists of N 64-bit IDs,
+// drawn uniformly from [0, 2N) such that about a fifth of the IDs of a list
+// are duplicates and about two fifths of them are found in the other list:
+//   taskflow  : tf::FlowBuilder::set_intersection, set_union, set_difference,
+//               or unique
+//   sequential: the std:: counterpart on the calling thread
+//
+// Only the algorithm is timed; unique runs over a copy of the first list.
+//
+// Example: ./set_operations -m taskflow -a set_union -n 100000000 -t 4 -r 5
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/set.hpp>
+#include <CLI11.hpp>
+#include <random>
+
+std::chrono::microseconds measure_time(
+  const std::string& model, const std::string& algorithm,
+  tf::Executor& executor,
+  const std::vector<uint64_t>& a, const std::vector<uint64_t>& b,
+  std::vector<uint64_t>& output
+) {
+
+  std::vector<uint64_t>::iterator res;
+
+  tf::Taskflow taskflow;
+
+  if(algorithm == "unique") {
+    std::copy(a.begin(), a.end(), output.begin());
+    taskflow.unique(output.begin(), output.begin() + a.size(), res);
+  }
+  else if(algorithm == "set_intersection") {
+    taskflow.set_intersection(a.begin(), a.end(), b.begin(), b.end(), output.begin(), res);
+  }
+  else if(algorithm == "set_union") {
+    taskflow.set_union(a.begin(), a.end(), b.begin(), b.end(), output.begin(), res);
+  }
+  else {
+    taskflow.set_difference(a.begin(), a.end(), b.begin(), b.end(), output.begin(), res);
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model == "taskflow") {
+    executor.run(taskflow).wait();
+  }
+  else if(algorithm == "unique") {
+    res = std::unique(output.begin(), output.begin() + a.size());
+  }
+  else if(algorithm == "set_intersection") {
+    res = std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), output.begin());
+  }
+  else if(algorithm == "set_union") {
+    res = std::set_union(a.begin(), a.end(), b.begin(), b.end(), output.begin());
+  }
+  else {
+    res = std::set_difference(a.begin(), a.end(), b.begin(), b.end(), output.begin());
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void set_operations(
+  const std::string& model,
+  const std::string& algorithm,
+  const size_t N,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::mt19937_64 rng(2023);
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t n=std::min(N, size_t{1000000}); n<=N; n*=10) {
+
+    std::uniform_int_distribution<uint64_t> dist(0, 2*n - 1);
+
+    std::vector<uint64_t> a(n), b(n), output(2*n);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      for(size_t i=0; i<n; i++) {
+        a[i] = dist(rng);
+        b[i] = dist(rng);
+      }
+      std::sort(a.begin(), a.end());
+      std::sort(b.begin(), b.end());
+      runtime += measure_time(model, algorithm, executor, a, b, output).count();
+    }
+
+    std::cout << std::setw(12) << n
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"SetOperations"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  size_t N {10000000};
+  app.add_option("-n,--num_elements", N, "largest number of IDs per list (default=10000000)");
+
+  std::string model = "taskflow";
+  app.add_option("-m,--model", model, "model name taskflow|sequential (default=taskflow)")
+     ->check([] (const std::string& m) {
+        if(m != "taskflow" && m != "sequential") {
+          return "model name should be \"taskflow\" or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "set_intersection";
+  app.add_option("-a,--algorithm", algorithm,
+    "algorithm set_intersection|set_union|set_difference|unique (default=set_intersection)")
+     ->check([] (const std::string& a) {
+        if(a != "set_intersection" && a != "set_union" && a != "set_difference" &&
+           a != "unique") {
+          return "algorithm should be \"set_intersection\", \"set_union\", "
+                 "\"set_difference\", or \"unique\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
+            << "num_elements=" << N << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  set_operations(model, algorithm, N, num_threads, num_rounds);
+
+  return 0;
+}
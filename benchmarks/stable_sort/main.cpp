@@ -0,0 +1,92 @@
+#include "stable_sort.hpp"
+#include <CLI11.hpp>
+
+void stable_sort(
+  const std::string& model,
+  const std::string& algorithm,
+  const unsigned num_threads,
+  const unsigned num_rounds
+  ) {
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  for(size_t N=10; N<=100000000; N = N*10) {
+
+    vec.resize(N);
+    output.resize(N);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+
+      // few distinct keys such that stability matters
+      for(auto& d : vec) {
+        d = ::rand() % 1000;
+      }
+
+      // the merge takes the two sorted halves of the input
+      if(algorithm == "merge") {
+        std::sort(vec.begin(), vec.begin() + N/2);
+        std::sort(vec.begin() + N/2, vec.end());
+      }
+
+      if(model == "tf") {
+        runtime += measure_time_taskflow(algorithm, num_threads).count();
+      }
+      else if(model == "std") {
+        runtime += measure_time_std(algorithm, num_threads).count();
+      }
+      else if(model == "seq") {
+        runtime += measure_time_seq(algorithm).count();
+      }
+      else assert(false);
+    }
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"StableSort"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  std::string model = "tf";
+  app.add_option("-m,--model", model, "model name std|seq|tf (default=tf)")
+     ->check([] (const std::string& m) {
+        if(m != "std" && m != "tf" && m != "seq") {
+          return "model name should be \"std\", \"seq\", or \"tf\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "sort";
+  app.add_option("-a,--algorithm", algorithm, "algorithm sort|merge (default=sort)")
+     ->check([] (const std::string& a) {
+        if(a != "sort" && a != "merge") {
+          return "algorithm should be \"sort\" or \"merge\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  stable_sort(model, algorithm, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <atomic>
+#include <vector>
+
+// input of the stable sort, or the two sorted halves of the merge
+inline std::vector<int> vec;
+inline std::vector<int> output;
+
+std::chrono::microseconds measure_time_taskflow(const std::string&, unsigned);
+std::chrono::microseconds measure_time_std(const std::string&, unsigned);
+std::chrono::microseconds measure_time_seq(const std::string&);
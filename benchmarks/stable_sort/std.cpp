@@ -0,0 +1,48 @@
+#include "stable_sort.hpp"
+#include <execution>
+#include <tbb/global_control.h>
+
+// stable_sort_std
+// the parallel policy of libstdc++ runs on TBB, whose number of threads
+// is limited through a global control object
+void stable_sort_std(const std::string& algorithm, unsigned num_threads) {
+
+  tbb::global_control control(
+    tbb::global_control::max_allowed_parallelism, num_threads
+  );
+
+  if(algorithm == "sort") {
+    std::stable_sort(std::execution::par, vec.begin(), vec.end());
+  }
+  else {
+    auto mid = vec.begin() + vec.size() / 2;
+    std::merge(std::execution::par, vec.begin(), mid, mid, vec.end(), output.begin());
+  }
+}
+
+// stable_sort_seq
+void stable_sort_seq(const std::string& algorithm) {
+  if(algorithm == "sort") {
+    std::stable_sort(vec.begin(), vec.end());
+  }
+  else {
+    auto mid = vec.begin() + vec.size() / 2;
+    std::merge(vec.begin(), mid, mid, vec.end(), output.begin());
+  }
+}
+
+std::chrono::microseconds measure_time_std(
+  const std::string& algorithm, unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  stable_sort_std(algorithm, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+std::chrono::microseconds measure_time_seq(const std::string& algorithm) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  stable_sort_seq(algorithm);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
@@ -0,0 +1,28 @@
+#include "stable_sort.hpp"
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/sort.hpp>
+
+void stable_sort_taskflow(const std::string& algorithm, unsigned num_threads) {
+
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  if(algorithm == "sort") {
+    taskflow.stable_sort(vec.begin(), vec.end());
+  }
+  else {
+    auto mid = vec.begin() + vec.size() / 2;
+    taskflow.merge(vec.begin(), mid, mid, vec.end(), output.begin());
+  }
+
+  executor.run(taskflow).get();
+}
+
+std::chrono::microseconds measure_time_taskflow(
+  const std::string& algorithm, unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  stable_sort_taskflow(algorithm, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
@@ -0,0 +1,218 @@
+// This benchmark runs two loop nests over N x N matrices of doubles:
+//   matmul: c = a * b
+//   jacobi: ten sweeps of the five-point stencil over the interior
+// with three models:
+//   tiled     : tf::FlowBuilder::for_each_index over a tf::IndexRange2D
+//               with B x B tiles for matmul, which also blocks the inner
+//               dimension by B, and B x 16B tiles for jacobi, whose sweeps
+//               stream along the rows and would miss the TLB on every
+//               row of a narrow tile
+//   rows      : tf::FlowBuilder::for_each_index over the rows
+//   affinity  : the same loop over the rows with a tf::AffinityPartitioner
+//               shared by all sweeps, such that a worker gets back the rows
+//               it updated in the previous sweep
+//   sequential: the untiled loop nest on the calling thread
+//
+// Example: ./tiled_loops -m tiled -a matmul -b 64 -t 4 -r 5
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <CLI11.hpp>
+
+using Tile = tf::IndexRange2D<int>;
+
+// c[i0, i1) x [j0, j1) += a[i0, i1) x [k0, k1) * b[k0, k1) x [j0, j1)
+void matmul_block(
+  int N, const double* a, const double* b, double* c,
+  int i0, int i1, int j0, int j1, int k0, int k1
+) {
+  for(int i=i0; i<i1; i++) {
+    for(int k=k0; k<k1; k++) {
+      double aik = a[i*N + k];
+      for(int j=j0; j<j1; j++) {
+        c[i*N + j] += aik * b[k*N + j];
+      }
+    }
+  }
+}
+
+// out = stencil(in) over the rows [i0, i1) and columns [j0, j1)
+void jacobi_block(
+  int N, const double* in, double* out, int i0, int i1, int j0, int j1
+) {
+  for(int i=i0; i<i1; i++) {
+    for(int j=j0; j<j1; j++) {
+      out[i*N + j] = 0.25 * (in[(i-1)*N + j] + in[(i+1)*N + j] +
+                             in[i*N + j - 1] + in[i*N + j + 1]);
+    }
+  }
+}
+
+std::chrono::microseconds measure_time(
+  const std::string& model, const std::string& algorithm,
+  tf::Executor& executor, int N, int B,
+  std::vector<double>& a, std::vector<double>& b, std::vector<double>& c
+) {
+
+  const int sweeps = 10;
+
+  tf::Taskflow taskflow;
+
+  if(algorithm == "matmul") {
+    std::fill(c.begin(), c.end(), 0.0);
+    if(model == "tiled") {
+      taskflow.for_each_index(Tile({0, 0}, {N, N}, {B, B}), [&](const Tile& t){
+        for(int k=0; k<N; k+=B) {
+          matmul_block(N, a.data(), b.data(), c.data(),
+            t.begin(0), t.end(0), t.begin(1), t.end(1), k, std::min(k+B, N)
+          );
+        }
+      });
+    }
+    else if(model == "rows") {
+      taskflow.for_each_index(0, N, 1, [&](int i){
+        matmul_block(N, a.data(), b.data(), c.data(), i, i+1, 0, N, 0, N);
+      });
+    }
+    else if(model == "affinity") {
+      taskflow.for_each_index(0, N, 1, [&](int i){
+        matmul_block(N, a.data(), b.data(), c.data(), i, i+1, 0, N, 0, N);
+      }, tf::AffinityPartitioner());
+    }
+  }
+  else {
+    // a is the initial grid and both a and b hold its boundary
+    std::copy(a.begin(), a.end(), b.begin());
+    tf::AffinityPartitioner part;
+    tf::Task prev;
+    for(int s=0; s<sweeps; s++) {
+      const double* in = (s % 2 ? b : a).data();
+      double* out = (s % 2 ? a : b).data();
+      tf::Task task;
+      if(model == "tiled") {
+        task = taskflow.for_each_index(Tile({1, 1}, {N-1, N-1}, {B, 16*B}),
+          [=](const Tile& t){
+            jacobi_block(N, in, out, t.begin(0), t.end(0), t.begin(1), t.end(1));
+          }
+        );
+      }
+      else if(model == "rows") {
+        task = taskflow.for_each_index(1, N-1, 1, [=](int i){
+          jacobi_block(N, in, out, i, i+1, 1, N-1);
+        });
+      }
+      else if(model == "affinity") {
+        task = taskflow.for_each_index(1, N-1, 1, [=](int i){
+          jacobi_block(N, in, out, i, i+1, 1, N-1);
+        }, part);
+      }
+      if(s > 0 && model != "sequential") {
+        prev.precede(task);
+      }
+      prev = task;
+    }
+  }
+
+  auto beg = std::chrono::high_resolution_clock::now();
+
+  if(model != "sequential") {
+    executor.run(taskflow).wait();
+  }
+  else if(algorithm == "matmul") {
+    matmul_block(N, a.data(), b.data(), c.data(), 0, N, 0, N, 0, N);
+  }
+  else {
+    for(int s=0; s<sweeps; s++) {
+      const double* in = (s % 2 ? b : a).data();
+      double* out = (s % 2 ? a : b).data();
+      jacobi_block(N, in, out, 1, N-1, 1, N-1);
+    }
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+void tiled_loops(
+  const std::string& model,
+  const std::string& algorithm,
+  const int B,
+  const unsigned num_threads,
+  const unsigned num_rounds
+) {
+
+  tf::Executor executor(num_threads);
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+
+  int max_N = (algorithm == "matmul") ? 1024 : 4096;
+
+  for(int N=128; N<=max_N; N*=2) {
+
+    std::vector<double> a(N*N), b(N*N), c(N*N);
+
+    for(int i=0; i<N*N; i++) {
+      a[i] = i % 7;
+      b[i] = i % 5;
+    }
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      runtime += measure_time(
+        model, algorithm, executor, N, B, a, b, c
+      ).count();
+    }
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"TiledLoops"};
+
+  unsigned num_threads {1};
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+
+  int B {64};
+  app.add_option("-b,--tile_size", B, "tile size of each dimension (default=64)");
+
+  std::string model = "tiled";
+  app.add_option("-m,--model", model, "model name tiled|rows|affinity|sequential (default=tiled)")
+     ->check([] (const std::string& m) {
+        if(m != "tiled" && m != "rows" && m != "affinity" && m != "sequential") {
+          return "model name should be \"tiled\", \"rows\", \"affinity\", or \"sequential\"";
+        }
+        return "";
+     });
+
+  std::string algorithm = "matmul";
+  app.add_option("-a,--algorithm", algorithm, "algorithm matmul|jacobi (default=matmul)")
+     ->check([] (const std::string& a) {
+        if(a != "matmul" && a != "jacobi") {
+          return "algorithm should be \"matmul\" or \"jacobi\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::cout << "model=" << model << ' '
+            << "algorithm=" << algorithm << ' '
+            << "tile_size=" << B << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << std::endl;
+
+  tiled_loops(model, algorithm, B, num_threads, num_rounds);
+
+  return 0;
+}
@@ -33,6 +33,9 @@ void wavefront(
       if(model == "tf") {
         runtime += measure_time_taskflow(num_threads).count();
       }
+      else if(model == "tf-grid") {
+        runtime += measure_time_taskflow_grid(num_threads).count();
+      }
       else if(model == "tbb") {
         runtime += measure_time_tbb(num_threads).count();
       }
@@ -61,10 +64,10 @@ int main(int argc, char* argv[]) {
   app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
 
   std::string model = "tf";
-  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+  app.add_option("-m,--model", model, "model name tbb|omp|tf|tf-grid (default=tf)")
      ->check([] (const std::string& m) {
-        if(m != "tbb" && m != "omp" && m != "tf") {
-          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        if(m != "tbb" && m != "omp" && m != "tf" && m != "tf-grid") {
+          return "model name should be \"tbb\", \"omp\", \"tf\", or \"tf-grid\"";
         }
         return "";
      });
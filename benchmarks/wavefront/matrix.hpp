@@ -80,6 +80,7 @@ inline void framework_computation(int i, int j){
 
 
 std::chrono::microseconds measure_time_taskflow(unsigned);
+std::chrono::microseconds measure_time_taskflow_grid(unsigned);
 std::chrono::microseconds measure_time_omp(unsigned);
 std::chrono::microseconds measure_time_tbb(unsigned);
 
@@ -1,5 +1,6 @@
 #include "matrix.hpp"
 #include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/wavefront.hpp>
 
 // wavefront computing
 void wavefront_taskflow(unsigned num_threads) {
@@ -39,4 +40,25 @@ std::chrono::microseconds measure_time_taskflow(unsigned num_threads) {
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
 
+// wavefront computing with tf::FlowBuilder::wavefront, which schedules
+// the blocks without a task per block
+void wavefront_taskflow_grid(unsigned num_threads) {
 
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  matrix[M-1][N-1] = 0;
+
+  taskflow.wavefront(MB, NB, [] (size_t i, size_t j) {
+    block_computation(static_cast<int>(i), static_cast<int>(j));
+  });
+
+  executor.run(taskflow).get();
+}
+
+std::chrono::microseconds measure_time_taskflow_grid(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  wavefront_taskflow_grid(num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
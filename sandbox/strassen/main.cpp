@@ -39,6 +39,9 @@ void strassen_alg(
     if(model == "tf") {
       runtime += measure_time_taskflow(num_threads, MatrixA, MatrixB, MatrixC, MATRIX_SIZE).count();
     }
+    else if(model == "tf-invoke") {
+      runtime += measure_time_taskflow_invoke(num_threads, MatrixA, MatrixB, MatrixC, MATRIX_SIZE).count();
+    }
     else if(model == "tbb") {
       runtime += measure_time_tbb(num_threads, MatrixA, MatrixB, MatrixC, MATRIX_SIZE).count();
     }
@@ -71,10 +74,10 @@ int main(int argc, char* argv[]) {
   app.add_option("-c,--check", check_result, "compare result with sequential mode (default=false)");
 
   std::string model = "tf";
-  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+  app.add_option("-m,--model", model, "model name tbb|omp|tf|tf-invoke (default=tf)")
      ->check([] (const std::string& m) {
-        if(m != "tbb" && m != "tf" && m != "omp") {
-          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        if(m != "tbb" && m != "tf" && m != "omp" && m != "tf-invoke") {
+          return "model name should be \"tbb\", \"omp\", \"tf\", or \"tf-invoke\"";
         }
         return "";
      });
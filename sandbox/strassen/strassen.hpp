@@ -674,4 +674,5 @@ inline void init_ABC() {
 std::chrono::microseconds measure_time_omp(unsigned, REAL *, REAL *, REAL *, int);
 std::chrono::microseconds measure_time_tbb(unsigned, REAL *, REAL *, REAL *, int);
 std::chrono::microseconds measure_time_taskflow(unsigned, REAL *, REAL *, REAL *, int);
+std::chrono::microseconds measure_time_taskflow_invoke(unsigned, REAL *, REAL *, REAL *, int);
 
@@ -1,9 +1,27 @@
 #include <taskflow/taskflow.hpp>
 #include "strassen.hpp"
 
+// runs the products as tasks of the subflow, followed by the combination
+template <typename E, typename... Ps>
+void fork_join(tf::Subflow& subflow, E&& end, Ps&&... products) {
+  auto end_task = subflow.emplace(std::forward<E>(end));
+  (end_task.succeed(subflow.emplace(
+    [p=std::forward<Ps>(products)](tf::Subflow& sf) mutable { p(sf); }
+  )), ...);
+}
+
+// runs the products with parallel_invoke, followed by the combination
+template <typename E, typename... Ps>
+void fork_join(tf::Runtime& rt, E&& end, Ps&&... products) {
+  rt.parallel_invoke([&products](tf::Runtime& r){ products(r); }...);
+  end();
+}
+
+// F is either tf::Subflow (model tf) or tf::Runtime (model tf-invoke)
+template <typename F>
 void OptimizedStrassenMultiply_tf(
   REAL *C, REAL *A, REAL *B, unsigned MatrixSize,
-  unsigned RowWidthC, unsigned RowWidthA, unsigned RowWidthB, int Depth, tf::Subflow& subflow)
+  unsigned RowWidthC, unsigned RowWidthA, unsigned RowWidthB, int Depth, F& flow)
 {
   unsigned QuadrantSize = MatrixSize >> 1; /* MatixSize / 2 */
   unsigned QuadrantSizeInBytes = sizeof(REAL) * QuadrantSize * QuadrantSize + 32;
@@ -122,43 +140,6 @@ void OptimizedStrassenMultiply_tf(
     MatrixOffsetB += RowIncrementB;
   } /* end column loop */
 
-  std::vector<tf::Task> tasks;
-
-  /* M2 = A11 x B11 */
-  tasks.emplace_back(subflow.emplace([=](auto& subflow) {
-    OptimizedStrassenMultiply_tf(M2, A11, B11, QuadrantSize, QuadrantSize, RowWidthA, RowWidthB, Depth+1, subflow);
-  }));
-
-  /* M5 = S1 * S5 */
-  tasks.emplace_back(subflow.emplace([=](auto &subflow) {
-    OptimizedStrassenMultiply_tf(M5, S1, S5, QuadrantSize, QuadrantSize, QuadrantSize, QuadrantSize, Depth+1, subflow);
-  }));
-
-  /* Step 1 of T1 = S2 x S6 + M2 */
-  tasks.emplace_back(subflow.emplace([=](auto& subflow){
-    OptimizedStrassenMultiply_tf(T1sMULT, S2, S6,  QuadrantSize, QuadrantSize, QuadrantSize, QuadrantSize, Depth+1, subflow);
-  }));
-
-  /* Step 1 of T2 = T1 + S3 x S7 */
-  tasks.emplace_back(subflow.emplace([=](auto &subflow){
-    OptimizedStrassenMultiply_tf(C22, S3, S7, QuadrantSize, RowWidthC /*FIXME*/, QuadrantSize, QuadrantSize, Depth+1, subflow);
-  }));
-
-  /* Step 1 of C11 = M2 + A12 * B21 */
-  tasks.emplace_back(subflow.emplace([=](auto &subflow){
-    OptimizedStrassenMultiply_tf(C11, A12, B21, QuadrantSize, RowWidthC, RowWidthA, RowWidthB, Depth+1, subflow);
-  }));
-
-  /* Step 1 of C12 = S4 x B22 + T1 + M5 */
-  tasks.emplace_back(subflow.emplace([=](auto &subflow){
-    OptimizedStrassenMultiply_tf(C12, S4, B22, QuadrantSize, RowWidthC, QuadrantSize, RowWidthB, Depth+1, subflow);
-  }));
-
-  /* Step 1 of C21 = T2 - A22 * S8 */
-  tasks.emplace_back(subflow.emplace([=](auto &subflow){
-    OptimizedStrassenMultiply_tf(C21, A22, S8, QuadrantSize, RowWidthC, RowWidthA, QuadrantSize, Depth+1, subflow);
-  }));
-
   /**********************************************
   ** Synchronization Point
   **********************************************/
@@ -168,7 +149,7 @@ void OptimizedStrassenMultiply_tf(
   ** (but we want the best locality on the innermost loop)
   ***************************************************************************/
 
-  auto end_task = subflow.emplace([=]() mutable {
+  auto end = [=]() mutable {
     for (auto Row = 0u; Row < QuadrantSize; Row++) {
       /*************************************************************************
       ** Step through each row horizontally (addressing elements in each column)
@@ -221,16 +202,45 @@ void OptimizedStrassenMultiply_tf(
       C22 = (REAL*) ( ((PTR) C22 ) + RowIncrementC);
     }
     free(StartHeap);
-  });
-
-  end_task.gather(tasks);
+  };
+
+  fork_join(flow, end,
+    /* M2 = A11 x B11 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(M2, A11, B11, QuadrantSize, QuadrantSize, RowWidthA, RowWidthB, Depth+1, f);
+    },
+    /* M5 = S1 * S5 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(M5, S1, S5, QuadrantSize, QuadrantSize, QuadrantSize, QuadrantSize, Depth+1, f);
+    },
+    /* Step 1 of T1 = S2 x S6 + M2 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(T1sMULT, S2, S6,  QuadrantSize, QuadrantSize, QuadrantSize, QuadrantSize, Depth+1, f);
+    },
+    /* Step 1 of T2 = T1 + S3 x S7 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(C22, S3, S7, QuadrantSize, RowWidthC /*FIXME*/, QuadrantSize, QuadrantSize, Depth+1, f);
+    },
+    /* Step 1 of C11 = M2 + A12 * B21 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(C11, A12, B21, QuadrantSize, RowWidthC, RowWidthA, RowWidthB, Depth+1, f);
+    },
+    /* Step 1 of C12 = S4 x B22 + T1 + M5 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(C12, S4, B22, QuadrantSize, RowWidthC, QuadrantSize, RowWidthB, Depth+1, f);
+    },
+    /* Step 1 of C21 = T2 - A22 * S8 */
+    [=](auto& f) {
+      OptimizedStrassenMultiply_tf(C21, A22, S8, QuadrantSize, RowWidthC, RowWidthA, QuadrantSize, Depth+1, f);
+    }
+  );
 }
 
 void strassen_taskflow(unsigned num_threads, REAL *A, REAL *B, REAL *C, int n) {
   tf::Taskflow flow;
 
   flow.emplace(
-    [=](auto &subflow) {
+    [=](tf::Subflow& subflow) {
       OptimizedStrassenMultiply_tf(C, A, B, n, n, n, n, 1, subflow);
     }
   );
@@ -245,3 +255,22 @@ std::chrono::microseconds measure_time_taskflow(unsigned num_threads, REAL *A, R
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
 
+void strassen_taskflow_invoke(unsigned num_threads, REAL *A, REAL *B, REAL *C, int n) {
+  tf::Taskflow flow;
+
+  flow.emplace(
+    [=](tf::Runtime& rt) {
+      OptimizedStrassenMultiply_tf(C, A, B, n, n, n, n, 1, rt);
+    }
+  );
+
+  tf::Executor(num_threads).run(flow).wait();
+}
+
+std::chrono::microseconds measure_time_taskflow_invoke(unsigned num_threads, REAL *A, REAL *B, REAL *C, int n) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  strassen_taskflow_invoke(num_threads, A, B, C, n);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// breadth-first search
+// ----------------------------------------------------------------------------
+
+// Procedure: _bfs
+// labels the N vertices of the CSR graph with their levels from the source,
+// one level at a time, in either direction:
+//   1. a top-down step scans the edges of the frontier vertices, which the
+//      calling worker keeps in a queue, and claims the unvisited neighbors
+//      in the visited bitmap, each worker appending the vertices it claims
+//      to its own buffer of the next frontier
+//   2. a bottom-up step scans the edges of the unvisited vertices, 64 of them
+//      per bitmap word, and stops at the first neighbor in the frontier
+//      bitmap, which saves most of the edge checks once the frontier holds
+//      a large share of the edges
+// following the heuristic of Beamer et al., the search goes bottom-up once
+// the frontier has more than 1/alpha of the unexplored edges, and top-down
+// again once the frontier shrinks below 1/beta of the vertices
+template <typename O, typename E, typename L>
+void FlowBuilder::_bfs(
+  Subflow& sf, O offsets, E edges, size_t N, size_t source, L levels
+) {
+
+  using vertex_type = typename std::iterator_traits<E>::value_type;
+  using level_type  = typename std::iterator_traits<L>::value_type;
+
+  constexpr size_t alpha = 14;
+  constexpr size_t beta  = 24;
+
+  // graphs of fewer vertices and frontiers of fewer edges run on the
+  // calling worker alone
+  constexpr size_t cutoff = 4096;
+
+  const level_type unreached = static_cast<level_type>(-1);
+
+  auto degree = [&] (size_t v) {
+    return static_cast<size_t>(offsets[v+1] - offsets[v]);
+  };
+
+  size_t W = sf._executor.num_workers();
+
+  // a small graph takes a plain queue
+  if(N <= cutoff) {
+    std::fill(levels, levels + N, unreached);
+    std::vector<vertex_type> queue {static_cast<vertex_type>(source)};
+    levels[source] = 0;
+    for(size_t i=0; i<queue.size(); i++) {
+      size_t u = static_cast<size_t>(queue[i]);
+      for(size_t e=offsets[u], end=offsets[u+1]; e<end; e++) {
+        size_t v = static_cast<size_t>(edges[e]);
+        if(levels[v] == unreached) {
+          levels[v] = static_cast<level_type>(levels[u] + 1);
+          queue.push_back(edges[e]);
+        }
+      }
+    }
+    return;
+  }
+
+  // bitmaps of 64 vertices per word
+  size_t NW = (N + 63) / 64;
+
+  std::unique_ptr<std::atomic<uint64_t>[]> visited(new std::atomic<uint64_t>[NW]);
+  std::vector<uint64_t> front(NW), front_next(NW);
+
+  std::vector<vertex_type> queue, queue_next;
+  std::vector<std::vector<vertex_type>> buffers(W);
+  std::vector<size_t> starts(W);
+  std::vector<CachelineAligned<size_t>> edge_counts(W), vertex_counts(W);
+
+  std::atomic<size_t> next(0);
+
+  // runs body(w, s0, e0) over the chunks of [0, n) on the workers, or over
+  // [0, n) on the calling worker when the work is small, which keeps the
+  // direction optimization of a single worker
+  auto run = [&] (size_t n, size_t chunk, bool small, auto&& body) {
+    if(small || W <= 1) {
+      body(size_t{0}, size_t{0}, n);
+      return;
+    }
+    GuidedPartitioner part(chunk);
+    auto loop = [&] (size_t w) {
+      part.loop(n, W, w, next, [&] (size_t s0, size_t e0) {
+        body(w, s0, e0);
+      });
+    };
+    next.store(0, std::memory_order_relaxed);
+    sf.reset(false);
+    _launch_loop(sf, part, n, W, next, loop);
+  };
+
+  // the vertices of the frontier bitmap or their buffers become the queue
+  auto gather = [&] () {
+    size_t total = 0;
+    for(size_t w=0; w<W; w++) {
+      starts[w] = total;
+      total += buffers[w].size();
+    }
+    queue_next.resize(total);
+    run(W, 1, total <= cutoff, [&] (size_t, size_t s0, size_t e0) {
+      for(size_t w=s0; w<e0; w++) {
+        std::copy(buffers[w].begin(), buffers[w].end(), queue_next.begin() + starts[w]);
+        buffers[w].clear();
+      }
+    });
+    queue.swap(queue_next);
+  };
+
+  run(NW, 64, false, [&] (size_t, size_t s0, size_t e0) {
+    for(size_t i=s0; i<e0; i++) {
+      visited[i].store(0, std::memory_order_relaxed);
+    }
+    std::fill(levels + s0*64, levels + std::min(e0*64, N), unreached);
+  });
+
+  levels[source] = 0;
+  visited[source/64].store(uint64_t{1} << (source%64), std::memory_order_relaxed);
+  queue.push_back(static_cast<vertex_type>(source));
+
+  size_t n_f = 1;
+  size_t m_f = degree(source);
+  size_t m_u = static_cast<size_t>(offsets[N] - offsets[0]) - m_f;
+
+  bool bottom_up = false;
+
+  for(size_t d=0; n_f > 0; d++) {
+
+    level_type l = static_cast<level_type>(d + 1);
+
+    for(size_t w=0; w<W; w++) {
+      edge_counts[w].data = 0;
+      vertex_counts[w].data = 0;
+    }
+
+    // switch to the bottom-up steps, with the frontier of level d as a bitmap
+    if(!bottom_up && m_f > m_u / alpha) {
+      bottom_up = true;
+      level_type f = static_cast<level_type>(d);
+      run(NW, 64, false, [&] (size_t, size_t s0, size_t e0) {
+        for(size_t i=s0; i<e0; i++) {
+          uint64_t word = 0;
+          for(size_t b=0, v=i*64; b<64 && v<N; b++, v++) {
+            word |= uint64_t{levels[v] == f} << b;
+          }
+          front[i] = word;
+        }
+      });
+    }
+
+    if(bottom_up) {
+
+      run(NW, 64, false, [&] (size_t w, size_t s0, size_t e0) {
+        size_t m = 0, c = 0;
+        for(size_t i=s0; i<e0; i++) {
+          uint64_t seen = visited[i].load(std::memory_order_relaxed);
+          uint64_t found = 0;
+          for(size_t b=0, v=i*64; b<64 && v<N; b++, v++) {
+            if((seen >> b) & 1) {
+              continue;
+            }
+            for(size_t e=offsets[v], end=offsets[v+1]; e<end; e++) {
+              size_t u = static_cast<size_t>(edges[e]);
+              if((front[u/64] >> (u%64)) & 1) {
+                levels[v] = l;
+                found |= uint64_t{1} << b;
+                m += degree(v);
+                c++;
+                break;
+              }
+            }
+          }
+          front_next[i] = found;
+          visited[i].store(seen | found, std::memory_order_relaxed);
+        }
+        edge_counts[w].data += m;
+        vertex_counts[w].data += c;
+      });
+
+      front.swap(front_next);
+    }
+    else {
+
+      run(queue.size(), 64, m_f <= cutoff, [&] (size_t w, size_t s0, size_t e0) {
+        auto& buffer = buffers[w];
+        size_t m = 0, c = buffer.size();
+        for(size_t i=s0; i<e0; i++) {
+          size_t u = static_cast<size_t>(queue[i]);
+          for(size_t e=offsets[u], end=offsets[u+1]; e<end; e++) {
+            size_t v = static_cast<size_t>(edges[e]);
+            uint64_t bit = uint64_t{1} << (v%64);
+            auto& word = visited[v/64];
+            if((word.load(std::memory_order_relaxed) & bit) ||
+               (word.fetch_or(bit, std::memory_order_relaxed) & bit)) {
+              continue;
+            }
+            levels[v] = l;
+            buffer.push_back(edges[e]);
+            m += degree(v);
+          }
+        }
+        edge_counts[w].data += m;
+        vertex_counts[w].data += buffer.size() - c;
+      });
+    }
+
+    size_t n_p = n_f;
+
+    n_f = 0;
+    m_f = 0;
+    for(size_t w=0; w<W; w++) {
+      n_f += vertex_counts[w].data;
+      m_f += edge_counts[w].data;
+    }
+    m_u -= m_f;
+
+    if(!bottom_up) {
+      gather();
+    }
+    // switch back to the top-down steps, with the frontier of level d+1
+    // as a queue
+    else if(n_f < n_p && n_f < N / beta) {
+      bottom_up = false;
+      run(NW, 64, false, [&] (size_t w, size_t s0, size_t e0) {
+        for(size_t i=s0; i<e0; i++) {
+          for(size_t b=0, v=i*64; b<64 && v<N; b++, v++) {
+            if((front[i] >> b) & 1) {
+              buffers[w].push_back(static_cast<vertex_type>(v));
+            }
+          }
+        }
+      });
+      gather();
+    }
+  }
+}
+
+// Function: bfs
+template <typename OB, typename OE, typename E, typename S, typename L>
+Task FlowBuilder::bfs(
+  OB offsets_first, OE offsets_last, E edges, S source, L levels
+) {
+
+  using OB_t = neo::decay_t<unwrap_ref_decay_t<OB>>;
+  using OE_t = neo::decay_t<unwrap_ref_decay_t<OE>>;
+  using E_t  = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using S_t  = neo::decay_t<unwrap_ref_decay_t<S>>;
+  using L_t  = neo::decay_t<unwrap_ref_decay_t<L>>;
+
+  Task task = emplace(
+  [ob=offsets_first, oe=offsets_last, e=edges, s=source, l=levels]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    OB_t o_beg = ob;
+    OE_t o_end = oe;
+    E_t  adj = e;
+    S_t  src = s;
+    L_t  lvl = l;
+
+    // the offsets of N vertices come with the end of the last one
+    size_t N = std::distance(o_beg, o_end);
+
+    if(N <= 1) {
+      return;
+    }
+
+    _bfs(sf, o_beg, adj, N - 1, static_cast<size_t>(src), lvl);
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -650,7 +650,7 @@ void DataPipeline<Ps...>::_build() {
           goto pipeline;
         }
       }
-    }).name(std::string("rt-") + std::to_string(l));
+    }).name(TaskName::literal("rt", l));
 
     _tasks[0].precede(_tasks[l+1]);
   }
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Function: atomic_min
+// lowers the value of v to x unless it is already smaller
+inline void atomic_min(std::atomic<size_t>& v, size_t x) {
+  size_t cur = v.load(std::memory_order_relaxed);
+  while(x < cur && !v.compare_exchange_weak(cur, x, std::memory_order_relaxed,
+                                                    std::memory_order_relaxed));
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// find
+// ----------------------------------------------------------------------------
+
+// Function: find_if
+template <typename B, typename E, typename T, typename UOP, typename P>
+Task FlowBuilder::find_if(B first, E last, T& result, UOP predicate, P part) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([b=first, e=last, &r=result, predicate, part]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= part.chunk_size()) {
+      r = std::find_if(beg, end, predicate);
+      return;
+    }
+
+    if(N < W) {
+      W = N;
+    }
+
+    // the index of the first match found so far, polled by the other
+    // workers every few elements such that they abandon the chunks
+    // beyond it; chunks of a worker come in increasing order, so
+    // a worker stops at the first chunk beyond the match
+    std::atomic<size_t> best(N);
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next, &best] (size_t w) mutable {
+      auto at = detail::make_chunk_cursor(beg);
+      part.loop_until(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto itr = at(s0);
+        for(size_t x=s0; x<e0;) {
+          if(x >= best.load(std::memory_order_relaxed)) {
+            return true;
+          }
+          for(size_t e=std::min(e0, x+256); x<e; x++, ++itr) {
+            if(predicate(*itr)) {
+              detail::atomic_min(best, x);
+              return true;
+            }
+          }
+        }
+        return false;
+      });
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+
+    r = std::next(beg, best.load(std::memory_order_relaxed));
+  });
+
+  return task;
+}
+
+// Function: find_if_not
+template <typename B, typename E, typename T, typename UOP, typename P>
+Task FlowBuilder::find_if_not(B first, E last, T& result, UOP predicate, P part) {
+  return find_if(first, last, result,
+    [predicate] (auto&& v) mutable { return !predicate(v); }, part
+  );
+}
+
+// ----------------------------------------------------------------------------
+// min/max element
+// ----------------------------------------------------------------------------
+
+// Function: min_element
+template <typename B, typename E, typename T, typename C, typename P>
+Task FlowBuilder::min_element(B first, E last, T& result, C comp, P part) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([b=first, e=last, &r=result, comp, part]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= part.chunk_size()) {
+      r = std::min_element(beg, end, comp);
+      return;
+    }
+
+    if(N < W) {
+      W = N;
+    }
+
+    // the first smallest element of each worker
+    struct Smallest {
+      size_t index;
+      B_t itr;
+    };
+
+    std::vector<CachelineAligned<Smallest>> smallest(W);
+    std::atomic<size_t> next(0);
+
+    // a worker may receive no chunk at all
+    for(auto& s : smallest) {
+      s.data.index = N;
+    }
+
+    auto loop = [=, &next, &smallest] (size_t w) mutable {
+
+      auto at = detail::make_chunk_cursor(beg);
+      size_t index = N;
+      B_t low = beg;
+
+      // ties go to the element of the smaller index, since the chunks of
+      // a worker need not come in increasing order (tf::AffinityPartitioner)
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto itr = at(s0);
+        if(index == N) {
+          index = s0++;
+          low = itr++;
+        }
+        for(size_t x=s0; x<e0; x++, ++itr) {
+          if(comp(*itr, *low) || (x < index && !comp(*low, *itr))) {
+            index = x;
+            low = itr;
+          }
+        }
+      });
+
+      smallest[w].data = Smallest{index, low};
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+
+    // ties go to the element of the smaller index
+    Smallest* m = nullptr;
+    for(auto& s : smallest) {
+      if(s.data.index == N) {
+        continue;
+      }
+      if(m == nullptr || comp(*s.data.itr, *m->itr) ||
+         (!comp(*m->itr, *s.data.itr) && s.data.index < m->index)) {
+        m = &s.data;
+      }
+    }
+
+    r = m->itr;
+  });
+
+  return task;
+}
+
+// Function: max_element
+template <typename B, typename E, typename T, typename C, typename P>
+Task FlowBuilder::max_element(B first, E last, T& result, C comp, P part) {
+  return min_element(first, last, result,
+    [comp] (const auto& a, const auto& b) mutable { return comp(b, a); }, part
+  );
+}
+
+}  // end of namespace tf -----------------------------------------------------
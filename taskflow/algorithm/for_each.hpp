@@ -1,33 +1,263 @@
-// reference:
-// - gomp: https://github.com/gcc-mirror/gcc/blob/master/libgomp/iter.c
-// - komp: https://github.com/llvm-mirror/openmp/blob/master/runtime/src/kmp_dispatch.cpp
-
 #pragma once
 
-#include "../core/executor.hpp"
+#include "launch.hpp"
 
 namespace tf {
 
+namespace detail {
+
+// Struct: is_worker_range_callable
+// determines if a range callable also takes the index of the worker
+template <typename C, typename I, typename J, typename = void>
+struct is_worker_range_callable : std::false_type {};
+
+template <typename C, typename I, typename J>
+struct is_worker_range_callable<C, I, J, decltype(void(
+  std::declval<C&>()(std::declval<I>(), std::declval<J>(), size_t{0})
+))> : std::true_type {};
+
+// Procedure: invoke_range
+template <typename C, typename I, typename J>
+void invoke_range(C& c, I first, J last, size_t, std::false_type) {
+  c(first, last);
+}
+
+template <typename C, typename I, typename J>
+void invoke_range(C& c, I first, J last, size_t w, std::true_type) {
+  c(first, last, w);
+}
+
+template <typename C, typename I, typename J>
+void invoke_range(C& c, I first, J last, size_t w) {
+  invoke_range(c, first, last, w, is_worker_range_callable<C, I, J>{});
+}
+
+// Function: range_size
+// counts the elements of [beg, end), whose ends may differ in type,
+// such as an iterator and a const iterator
+template <typename I, typename J>
+neo::enable_if_t<std::is_integral<I>::value, size_t> range_size(I beg, J end) {
+  I last = static_cast<I>(end);
+  return beg < last ? static_cast<size_t>(last - beg) : 0;
+}
+
+template <typename I, typename J>
+neo::enable_if_t<!std::is_integral<I>::value, size_t> range_size(I beg, J end) {
+  if constexpr(std::is_base_of<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<I>::iterator_category
+  >::value) {
+    return static_cast<size_t>(end - beg);
+  }
+  else {
+    size_t n = 0;
+    for(; beg != end; ++beg) {
+      n++;
+    }
+    return n;
+  }
+}
+
+// Function: locate_tile
+// returns the grid coordinates of the i-th tile of the grid [lo, hi) in the
+// order of recursive bisection, which halves the grid along its longest
+// dimension of more than one tile, measured in elements, and numbers the
+// lower half first;
+// consecutive tiles hence form compact blocks of the grid
+template <size_t D>
+std::array<size_t, D> locate_tile(
+  std::array<size_t, D> lo, std::array<size_t, D> hi,
+  const std::array<size_t, D>& tile, size_t i
+) {
+  while(true) {
+    size_t d = D;
+    for(size_t k=0; k<D; k++) {
+      if(hi[k] - lo[k] > 1 &&
+         (d == D || (hi[k]-lo[k])*tile[k] > (hi[d]-lo[d])*tile[d])) {
+        d = k;
+      }
+    }
+    if(d == D) {
+      return lo;
+    }
+    size_t mid = lo[d] + (hi[d] - lo[d]) / 2;
+    size_t lower = mid - lo[d];
+    for(size_t k=0; k<D; k++) {
+      if(k != d) {
+        lower *= hi[k] - lo[k];
+      }
+    }
+    if(i < lower) {
+      hi[d] = mid;
+    }
+    else {
+      i -= lower;
+      lo[d] = mid;
+    }
+  }
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// multi-dimensional index range
+// ----------------------------------------------------------------------------
+
+/**
+@class IndexRangeND
+
+@brief class to describe a D-dimensional box of indices split into tiles
+
+@tparam T integral index type
+@tparam D number of dimensions
+
+The box spans the indices <tt>[begin(d), end(d))</tt> along each
+dimension @c d with unit step,
+and is split into rectangular tiles of <tt>tile(d)</tt> indices along
+each dimension, where the tiles at the upper boundaries may be smaller.
+tf::FlowBuilder::for_each_index hands each tile of a box to the callable
+as another box, whose tile sizes are those of the parent box.
+
+@code{.cpp}
+// rows [0, 1000) and columns [0, 2000) in tiles of 64x128
+tf::IndexRange2D<int> range({0, 0}, {1000, 2000}, {64, 128});
+@endcode
+*/
+template <typename T, size_t D>
+class IndexRangeND {
+
+  static_assert(std::is_integral<T>::value, "index type must be integral");
+  static_assert(D > 0, "index range must have at least one dimension");
+
+  public:
+
+  /**
+  @brief number of dimensions
+  */
+  static constexpr size_t dimensions = D;
+
+  /**
+  @brief constructs a box of indices
+
+  @param begs beginning index of each dimension (inclusive)
+  @param ends ending index of each dimension (exclusive)
+  @param tiles tile size of each dimension, where zero means the whole dimension
+  */
+  IndexRangeND(
+    const std::array<T, D>& begs,
+    const std::array<T, D>& ends,
+    const std::array<T, D>& tiles
+  ) : _begs {begs}, _ends {ends}, _tiles {tiles} {
+    for(size_t d=0; d<D; d++) {
+      if(_ends[d] < _begs[d]) {
+        _ends[d] = _begs[d];
+      }
+      if(_tiles[d] <= 0) {
+        _tiles[d] = std::max(T(1), static_cast<T>(_ends[d] - _begs[d]));
+      }
+    }
+  }
+
+  /**
+  @brief queries the beginning index of dimension @c d
+  */
+  T begin(size_t d) const { return _begs[d]; }
+
+  /**
+  @brief queries the ending index of dimension @c d
+  */
+  T end(size_t d) const { return _ends[d]; }
+
+  /**
+  @brief queries the tile size of dimension @c d
+  */
+  T tile(size_t d) const { return _tiles[d]; }
+
+  /**
+  @brief queries the number of indices along dimension @c d
+  */
+  size_t size(size_t d) const { return static_cast<size_t>(_ends[d] - _begs[d]); }
+
+  /**
+  @brief queries the number of indices in the box
+  */
+  size_t size() const {
+    size_t n = 1;
+    for(size_t d=0; d<D; d++) {
+      n *= size(d);
+    }
+    return n;
+  }
+
+  /**
+  @brief queries the number of tiles along dimension @c d
+  */
+  size_t num_tiles(size_t d) const {
+    return (size(d) + static_cast<size_t>(_tiles[d]) - 1) / static_cast<size_t>(_tiles[d]);
+  }
+
+  /**
+  @brief queries the number of tiles in the box
+  */
+  size_t num_tiles() const {
+    size_t n = 1;
+    for(size_t d=0; d<D; d++) {
+      n *= num_tiles(d);
+    }
+    return n;
+  }
+
+  /**
+  @brief returns the tile at the given grid coordinates as a box
+  */
+  IndexRangeND tile_at(const std::array<size_t, D>& grid) const {
+    IndexRangeND box(*this);
+    for(size_t d=0; d<D; d++) {
+      box._begs[d] = static_cast<T>(_begs[d] + grid[d] * _tiles[d]);
+      box._ends[d] = static_cast<T>(
+        std::min<size_t>(size(d), (grid[d]+1) * _tiles[d]) + _begs[d]
+      );
+    }
+    return box;
+  }
+
+  private:
+
+  std::array<T, D> _begs;
+  std::array<T, D> _ends;
+  std::array<T, D> _tiles;
+};
+
+/**
+@brief two-dimensional box of indices split into tiles
+*/
+template <typename T>
+using IndexRange2D = IndexRangeND<T, 2>;
+
+/**
+@brief three-dimensional box of indices split into tiles
+*/
+template <typename T>
+using IndexRange3D = IndexRangeND<T, 3>;
+
 // ----------------------------------------------------------------------------
 // default parallel for
 // ----------------------------------------------------------------------------
 
 // Function: for_each
-template <typename B, typename E, typename C>
-Task FlowBuilder::for_each(B beg, E end, C c) {
+template <typename B, typename E, typename C, typename P>
+Task FlowBuilder::for_each(B beg, E end, C c, P part) {
 
   using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
   using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
-  // using namespace std::string_literals;
 
   struct TaskHandler{
       B b;
       E e;
       C c;
-      TaskHandler(B b, E e, C c){
-          this->b = b;
-          this->e = e;
-          this->c = c;
+      P part;
+      TaskHandler(B b, E e, C c, P part) :
+          b {b}, e {e}, c {c}, part {part} {
       }
 
       void operator()(Subflow& sf) {
@@ -40,12 +270,11 @@ Task FlowBuilder::for_each(B beg, E end, C c) {
               return;
           }
 
-          size_t chunk_size = 1;
           size_t W = sf._executor.num_workers();
           size_t N = std::distance(beg, end);
 
           // only myself - no need to spawn another graph
-          if(W <= 1 || N <= chunk_size) {
+          if(W <= 1 || N <= part.chunk_size()) {
               std::for_each(beg, end, c);
               return;
           }
@@ -56,83 +285,29 @@ Task FlowBuilder::for_each(B beg, E end, C c) {
 
           std::atomic<size_t> next(0);
 
-          auto loop = [=, &next] () mutable {
-
-              size_t z = 0;
-              size_t p1 = 2 * W * (chunk_size + 1);
-              double p2 = 0.5 / static_cast<double>(W);
-              size_t s0 = next.load(std::memory_order_relaxed);
-
-              while(s0 < N) {
-
-                  size_t r = N - s0;
-
-                  // fine-grained
-                  if(r < p1) {
-                      while(1) {
-                          s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-                          if(s0 >= N) {
-                              return;
-                          }
-                          size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-                          std::advance(beg, s0-z);
-                          for(size_t x=s0; x<e0; x++) {
-                              c(*beg++);
-                          }
-                          z = e0;
-                      }
-                      break;
+          auto loop = [=, &next] (size_t w) mutable {
+              auto at = detail::make_chunk_cursor(beg);
+              part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+                  auto first = at(s0);
+                  auto last  = at(e0);
+                  for(; first != last; ++first) {
+                      c(*first);
                   }
-                  // coarse-grained
-                  else {
-                      size_t q = static_cast<size_t>(p2 * r);
-                      if(q < chunk_size) {
-                          q = chunk_size;
-                      }
-                      size_t e0 = (q <= r) ? s0 + q : N;
-                      if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                  std::memory_order_relaxed)) {
-                          std::advance(beg, s0-z);
-                          for(size_t x = s0; x< e0; x++) {
-                              c(*beg++);
-                          }
-                          z = e0;
-                          s0 = next.load(std::memory_order_relaxed);
-                      }
-                  }
-              }
+              });
           };
 
-          for(size_t w=0; w<W; w++) {
-              auto r = N - next.load(std::memory_order_relaxed);
-              // no more loop work to do - finished by previous async tasks
-              if(!r) {
-                  break;
-              }
-              // tail optimization
-              if(r <= chunk_size || w == W-1) {
-                  loop(); 
-                  break;
-              }
-              else {
-                  sf._named_silent_async(sf._worker, std::string("loop-") + std::to_string(w), loop);
-              }
-          }
-
-          sf.join();
+          _launch_loop(sf, part, N, W, next, loop);
       }
   };
 
-  Task task = emplace(TaskHandler(beg, end, c));
+  Task task = emplace(TaskHandler(beg, end, c, part));
 
   return task;
 }
 
 // Function: for_each_index
-template <typename B, typename E, typename S, typename C>
-Task FlowBuilder::for_each_index(B beg, E end, S inc, C c){
-
-  // using namespace std::string_literals;
+template <typename B, typename E, typename S, typename C, typename P>
+Task FlowBuilder::for_each_index(B beg, E end, S inc, C c, P part){
 
   using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
   using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
@@ -143,11 +318,9 @@ Task FlowBuilder::for_each_index(B beg, E end, S inc, C c){
       E e;
       S a;
       C c;
-      TaskHandler(B b, E e, S inc, C c){
-          this->b = b;
-          this->e = e;
-          this->a = inc;
-          this->c = c;
+      P part;
+      TaskHandler(B b, E e, S inc, C c, P part) :
+          b {b}, e {e}, a {inc}, c {c}, part {part} {
       }
 
       void operator()(Subflow& sf){
@@ -160,12 +333,11 @@ Task FlowBuilder::for_each_index(B beg, E end, S inc, C c){
               TF_THROW("invalid range [", beg, ", ", end, ") with step size ", inc);
           }
 
-          size_t chunk_size = 1;
           size_t W = sf._executor.num_workers();
           size_t N = distance(beg, end, inc);
 
           // only myself - no need to spawn another graph
-          if(W <= 1 || N <= chunk_size) {
+          if(W <= 1 || N <= part.chunk_size()) {
               for(size_t x=0; x<N; x++, beg+=inc) {
                   c(beg);
               }
@@ -178,77 +350,125 @@ Task FlowBuilder::for_each_index(B beg, E end, S inc, C c){
 
           std::atomic<size_t> next(0);
 
-          auto loop = [=, &next] () mutable {
-
-              size_t p1 = 2 * W * (chunk_size + 1);
-              double p2 = 0.5 / static_cast<double>(W);
-              size_t s0 = next.load(std::memory_order_relaxed);
-
-              while(s0 < N) {
-
-                  size_t r = N - s0;
-
-                  // fine-grained
-                  if(r < p1) {
-                      while(1) {
-                          s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-                          if(s0 >= N) {
-                              return;
-                          }
-                          size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-                          auto s = static_cast<B_t>(s0) * inc + beg;
-                          for(size_t x=s0; x<e0; x++, s+=inc) {
-                              c(s);
-                          }
-                      }
-                      break;
-                  }
-                  // coarse-grained
-                  else {
-                      size_t q = static_cast<size_t>(p2 * r);
-                      if(q < chunk_size) {
-                          q = chunk_size;
-                      }
-                      size_t e0 = (q <= r) ? s0 + q : N;
-                      if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                  std::memory_order_relaxed)) {
-                          auto s = static_cast<B_t>(s0) * inc + beg;
-                          for(size_t x=s0; x<e0; x++, s+= inc) {
-                              c(s);
-                          }
-                          s0 = next.load(std::memory_order_relaxed);
-                      }
+          auto loop = [=, &next] (size_t w) mutable {
+              part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+                  auto s = static_cast<B_t>(s0) * inc + beg;
+                  for(size_t x=s0; x<e0; x++, s+=inc) {
+                      c(s);
                   }
-              }
+              });
           };
 
-          for(size_t w=0; w<W; w++) {
-              auto r = N - next.load(std::memory_order_relaxed);
-              // no more loop work to do - finished by previous async tasks
-              if(!r) {
-                  break;
-              }
-              // tail optimization
-              if(r <= chunk_size || w == W-1) {
-                  loop(); 
-                  break;
-              }
-              else {
-                  sf._named_silent_async(sf._worker, std::string("loop-") + std::to_string(w), loop);
-              }
-          }
+          _launch_loop(sf, part, N, W, next, loop);
+      }
+  };
+
+  Task task = emplace(TaskHandler(beg, end, inc, c, part));
+
+  return task;
+}
 
-          sf.join();
+// Function: for_each_index
+// numbers the tiles of the box in the order of recursive bisection, such
+// that the consecutive tiles of a chunk are close in every dimension
+template <typename R, typename C, typename P>
+Task FlowBuilder::for_each_index(R range, C c, P part) {
+
+  using R_t = neo::decay_t<unwrap_ref_decay_t<R>>;
+
+  Task task = emplace([range, c, part] (Subflow& sf) mutable {
+
+    // fetch the range value
+    R_t box = range;
+
+    constexpr size_t D = R_t::dimensions;
 
+    size_t W = sf._executor.num_workers();
+    size_t N = box.num_tiles();
+
+    if(box.size() == 0) {
+      return;
+    }
+
+    std::array<size_t, D> lo {}, hi, tile;
+    for(size_t d=0; d<D; d++) {
+      hi[d] = box.num_tiles(d);
+      tile[d] = static_cast<size_t>(box.tile(d));
+    }
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= part.chunk_size()) {
+      for(size_t i=0; i<N; i++) {
+        c(box.tile_at(detail::locate_tile(lo, hi, tile, i)));
       }
-  };
+      return;
+    }
 
-  Task task = emplace(TaskHandler(beg, end, inc, c));
+    if(N < W) {
+      W = N;
+    }
+
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next, &box] (size_t w) mutable {
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        for(size_t i=s0; i<e0; i++) {
+          c(box.tile_at(detail::locate_tile(lo, hi, tile, i)));
+        }
+      });
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+  });
 
   return task;
 }
 
-}  // end of namespace tf -----------------------------------------------------
+// Function: for_each_range
+template <typename B, typename E, typename C, typename P>
+Task FlowBuilder::for_each_range(B first, E last, C c, P part) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([first, last, c, part] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
 
+    size_t W = sf._executor.num_workers();
+    size_t N = detail::range_size(beg, end);
 
+    if(N == 0) {
+      return;
+    }
 
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= part.chunk_size()) {
+      detail::invoke_range(c, beg, end, 0);
+      return;
+    }
+
+    if(N < W) {
+      W = N;
+    }
+
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next] (size_t w) mutable {
+      auto at = detail::make_chunk_cursor(beg);
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto chunk_beg = at(s0);
+        auto chunk_end = at(e0);
+        detail::invoke_range(c, chunk_beg, chunk_end, w);
+      });
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "../core/executor.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Class: ChunkCursor
+// locates the position i of the range starting at an iterator (or index) for
+// the chunks that a worker receives; a random-access iterator is offset from
+// the beginning of the range, such that the loop over a chunk depends on no
+// other chunk and can be vectorized, while any other iterator walks on from
+// the position of the previous call, or from the beginning of the range for
+// a chunk before it
+template <typename I,
+  bool = is_random_access_iterator<I>::value || std::is_integral<I>::value
+>
+class ChunkCursor {
+
+  public:
+
+  explicit ChunkCursor(I beg) : _beg {beg}, _itr {beg} {}
+
+  I operator () (size_t i) {
+    if(i < _pos) {
+      _itr = _beg;
+      _pos = 0;
+    }
+    std::advance(_itr, i - _pos);
+    _pos = i;
+    return _itr;
+  }
+
+  private:
+
+  I _beg;
+  I _itr;
+  size_t _pos {0};
+};
+
+template <typename I>
+class ChunkCursor<I, true> {
+
+  public:
+
+  explicit ChunkCursor(I beg) : _beg {beg} {}
+
+  I operator () (size_t i) const {
+    return _beg + static_cast<decltype(_beg - _beg)>(i);
+  }
+
+  private:
+
+  I _beg;
+};
+
+// Function: make_chunk_cursor
+template <typename I>
+ChunkCursor<I> make_chunk_cursor(I beg) {
+  return ChunkCursor<I>(beg);
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// Procedure: _launch_loop
+// runs loop(w) for the workers w in [0, W) that may receive work from the
+// partitioner, spawning all but the last one as silent asyncs of the subflow
+// and running the last one on the calling worker, and joins the subflow;
+// a dynamic partitioner stops spawning once all iterations are claimed
+template <typename P, typename L>
+void FlowBuilder::_launch_loop(
+  Subflow& sf, const P& part, size_t N, size_t W,
+  std::atomic<size_t>& next, L& loop
+) {
+
+  // static chunks beyond the range have no worker to run them
+  if(P::type() == PartitionerType::STATIC && part.chunk_size() != 0) {
+    W = std::min(W, (N + part.chunk_size() - 1) / part.chunk_size());
+  }
+
+  detail::prepare_partitioner(part, N, W);
+
+  for(size_t w=0; w<W; w++) {
+
+    if(P::type() == PartitionerType::DYNAMIC) {
+      size_t s0 = next.load(std::memory_order_relaxed);
+      // no more loop work to do - finished by previous async tasks
+      if(s0 >= N) {
+        break;
+      }
+      // tail optimization
+      if(N - s0 <= part.chunk_size()) {
+        loop(w);
+        break;
+      }
+    }
+
+    if(w == W-1) {
+      loop(w);
+    }
+    else {
+      sf._named_silent_async(
+        sf._worker, TaskName::literal("loop", w), [loop, w] () mutable { loop(w); }
+      );
+    }
+  }
+
+  sf.join();
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "launch.hpp"
+#include "simd.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// ----------------------------------------------------------------------------
+// micro-kernels
+// ----------------------------------------------------------------------------
+
+// Class: GemmShape
+// the register and cache blocking of a micro-kernel over vectors of VB
+// bytes: the kernel accumulates an MR x NR block of C in registers over KC
+// steps, from an MR-row sliver of A (MR x KC) and an NR-column sliver of B
+// (KC x NR) that stays in the L1 cache, and a packed MC x KC block of A
+// stays in the L2 cache, and a packed KC x NC block of B in the L3 cache
+template <typename T, size_t VB>
+struct GemmShape {
+  static constexpr size_t L  = VB == 0 ? 4 : VB / sizeof(T);
+  static constexpr size_t MR = 6;
+  static constexpr size_t NR = 2 * L;
+  static constexpr size_t KC = 16384 / (NR * sizeof(T));
+  static constexpr size_t MC = (131072 / (KC * sizeof(T))) / MR * MR;
+  static constexpr size_t NC = (1048576 / (KC * sizeof(T))) / NR * NR;
+};
+
+#if defined(TF_SIMD_VECTOR_EXTENSIONS)
+
+// Procedure: gemm_kernel
+// stores the product of the packed slivers a (KC x MR, column-major) and
+// b (KC x NR, row-major) of kc steps to the row-major MR x NR block ab,
+// with each row of the block in two vectors of VB bytes; the kernel inlines
+// into the target-specific kernels, which lower the vectors to their
+// instruction sets
+template <typename T, size_t VB>
+__attribute__((always_inline)) inline void gemm_kernel(
+  size_t kc, const T* a, const T* b, T* ab
+) {
+
+  using S = GemmShape<T, VB>;
+  typedef T V __attribute__((vector_size(VB)));
+
+  V c[S::MR][2];
+
+  for(size_t r=0; r<S::MR; r++) {
+    c[r][0] = V{};
+    c[r][1] = V{};
+  }
+
+  for(size_t p=0; p<kc; p++, a+=S::MR, b+=S::NR) {
+    V b0, b1;
+    __builtin_memcpy(&b0, b, VB);
+    __builtin_memcpy(&b1, b + S::L, VB);
+    for(size_t r=0; r<S::MR; r++) {
+      c[r][0] += a[r] * b0;
+      c[r][1] += a[r] * b1;
+    }
+  }
+
+  for(size_t r=0; r<S::MR; r++) {
+    __builtin_memcpy(ab + r*S::NR, &c[r][0], VB);
+    __builtin_memcpy(ab + r*S::NR + S::L, &c[r][1], VB);
+  }
+}
+
+#if defined(TF_SIMD_X86_DISPATCH)
+
+template <typename T>
+__attribute__((target("avx512f")))
+void gemm_kernel_avx512(size_t kc, const T* a, const T* b, T* ab) {
+  gemm_kernel<T, 64>(kc, a, b, ab);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma")))
+void gemm_kernel_avx2(size_t kc, const T* a, const T* b, T* ab) {
+  gemm_kernel<T, 32>(kc, a, b, ab);
+}
+
+#endif
+
+template <typename T>
+void gemm_kernel_sse(size_t kc, const T* a, const T* b, T* ab) {
+  gemm_kernel<T, 16>(kc, a, b, ab);
+}
+
+#endif
+
+// Procedure: gemm_kernel_portable
+// the micro-kernel of compilers without vector extensions, which leaves
+// the vectorization of the rows of the block to the compiler
+template <typename T>
+void gemm_kernel_portable(size_t kc, const T* a, const T* b, T* ab) {
+
+  using S = GemmShape<T, 0>;
+
+  T c[S::MR][S::NR] = {};
+
+  for(size_t p=0; p<kc; p++, a+=S::MR, b+=S::NR) {
+    for(size_t r=0; r<S::MR; r++) {
+      for(size_t j=0; j<S::NR; j++) {
+        c[r][j] += a[r] * b[j];
+      }
+    }
+  }
+
+  for(size_t r=0; r<S::MR; r++) {
+    for(size_t j=0; j<S::NR; j++) {
+      ab[r*S::NR + j] = c[r][j];
+    }
+  }
+}
+
+// Function: gemm_kernel_of
+// returns the micro-kernel over vectors of VB bytes
+template <typename T, size_t VB>
+constexpr auto gemm_kernel_of() {
+#if defined(TF_SIMD_X86_DISPATCH)
+  if constexpr(VB == 64) return &gemm_kernel_avx512<T>;
+  else if constexpr(VB == 32) return &gemm_kernel_avx2<T>;
+  else
+#endif
+#if defined(TF_SIMD_VECTOR_EXTENSIONS)
+  if constexpr(VB == 16) return &gemm_kernel_sse<T>;
+  else
+#endif
+  return &gemm_kernel_portable<T>;
+}
+
+// ----------------------------------------------------------------------------
+// packing
+// ----------------------------------------------------------------------------
+
+// Procedure: gemm_pack_a
+// packs the mc x kc block of the row-major A at a with leading dimension
+// lda into slivers of MR rows, each stored column by column, and pads the
+// last sliver with zeros
+template <typename T, size_t MR>
+void gemm_pack_a(size_t mc, size_t kc, const T* a, size_t lda, T* packed) {
+  for(size_t i=0; i<mc; i+=MR) {
+    size_t mr = std::min(MR, mc - i);
+    for(size_t p=0; p<kc; p++) {
+      for(size_t r=0; r<mr; r++) {
+        packed[r] = a[(i+r)*lda + p];
+      }
+      for(size_t r=mr; r<MR; r++) {
+        packed[r] = T{};
+      }
+      packed += MR;
+    }
+  }
+}
+
+// Procedure: gemm_pack_b
+// packs the kc x nc block of the row-major B at b with leading dimension
+// ldb into slivers of NR columns, each stored row by row, and pads the last
+// sliver with zeros
+template <typename T, size_t NR>
+void gemm_pack_b(size_t kc, size_t nc, const T* b, size_t ldb, T* packed) {
+  for(size_t j=0; j<nc; j+=NR) {
+    size_t nr = std::min(NR, nc - j);
+    for(size_t p=0; p<kc; p++) {
+      const T* row = b + p*ldb + j;
+      for(size_t c=0; c<nr; c++) {
+        packed[c] = row[c];
+      }
+      for(size_t c=nr; c<NR; c++) {
+        packed[c] = T{};
+      }
+      packed += NR;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// macro-tiles
+// ----------------------------------------------------------------------------
+
+// Class: GemmWorkspace
+// the packed blocks of a worker, aligned to cache lines
+template <typename T, size_t VB>
+struct GemmWorkspace {
+
+  using S = GemmShape<T, VB>;
+
+  std::unique_ptr<T[]> storage {new T[S::MC*S::KC + S::KC*S::NC + S::MR*S::NR + 64]};
+
+  T* a  = align(storage.get());
+  T* b  = a + S::MC*S::KC;
+  T* ab = b + S::KC*S::NC;
+
+  static T* align(T* p) {
+    auto x = reinterpret_cast<uintptr_t>(p);
+    return reinterpret_cast<T*>((x + 63) & ~uintptr_t{63});
+  }
+};
+
+// Procedure: gemm_tile
+// computes the macro-tile C[i0, i0+mc) x [j0, j0+nc) of C = A * B, where
+// A is M x K, B is K x N, and C is M x N, all row-major, by packing the
+// blocks of A and B of every KC steps and running the micro-kernel on each
+// MR x NR block of the tile
+template <typename T, size_t VB>
+void gemm_tile(
+  const T* A, const T* B, T* C, size_t K, size_t N,
+  size_t i0, size_t mc, size_t j0, size_t nc, GemmWorkspace<T, VB>& ws
+) {
+
+  using S = GemmShape<T, VB>;
+
+  constexpr auto kernel = gemm_kernel_of<T, VB>();
+
+  for(size_t p0=0; p0<K; p0+=S::KC) {
+
+    size_t kc = std::min(S::KC, K - p0);
+
+    gemm_pack_b<T, S::NR>(kc, nc, B + p0*N + j0, N, ws.b);
+    gemm_pack_a<T, S::MR>(mc, kc, A + i0*K + p0, K, ws.a);
+
+    for(size_t j=0; j<nc; j+=S::NR) {
+      size_t nr = std::min(S::NR, nc - j);
+      for(size_t i=0; i<mc; i+=S::MR) {
+        size_t mr = std::min(S::MR, mc - i);
+        kernel(kc, ws.a + i*kc, ws.b + j*kc, ws.ab);
+        T* c = C + (i0+i)*N + j0 + j;
+        for(size_t r=0; r<mr; r++, c+=N) {
+          const T* ab = ws.ab + r*S::NR;
+          if(p0 == 0) {
+            for(size_t x=0; x<nr; x++) c[x] = ab[x];
+          }
+          else {
+            for(size_t x=0; x<nr; x++) c[x] += ab[x];
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// matmul
+// ----------------------------------------------------------------------------
+
+// Procedure: _matmul
+// splits C into macro-tiles of up to MC rows and NC columns, which the
+// workers claim one at a time, each with its own packed blocks; a small C
+// splits into smaller tiles to keep the workers busy, since packing the
+// blocks of a tile costs little next to its multiplication
+template <typename T, size_t VB>
+void FlowBuilder::_matmul(
+  Subflow& sf, const T* A, const T* B, T* C, size_t M, size_t K, size_t N
+) {
+
+  using S = detail::GemmShape<T, VB>;
+
+  size_t W = sf._executor.num_workers();
+  size_t mc = S::MC;
+  size_t nc = S::NC;
+
+  auto num_tiles = [&] () {
+    return ((M + mc - 1) / mc) * ((N + nc - 1) / nc);
+  };
+
+  while(num_tiles() < 4*W) {
+    if(nc >= mc && nc > 4*S::NR) {
+      nc = (nc / 2 + S::NR - 1) / S::NR * S::NR;
+    }
+    else if(mc > 4*S::MR) {
+      mc = (mc / 2 + S::MR - 1) / S::MR * S::MR;
+    }
+    else {
+      break;
+    }
+  }
+
+  size_t TN = (N + nc - 1) / nc;
+  size_t TT = num_tiles();
+
+  auto tile = [=] (size_t t, detail::GemmWorkspace<T, VB>& ws) {
+    size_t i0 = (t / TN) * mc;
+    size_t j0 = (t % TN) * nc;
+    detail::gemm_tile<T, VB>(
+      A, B, C, K, N, i0, std::min(mc, M - i0), j0, std::min(nc, N - j0), ws
+    );
+  };
+
+  // only myself - no need to spawn another graph
+  if(W <= 1 || TT == 1) {
+    detail::GemmWorkspace<T, VB> ws;
+    for(size_t t=0; t<TT; t++) {
+      tile(t, ws);
+    }
+    return;
+  }
+
+  W = std::min(W, TT);
+
+  std::atomic<size_t> next(0);
+
+  DynamicPartitioner part(1);
+
+  auto loop = [&] (size_t w) {
+    detail::GemmWorkspace<T, VB> ws;
+    part.loop(TT, W, w, next, [&] (size_t s0, size_t e0) {
+      for(size_t t=s0; t<e0; t++) {
+        tile(t, ws);
+      }
+    });
+  };
+
+  _launch_loop(sf, part, TT, W, next, loop);
+}
+
+// Function: matmul
+template <typename T>
+Task FlowBuilder::matmul(
+  const T* A, const T* B, T* C, size_t M, size_t K, size_t N
+) {
+
+  static_assert(
+    std::is_same<T, float>::value || std::is_same<T, double>::value,
+    "matmul supports float and double matrices"
+  );
+
+  Task task = emplace([=] (Subflow& sf) {
+
+    if(M == 0 || N == 0) {
+      return;
+    }
+
+    if(K == 0) {
+      std::fill_n(C, M*N, T{});
+      return;
+    }
+
+    switch(detail::simd_width()) {
+#if defined(TF_SIMD_X86_DISPATCH)
+      case 64:
+        _matmul<T, 64>(sf, A, B, C, M, K, N);
+      break;
+
+      case 32:
+        _matmul<T, 32>(sf, A, B, C, M, K, N);
+      break;
+#endif
+#if defined(TF_SIMD_VECTOR_EXTENSIONS)
+      case 16:
+        _matmul<T, 16>(sf, A, B, C, M, K, N);
+      break;
+#endif
+      default:
+        _matmul<T, 0>(sf, A, B, C, M, K, N);
+      break;
+    }
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
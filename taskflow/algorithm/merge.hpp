@@ -0,0 +1,122 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Function: merge_co_rank
+// returns the number i of elements taken from a[0, n) among the first k
+// elements of the stable merge of a[0, n) and b[0, m), which is the smallest
+// i with b[k-i-1] < a[i]; equivalent elements of a come first
+template <typename A, typename B, typename C>
+size_t merge_co_rank(A a, size_t n, B b, size_t m, size_t k, C& comp) {
+  size_t lo = k > m ? k - m : 0;
+  size_t hi = k < n ? k : n;
+  while(lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    if(comp(b[k-i-1], a[i])) {
+      hi = i;
+    }
+    else {
+      lo = i + 1;
+    }
+  }
+  return lo;
+}
+
+// Procedure: move_merge
+// merges two sorted ranges by moving the elements; std::merge over move
+// iterators would pass rvalues to the comparator, which may move from them
+template <typename A, typename B, typename O, typename C>
+O move_merge(A a0, A a1, B b0, B b1, O out, C& comp) {
+  for(; a0 != a1 && b0 != b1; ++out) {
+    if(comp(*b0, *a0)) {
+      *out = std::move(*b0);
+      ++b0;
+    }
+    else {
+      *out = std::move(*a0);
+      ++a0;
+    }
+  }
+  return std::move(b0, b1, std::move(a0, a1, out));
+}
+
+// Procedure: merge_path
+// writes the output elements [k0, k1) of the stable merge of a[0, n) and
+// b[0, m) to out[k0, k1), independently of the other output elements
+template <typename A, typename B, typename O, typename C>
+void merge_path(
+  A a, size_t n, B b, size_t m, O out, size_t k0, size_t k1, C& comp
+) {
+  size_t i0 = merge_co_rank(a, n, b, m, k0, comp);
+  size_t i1 = merge_co_rank(a, n, b, m, k1, comp);
+  std::merge(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1), out + k0, comp);
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// merge
+// ----------------------------------------------------------------------------
+
+// Function: merge
+template <typename B1, typename E1, typename B2, typename E2, typename O, typename C>
+Task FlowBuilder::merge(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, C comp
+) {
+
+  using B1_t = neo::decay_t<unwrap_ref_decay_t<B1>>;
+  using E1_t = neo::decay_t<unwrap_ref_decay_t<E1>>;
+  using B2_t = neo::decay_t<unwrap_ref_decay_t<B2>>;
+  using E2_t = neo::decay_t<unwrap_ref_decay_t<E2>>;
+  using O_t  = neo::decay_t<unwrap_ref_decay_t<O>>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B1_t beg1 = first1;
+    E1_t end1 = last1;
+    B2_t beg2 = first2;
+    E2_t end2 = last2;
+    O_t  d_beg = d_first;
+
+    size_t n = std::distance(beg1, end1);
+    size_t m = std::distance(beg2, end2);
+    size_t N = n + m;
+
+    // at least a few cache lines of output per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      std::merge(beg1, end1, beg2, end2, d_beg, comp);
+      return;
+    }
+
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next, &comp] (size_t w) {
+      StaticPartitioner().loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        detail::merge_path(beg1, n, beg2, m, d_beg, s0, e0, comp);
+      });
+    };
+
+    _launch_loop(sf, StaticPartitioner(), N, W, next, loop);
+  });
+
+  return task;
+}
+
+// Function: merge
+template <typename B1, typename E1, typename B2, typename E2, typename O>
+Task FlowBuilder::merge(B1 first1, E1 last1, B2 first2, E2 last2, O d_first) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B1>>
+  >::value_type;
+  return merge(first1, last1, first2, last2, d_first, std::less<value_type>{});
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// count
+// ----------------------------------------------------------------------------
+
+// Function: _count_if
+// counts the elements satisfying the predicate in each of the W static
+// blocks [w*N/W, (w+1)*N/W) of the N elements starting at beg, stores the
+// count of the preceding blocks in offsets[w], and returns the total count
+template <typename B, typename UOP>
+size_t FlowBuilder::_count_if(
+  Subflow& sf, B beg, size_t N, size_t W, UOP& predicate,
+  std::vector<size_t>& offsets
+) {
+
+  std::atomic<size_t> next(0);
+
+  offsets.assign(W, 0);
+
+  auto count = [&] (size_t w) {
+    size_t c = 0;
+    auto itr = std::next(beg, w*N/W);
+    for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++, ++itr) {
+      if(predicate(*itr)) {
+        c++;
+      }
+    }
+    offsets[w] = c;
+  };
+
+  _launch_loop(sf, StaticPartitioner(), W, W, next, count);
+
+  size_t total = 0;
+  for(auto& o : offsets) {
+    size_t c = o;
+    o = total;
+    total += c;
+  }
+
+  return total;
+}
+
+// ----------------------------------------------------------------------------
+// copy_if / remove_if
+// ----------------------------------------------------------------------------
+
+// Function: copy_if
+template <typename B, typename E, typename O, typename T, typename UOP>
+Task FlowBuilder::copy_if(B first, E last, O d_first, T& result, UOP predicate) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using O_t = neo::decay_t<unwrap_ref_decay_t<O>>;
+
+  Task task = emplace([b=first, e=last, o=d_first, &r=result, predicate]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+    O_t d_beg = o;
+
+    size_t N = std::distance(beg, end);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::copy_if(beg, end, d_beg, predicate);
+      return;
+    }
+
+    std::vector<size_t> offsets;
+    std::atomic<size_t> next(0);
+
+    size_t K = _count_if(sf, beg, N, W, predicate, offsets);
+
+    auto scatter = [&] (size_t w) {
+      auto itr = std::next(beg, w*N/W);
+      auto out = std::next(d_beg, offsets[w]);
+      for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++, ++itr) {
+        if(predicate(*itr)) {
+          *out = *itr;
+          ++out;
+        }
+      }
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, scatter);
+
+    r = std::next(d_beg, K);
+  });
+
+  return task;
+}
+
+// Function: remove_if
+// moves the kept elements through a buffer, since a worker moving its
+// elements in place may overwrite those that another worker has yet to move
+template <typename B, typename E, typename T, typename UOP>
+Task FlowBuilder::remove_if(B first, E last, T& result, UOP predicate) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using value_type = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([b=first, e=last, &r=result, predicate]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t N = std::distance(beg, end);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::remove_if(beg, end, predicate);
+      return;
+    }
+
+    auto keep = [&predicate] (const value_type& v) { return !predicate(v); };
+
+    std::vector<size_t> offsets;
+    std::atomic<size_t> next(0);
+
+    size_t K = _count_if(sf, beg, N, W, keep, offsets);
+
+    std::vector<value_type> kept(K);
+
+    auto scatter = [&] (size_t w) {
+      auto itr = std::next(beg, w*N/W);
+      auto out = kept.begin() + offsets[w];
+      for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++, ++itr) {
+        if(keep(*itr)) {
+          *out = std::move(*itr);
+          ++out;
+        }
+      }
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, scatter);
+
+    auto move_back = [&] (size_t w) {
+      std::move(
+        kept.begin() + w*K/W, kept.begin() + (w+1)*K/W, std::next(beg, w*K/W)
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, move_back);
+
+    r = std::next(beg, K);
+  });
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// partition
+// ----------------------------------------------------------------------------
+
+// Function: partition
+// swaps the elements in place: with P elements satisfying the predicate,
+// the i-th element of [first, first+P) that does not satisfy it is swapped
+// with the i-th element of [first+P, last) that does, where
+//   1. each worker counts the elements satisfying the predicate in its block
+//   2. the calling worker splits the counts at P into the misplaced elements
+//      below and beyond P of each block and their prefixes
+//   3. each worker locates the first misplaced element beyond P that it
+//      swaps with, before any worker swaps
+//   4. each worker swaps the misplaced elements below P in its block
+//      with those of the same ranks beyond P
+template <typename B, typename E, typename T, typename UOP>
+Task FlowBuilder::partition(B first, E last, T& result, UOP predicate) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([b=first, e=last, &r=result, predicate]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t N = std::distance(beg, end);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::partition(beg, end, predicate);
+      return;
+    }
+
+    std::vector<size_t> offsets;
+    std::atomic<size_t> next(0);
+
+    size_t P = _count_if(sf, beg, N, W, predicate, offsets);
+
+    // misplaced elements below P (lows) and beyond P (highs) of each block,
+    // which come to the same number M in total
+    std::vector<size_t> lows(W), highs(W), lrank(W), hrank(W), starts(W);
+
+    size_t M = 0;
+
+    for(size_t w=0, hs=0; w<W; w++) {
+      size_t s = w*N/W;
+      size_t e = (w+1)*N/W;
+      size_t c = (w+1 < W ? offsets[w+1] : P) - offsets[w];
+      if(e <= P) {
+        lows[w] = (e - s) - c;
+        highs[w] = 0;
+      }
+      else if(s >= P) {
+        lows[w] = 0;
+        highs[w] = c;
+      }
+      // the block straddling P
+      else {
+        size_t cl = std::count_if(std::next(beg, s), std::next(beg, P), predicate);
+        lows[w] = (P - s) - cl;
+        highs[w] = c - cl;
+      }
+      lrank[w] = M;
+      hrank[w] = hs;
+      M += lows[w];
+      hs += highs[w];
+    }
+
+    if(M == 0) {
+      r = std::next(beg, P);
+      return;
+    }
+
+    auto locate = [&] (size_t w) {
+      if(lows[w] == 0) {
+        return;
+      }
+      // the block holding the high of rank lrank[w]
+      size_t j = 0;
+      while(hrank[j] + highs[j] <= lrank[w]) {
+        j++;
+      }
+      size_t x = std::max(j*N/W, P);
+      auto itr = std::next(beg, x);
+      for(size_t skip = lrank[w] - hrank[j];; x++, ++itr) {
+        if(predicate(*itr) && skip-- == 0) {
+          break;
+        }
+      }
+      starts[w] = x;
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, locate);
+
+    auto exchange = [&] (size_t w) {
+      if(lows[w] == 0) {
+        return;
+      }
+      size_t s = w*N/W;
+      size_t e = std::min((w+1)*N/W, P);
+      auto itr = std::next(beg, s);
+      auto high = std::next(beg, starts[w]);
+      for(size_t n = lows[w]; s<e && n; s++, ++itr) {
+        if(predicate(*itr)) {
+          continue;
+        }
+        while(!predicate(*high)) {
+          ++high;
+        }
+        std::iter_swap(itr, high);
+        ++high;
+        --n;
+      }
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, exchange);
+
+    r = std::next(beg, P);
+  });
+
+  return task;
+}
+
+// Function: stable_partition
+// moves the elements through a buffer, where the elements of a block go
+// after those of the preceding blocks in either part
+template <typename B, typename E, typename T, typename UOP>
+Task FlowBuilder::stable_partition(B first, E last, T& result, UOP predicate) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using value_type = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([b=first, e=last, &r=result, predicate]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t N = std::distance(beg, end);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::stable_partition(beg, end, predicate);
+      return;
+    }
+
+    std::vector<size_t> offsets;
+    std::atomic<size_t> next(0);
+
+    size_t P = _count_if(sf, beg, N, W, predicate, offsets);
+
+    std::vector<value_type> buffer(N);
+
+    auto scatter = [&] (size_t w) {
+      auto itr = std::next(beg, w*N/W);
+      auto yes = buffer.begin() + offsets[w];
+      auto no  = buffer.begin() + (P + w*N/W - offsets[w]);
+      for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++, ++itr) {
+        if(predicate(*itr)) {
+          *yes++ = std::move(*itr);
+        }
+        else {
+          *no++ = std::move(*itr);
+        }
+      }
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, scatter);
+
+    auto move_back = [&] (size_t w) {
+      std::move(
+        buffer.begin() + w*N/W, buffer.begin() + (w+1)*N/W, std::next(beg, w*N/W)
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, move_back);
+
+    r = std::next(beg, P);
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
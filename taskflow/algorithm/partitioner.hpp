@@ -0,0 +1,803 @@
+// reference:
+// - gomp: https://github.com/gcc-mirror/gcc/blob/master/libgomp/iter.c
+// - komp: https://github.com/llvm-mirror/openmp/blob/master/runtime/src/kmp_dispatch.cpp
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+/**
+@file partitioner.hpp
+@brief partitioner include file
+*/
+
+namespace tf {
+
+/**
+@enum PartitionerType
+
+@brief enumeration of all partitioner types
+*/
+enum class PartitionerType : int {
+  /** @brief static partitioner type */
+  STATIC,
+  /** @brief dynamic partitioner type */
+  DYNAMIC
+};
+
+// ----------------------------------------------------------------------------
+// Partitioner Base
+// ----------------------------------------------------------------------------
+
+/**
+@class PartitionerBase
+
+@brief class to derive a partitioner for scheduling parallel algorithms
+
+A partitioner splits the iteration space <tt>[0, N)</tt> of a parallel
+algorithm into chunks and decides which worker runs which chunk.
+The class stores the chunk size shared by all partitioners.
+A derived partitioner defines the following members, which the parallel
+algorithms call once per worker with the worker index @c w in
+<tt>[0, W)</tt> and a shared atomic cursor @c next initialized to zero:
+
+@code{.cpp}
+static constexpr PartitionerType type();
+
+template <typename F>
+void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const;
+
+template <typename F>
+void loop_until(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const;
+@endcode
+
+The member function @c loop invokes <tt>func(beg, end)</tt> for every chunk
+<tt>[beg, end)</tt> assigned to the calling worker, in increasing order of
+@c beg, except for tf::AffinityPartitioner, which first hands out the chunks
+that the worker ran in the previous run.
+The member function @c loop_until does the same but stops as soon as
+<tt>func(beg, end)</tt> returns @c true, which lets an algorithm such as
+tf::FlowBuilder::find_if abandon the rest of the range.
+*/
+class PartitionerBase {
+
+  public:
+
+  /**
+  @brief default constructor
+  */
+  PartitionerBase() = default;
+
+  /**
+  @brief construct a partitioner with the given chunk size
+  */
+  explicit PartitionerBase(size_t chunk_size) : _chunk_size {chunk_size} {}
+
+  /**
+  @brief query the chunk size of this partitioner
+  */
+  size_t chunk_size() const { return _chunk_size; }
+
+  /**
+  @brief update the chunk size of this partitioner
+  */
+  void chunk_size(size_t cz) { _chunk_size = cz; }
+
+  protected:
+
+  /**
+  @brief chunk size
+  */
+  size_t _chunk_size {0};
+};
+
+// ----------------------------------------------------------------------------
+// Guided Partitioner
+// ----------------------------------------------------------------------------
+
+/**
+@class GuidedPartitioner
+
+@brief class to construct a guided partitioner for scheduling parallel algorithms
+
+The size of a partition is proportional to the number of unassigned iterations
+divided by the number of workers,
+and the size will gradually decrease to the given chunk size.
+The last partition may be smaller than the chunk size.
+Since the default chunk size is one, the tail of the iteration space
+is claimed one iteration at a time, which balances irregular work well
+but costs one atomic operation per iteration when the work is tiny.
+*/
+class GuidedPartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (dynamic)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::DYNAMIC; }
+
+  /**
+  @brief default constructor
+  */
+  GuidedPartitioner() : PartitionerBase{1} {}
+
+  /**
+  @brief construct a guided partitioner with the given chunk size
+  */
+  explicit GuidedPartitioner(size_t sz) : PartitionerBase (sz) {}
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+    loop_until(N, W, w, next, [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    });
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t W, size_t, std::atomic<size_t>& next, F&& func) const {
+
+    size_t chunk_size = (_chunk_size == 0) ? size_t{1} : _chunk_size;
+
+    size_t p1 = 2 * W * (chunk_size + 1);
+    double p2 = 0.5 / static_cast<double>(W);
+    size_t s0 = next.load(std::memory_order_relaxed);
+
+    while(s0 < N) {
+
+      size_t r = N - s0;
+
+      // fine-grained
+      if(r < p1) {
+        while(1) {
+          s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+          if(s0 >= N) {
+            return;
+          }
+          if(func(s0, (chunk_size <= (N - s0)) ? s0 + chunk_size : N)) {
+            return;
+          }
+        }
+        break;
+      }
+      // coarse-grained
+      else {
+        size_t q = static_cast<size_t>(p2 * r);
+        if(q < chunk_size) {
+          q = chunk_size;
+        }
+        size_t e0 = (q <= r) ? s0 + q : N;
+        if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                std::memory_order_relaxed)) {
+          if(func(s0, e0)) {
+            return;
+          }
+          s0 = next.load(std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+// Dynamic Partitioner
+// ----------------------------------------------------------------------------
+
+/**
+@class DynamicPartitioner
+
+@brief class to construct a dynamic partitioner for scheduling parallel algorithms
+
+The partitioner splits iterations into many partitions each of size equal to
+the given chunk size.
+Different partitions are distributed dynamically to workers
+without any specific order.
+*/
+class DynamicPartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (dynamic)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::DYNAMIC; }
+
+  /**
+  @brief default constructor
+  */
+  DynamicPartitioner() : PartitionerBase{1} {}
+
+  /**
+  @brief construct a dynamic partitioner with the given chunk size
+  */
+  explicit DynamicPartitioner(size_t sz) : PartitionerBase (sz) {}
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+    loop_until(N, W, w, next, [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    });
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t, size_t, std::atomic<size_t>& next, F&& func) const {
+
+    if(N == 0) {
+      return;
+    }
+
+    size_t chunk_size = (_chunk_size == 0) ? size_t{1} : _chunk_size;
+    size_t s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+
+    while(s0 < N) {
+      if(func(s0, (chunk_size <= (N - s0)) ? s0 + chunk_size : N)) {
+        return;
+      }
+      s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+// Static Partitioner
+// ----------------------------------------------------------------------------
+
+/**
+@class StaticPartitioner
+
+@brief class to construct a static partitioner for scheduling parallel algorithms
+
+The partitioner divides iterations into chunks and distributes chunks
+to workers in order.
+If the chunk size is not specified (default @c 0), the partitioner
+divides iterations into chunks that are approximately equal in size,
+one per worker.
+Otherwise, worker @c w runs the chunks <tt>w, w+W, w+2W, ...</tt>
+in a round-robin fashion.
+No atomic operation is involved, which makes the partitioner
+the cheapest one when every iteration costs about the same.
+*/
+class StaticPartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (static)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::STATIC; }
+
+  /**
+  @brief default constructor
+  */
+  StaticPartitioner() : PartitionerBase{0} {}
+
+  /**
+  @brief construct a static partitioner with the given chunk size
+  */
+  explicit StaticPartitioner(size_t sz) : PartitionerBase(sz) {}
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+    loop_until(N, W, w, next, [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    });
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t W, size_t w, std::atomic<size_t>&, F&& func) const {
+
+    // one contiguous chunk per worker
+    if(_chunk_size == 0) {
+      size_t q = N / W;
+      size_t m = N % W;
+      size_t s0 = w * q + std::min(w, m);
+      size_t e0 = s0 + q + (w < m ? 1 : 0);
+      if(s0 < e0) {
+        func(s0, e0);
+      }
+      return;
+    }
+
+    // round-robin chunks
+    for(size_t s0 = w * _chunk_size; s0 < N; s0 += W * _chunk_size) {
+      if(func(s0, (_chunk_size <= (N - s0)) ? s0 + _chunk_size : N)) {
+        return;
+      }
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+// Adaptive Partitioner
+// ----------------------------------------------------------------------------
+
+/**
+@class AdaptivePartitioner
+
+@brief class to construct an adaptive partitioner for scheduling parallel algorithms
+
+The partitioner times every chunk it runs and tunes the chunk size
+of each worker toward a target duration per chunk (default 50 microseconds).
+A worker starts from the given chunk size and doubles it while chunks
+finish faster than half of the target, and halves it,
+down to the given chunk size, when chunks take longer than twice the target.
+Like tf::GuidedPartitioner, a chunk never exceeds the number of
+unassigned iterations divided by twice the number of workers,
+such that the tail of the iteration space stays balanced.
+The partitioner suits loops whose per-iteration cost is unknown
+or varies across inputs: cheap iterations end up in large chunks that
+amortize the scheduling overhead, and expensive iterations end up
+in small chunks that keep all workers busy.
+*/
+class AdaptivePartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (dynamic)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::DYNAMIC; }
+
+  /**
+  @brief default constructor
+  */
+  AdaptivePartitioner() : PartitionerBase{1} {}
+
+  /**
+  @brief construct an adaptive partitioner with the given minimum chunk size
+         and target duration per chunk
+  */
+  explicit AdaptivePartitioner(
+    size_t sz,
+    std::chrono::nanoseconds target = std::chrono::microseconds(50)
+  ) :
+    PartitionerBase(sz), _target {target} {
+  }
+
+  /**
+  @brief queries the target duration per chunk
+  */
+  std::chrono::nanoseconds target() const { return _target; }
+
+  /**
+  @brief updates the target duration per chunk
+  */
+  void target(std::chrono::nanoseconds target) { _target = target; }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+    loop_until(N, W, w, next, [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    });
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t W, size_t, std::atomic<size_t>& next, F&& func) const {
+
+    using clock = std::chrono::steady_clock;
+
+    size_t min_chunk = (_chunk_size == 0) ? size_t{1} : _chunk_size;
+    size_t chunk = min_chunk;
+
+    size_t s0 = next.load(std::memory_order_relaxed);
+
+    while(s0 < N) {
+
+      size_t q = std::max(min_chunk, std::min(chunk, (N - s0) / (2 * W)));
+      size_t e0 = (q <= N - s0) ? s0 + q : N;
+
+      if(!next.compare_exchange_weak(s0, e0, std::memory_order_relaxed,
+                                             std::memory_order_relaxed)) {
+        continue;
+      }
+
+      auto beg = clock::now();
+      if(func(s0, e0)) {
+        return;
+      }
+      auto span = clock::now() - beg;
+
+      // grow only after a full-size chunk so the tail cap does not
+      // shrink the measurement
+      if(span * 2 < _target) {
+        if(q == chunk) {
+          chunk *= 2;
+        }
+      }
+      else if(span > _target * 2 && chunk > min_chunk) {
+        chunk = std::max(min_chunk, chunk / 2);
+      }
+
+      s0 = next.load(std::memory_order_relaxed);
+    }
+  }
+
+  private:
+
+  std::chrono::nanoseconds _target {std::chrono::microseconds(50)};
+};
+
+// ----------------------------------------------------------------------------
+// Deterministic Partitioner
+// ----------------------------------------------------------------------------
+
+/**
+@class DeterministicPartitioner
+
+@brief class to construct a deterministic partitioner for scheduling parallel algorithms
+
+The partitioner makes tf::FlowBuilder::reduce and
+tf::FlowBuilder::transform_reduce reproducible from run to run.
+It splits the range into fixed chunks whose boundaries depend only on
+the number of elements and the chunk size, reduces every chunk separately,
+and combines the partial results in a fixed pairwise tree order,
+such that the order of the binary operations,
+and hence the rounding of a floating-point sum,
+is independent of the scheduling and of the number of workers.
+A chunk has at least two elements, and the last chunk takes the remainder.
+If the chunk size is not specified (default @c 0),
+the range is split into about 1024 chunks.
+
+@code{.cpp}
+double sum = 0.0;
+taskflow.reduce(data.begin(), data.end(), sum, std::plus<double>(),
+  tf::DeterministicPartitioner()
+);
+@endcode
+
+Other algorithms schedule the fixed chunks like tf::DynamicPartitioner.
+*/
+class DeterministicPartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (dynamic)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::DYNAMIC; }
+
+  /**
+  @brief default constructor
+  */
+  DeterministicPartitioner() : PartitionerBase{0} {}
+
+  /**
+  @brief construct a deterministic partitioner with the given chunk size
+  */
+  explicit DeterministicPartitioner(size_t sz) : PartitionerBase (sz) {}
+
+  /**
+  @brief queries the size of the chunks for a range of @c N elements
+  */
+  size_t adjusted_chunk_size(size_t N) const {
+    return std::max(size_t{2}, _chunk_size ? _chunk_size : N / 1024);
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+    loop_until(N, W, w, next, [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    });
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t, size_t, std::atomic<size_t>& next, F&& func) const {
+
+    if(N == 0) {
+      return;
+    }
+
+    size_t chunk_size = adjusted_chunk_size(N);
+    size_t E = std::max(size_t{1}, N / chunk_size) * chunk_size;
+
+    // the last chunk also takes the remainder of the range
+    size_t s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+
+    while(s0 < E) {
+      if(func(s0, (s0 + chunk_size == E) ? N : s0 + chunk_size)) {
+        return;
+      }
+      s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+// Affinity Partitioner
+// ----------------------------------------------------------------------------
+
+namespace detail {
+
+// Struct: AffinityChunk
+// the run that last claimed the chunk and the thread that ran it
+struct AffinityChunk {
+  std::atomic<size_t> run {0};
+  std::atomic<size_t> owner {0};
+};
+
+// Struct: AffinityRecord
+// the chunks of the loop, shared by all copies of an affinity partitioner
+struct AffinityRecord {
+  size_t N {0};
+  size_t chunk_size {0};
+  size_t num_chunks {0};
+  size_t run {0};
+  std::unique_ptr<AffinityChunk[]> chunks;
+};
+
+}  // end of namespace detail -------------------------------------------------
+
+/**
+@class AffinityPartitioner
+
+@brief class to construct an affinity partitioner for scheduling parallel algorithms
+
+The partitioner suits a parallel loop that runs many times over the same data,
+such as a sweep of an iterative solver, whose chunks stay
+in the caches of the workers that ran them.
+It divides iterations into chunks of the given chunk size,
+or into four chunks per worker if the chunk size is zero (default),
+and records the worker thread that runs each chunk.
+In the next run of the loop, a worker first runs the chunks it ran
+in the previous run, which are likely still in its cache,
+and then steals the chunks that no other worker has claimed yet,
+starting from a different part of the range than the other workers,
+such that a late or slow worker does not hold up the loop.
+
+Copies of an affinity partitioner share the same record.
+Passing one partitioner to several loops over the same data,
+such as the sweeps of a Jacobi solver that alternate their input and output
+arrays, assigns the same chunks to the same workers in all of them.
+The record starts over whenever the number of iterations or chunks changes.
+Loops that share a partitioner must not run at the same time.
+
+@code{.cpp}
+tf::AffinityPartitioner part;
+for(int s=0; s<sweeps; s++) {
+  tf::Task sweep = taskflow.for_each_index(1, N-1, 1, [=](int i){
+    // update row i of out from in
+  }, part);
+}
+@endcode
+
+@attention
+Parallel algorithms that share an affinity partitioner must not run
+at the same time.
+*/
+class AffinityPartitioner : public PartitionerBase {
+
+  public:
+
+  /**
+  @brief queries the partition type (dynamic)
+  */
+  static constexpr PartitionerType type() { return PartitionerType::DYNAMIC; }
+
+  /**
+  @brief default constructor
+  */
+  AffinityPartitioner() : PartitionerBase{0} {}
+
+  /**
+  @brief construct an affinity partitioner with the given chunk size
+  */
+  explicit AffinityPartitioner(size_t sz) : PartitionerBase(sz) {}
+
+  /**
+  @private
+  */
+  void prepare(size_t N, size_t W) const {
+
+    auto& r = *_record;
+
+    size_t chunk_size = (_chunk_size == 0) ? (N + 4*W - 1) / (4*W) : _chunk_size;
+    chunk_size = std::max(chunk_size, size_t{1});
+
+    size_t num_chunks = (N + chunk_size - 1) / chunk_size;
+
+    if(r.N != N || r.chunk_size != chunk_size) {
+      r.N = N;
+      r.chunk_size = chunk_size;
+      r.num_chunks = num_chunks;
+      r.run = 0;
+      r.chunks.reset(new detail::AffinityChunk[num_chunks]);
+    }
+
+    r.run++;
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop(size_t N, size_t W, size_t w, std::atomic<size_t>& next, F&& func) const {
+
+    auto& r = *_record;
+
+    // not prepared for this range
+    if(r.N != N) {
+      _loop_unrecorded(N, W, next, [&func] (size_t s0, size_t e0) {
+        func(s0, e0);
+        return false;
+      });
+      return;
+    }
+
+    size_t me = _this_owner();
+    size_t C = r.num_chunks;
+
+    auto body = [&func] (size_t s0, size_t e0) {
+      func(s0, e0);
+      return false;
+    };
+
+    // chunks run by the calling thread in the previous run
+    for(size_t c=0; c<C; c++) {
+      if(r.chunks[c].owner.load(std::memory_order_relaxed) == me && _claim(c)) {
+        _run(c, me, next, body);
+      }
+    }
+
+    // chunks left over by the other threads, from the w-th of W parts
+    for(size_t k=0, c=w*C/W; k<C; k++, c = (c+1 == C) ? 0 : c+1) {
+      if(next.load(std::memory_order_relaxed) >= N) {
+        return;
+      }
+      if(_claim(c)) {
+        _run(c, me, next, body);
+      }
+    }
+  }
+
+  /**
+  @private
+  */
+  template <typename F>
+  void loop_until(size_t N, size_t W, size_t, std::atomic<size_t>& next, F&& func) const {
+
+    auto& r = *_record;
+
+    // not prepared for this range
+    if(r.N != N) {
+      _loop_unrecorded(N, W, next, func);
+      return;
+    }
+
+    size_t me = _this_owner();
+
+    // an early stop needs the chunks in increasing order
+    for(size_t c=0; c<r.num_chunks; c++) {
+      if(_claim(c) && _run(c, me, next, func)) {
+        return;
+      }
+    }
+  }
+
+  private:
+
+  std::shared_ptr<detail::AffinityRecord> _record {
+    std::make_shared<detail::AffinityRecord>()
+  };
+
+  static size_t _this_owner() {
+    size_t h = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return h == 0 ? 1 : h;
+  }
+
+  bool _claim(size_t c) const {
+    auto& run = _record->chunks[c].run;
+    size_t r = _record->run;
+    return run.load(std::memory_order_relaxed) != r &&
+           run.exchange(r, std::memory_order_relaxed) != r;
+  }
+
+  // claims the chunks in increasing order like tf::DynamicPartitioner,
+  // without recording their workers, for a range the record was not
+  // prepared for, such as that of a loop which does not prepare the
+  // partitioner or which shares it with a loop over another range
+  template <typename F>
+  void _loop_unrecorded(size_t N, size_t W, std::atomic<size_t>& next, F&& func) const {
+
+    size_t chunk_size = (_chunk_size == 0) ? (N + 4*W - 1) / (4*W) : _chunk_size;
+    chunk_size = std::max(chunk_size, size_t{1});
+
+    size_t s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+
+    while(s0 < N) {
+      if(func(s0, std::min(N, s0 + chunk_size))) {
+        return;
+      }
+      s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+    }
+  }
+
+  template <typename F>
+  bool _run(size_t c, size_t me, std::atomic<size_t>& next, F&& func) const {
+    auto& r = *_record;
+    size_t s0 = c * r.chunk_size;
+    size_t e0 = std::min(r.N, s0 + r.chunk_size);
+    r.chunks[c].owner.store(me, std::memory_order_relaxed);
+    next.fetch_add(e0 - s0, std::memory_order_relaxed);
+    return func(s0, e0);
+  }
+};
+
+namespace detail {
+
+// Procedure: prepare_partitioner
+// sets up a partitioner for the coming run of a loop before any worker
+// enters it, which only the affinity partitioner needs
+template <typename P>
+void prepare_partitioner(const P&, size_t, size_t) {
+}
+
+inline void prepare_partitioner(const AffinityPartitioner& part, size_t N, size_t W) {
+  part.prepare(N, W);
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+/**
+@brief default partitioner set to tf::GuidedPartitioner
+
+Guided partitioner can achieve decent performance for most parallel algorithms,
+especially for those with irregular and unbalanced workload per iteration.
+*/
+using DefaultPartitioner = GuidedPartitioner;
+
+/**
+@brief determines if a type is a partitioner
+
+A partitioner is a derived type from tf::PartitionerBase.
+*/
+template <typename P>
+struct is_partitioner : std::is_base_of<PartitionerBase, P> {};
+
+/**
+@brief determines if a partitioner fixes the order of a reduction
+*/
+template <typename P>
+struct is_deterministic_partitioner : std::is_same<P, DeterministicPartitioner> {};
+
+}  // end of namespace tf -----------------------------------------------------
@@ -948,7 +948,7 @@ void Pipeline<Ps...>::_build() {
           goto pipeline;
         }
       }
-    }).name(std::string("rt-") + std::to_string(l));
+    }).name(TaskName::literal("rt", l));
 
     _tasks[0].precede(_tasks[l+1]);
   }
@@ -1551,7 +1551,7 @@ void ScalablePipeline<P>::_build() {
           goto pipeline;
         }
       }
-    }).name(std::string("rt-") + std::to_string(l));
+    }).name(TaskName::literal("rt", l));
 
     _tasks[0].precede(_tasks[l+1]);
   }
@@ -1,21 +1,344 @@
 #pragma once
 
-#include "../core/executor.hpp"
+#include "launch.hpp"
+#include "simd.hpp"
 
 namespace tf {
 
+namespace detail {
+
+// Procedure: reduce_tree
+// combines the optional partial results slot(0), ..., slot(n-1) pairwise
+// in a fixed tree order into slot(0), skipping empty slots
+template <typename S, typename C>
+void reduce_tree(size_t n, S&& slot, C&& combine) {
+  for(size_t s=1; s<n; s*=2) {
+    for(size_t i=0; i+s<n; i+=2*s) {
+      auto& a = slot(i);
+      auto& b = slot(i+s);
+      if(!b) {
+        continue;
+      }
+      if(!a) {
+        a = std::move(b);
+      }
+      else {
+        combine(*a, *b);
+      }
+      b.reset();
+    }
+  }
+}
+
+// Class: HistogramBins
+// private bins of a worker counting the elements of each key, where an
+// entry of a shard is the key of an element
+template <typename T>
+class HistogramBins {
+
+  public:
+
+  using entry_type = size_t;
+
+  explicit HistogramBins(size_t K) : _bins(K, T(0)) {}
+
+  template <typename X>
+  void add(size_t k, X&&) { ++_bins[k]; }
+
+  template <typename R>
+  void merge(R& result, size_t k) { result[k] += _bins[k]; }
+
+  template <typename X>
+  entry_type entry(size_t k, X&&) { return k; }
+
+  template <typename R>
+  void apply(R& result, entry_type k) { ++result[k]; }
+
+  template <typename R, typename X>
+  void apply(R& result, size_t k, X&&) { ++result[k]; }
+
+  private:
+
+  std::vector<T> _bins;
+};
+
+// Class: ReduceBins
+// private bins of a worker reducing the transformed elements of each key,
+// where a bin stays empty until its first element, and an entry of a shard
+// is the key of an element with the transformed element
+template <typename T, typename BOP, typename UOP>
+class ReduceBins {
+
+  public:
+
+  using entry_type = std::pair<size_t, T>;
+
+  ReduceBins(size_t K, BOP& bop, UOP& uop) : _bins(K), _bop{&bop}, _uop{&uop} {}
+
+  template <typename X>
+  void add(size_t k, X&& x) {
+    auto& bin = _bins[k];
+    if(bin) {
+      *bin = (*_bop)(std::move(*bin), (*_uop)(x));
+    }
+    else {
+      bin.emplace((*_uop)(x));
+    }
+  }
+
+  template <typename R>
+  void merge(R& result, size_t k) {
+    if(_bins[k]) {
+      result[k] = (*_bop)(std::move(result[k]), std::move(*_bins[k]));
+    }
+  }
+
+  template <typename X>
+  entry_type entry(size_t k, X&& x) { return entry_type(k, (*_uop)(x)); }
+
+  template <typename R>
+  void apply(R& result, entry_type& e) {
+    result[e.first] = (*_bop)(std::move(result[e.first]), std::move(e.second));
+  }
+
+  template <typename R, typename X>
+  void apply(R& result, size_t k, X&& x) {
+    result[k] = (*_bop)(std::move(result[k]), (*_uop)(x));
+  }
+
+  private:
+
+  std::vector<absl::optional<T>> _bins;
+  BOP* _bop;
+  UOP* _uop;
+};
+
+// ----------------------------------------------------------------------------
+// vectorized reduction
+// ----------------------------------------------------------------------------
+
+// Struct: is_contiguous_arithmetic_iterator
+// an iterator to arithmetic elements stored one after another in memory,
+// a pointer or an iterator of std::vector other than std::vector<bool>
+template <typename I>
+struct is_contiguous_arithmetic_iterator {
+  using value_type = typename std::iterator_traits<I>::value_type;
+  static constexpr bool value =
+    std::is_arithmetic<value_type>::value &&
+    !std::is_same<value_type, bool>::value && (
+      std::is_pointer<I>::value ||
+      std::is_same<I, typename std::vector<value_type>::iterator>::value ||
+      std::is_same<I, typename std::vector<value_type>::const_iterator>::value
+    );
+};
+
+// Struct: simd_operator
+// a binary operator over T whose reduction the vectorized kernel computes,
+// together with its identity
+template <typename BOP, typename T>
+struct simd_operator : std::false_type {};
+
+// negative zero is the identity of floating-point addition, which keeps
+// the sign of a sum of negative zeros
+template <typename T>
+struct simd_operator<std::plus<T>, T> : std::true_type {
+  static T identity() { return -T(0); }
+};
+
+template <typename T>
+struct simd_operator<std::plus<>, T> : std::true_type {
+  static T identity() { return -T(0); }
+};
+
+template <typename T>
+struct simd_operator<std::multiplies<T>, T> : std::true_type {
+  static T identity() { return T(1); }
+};
+
+template <typename T>
+struct simd_operator<std::multiplies<>, T> : std::true_type {
+  static T identity() { return T(1); }
+};
+
+// Struct: is_simd_reduction
+// a reduction of the elements of a contiguous arithmetic iterator I,
+// transformed to T, under one of the operators of simd_operator
+template <typename I, typename T, typename BOP>
+struct is_simd_reduction {
+  static constexpr bool value =
+    is_contiguous_arithmetic_iterator<I>::value &&
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    simd_operator<BOP, T>::value;
+};
+
+// Function: simd_reduce_kernel
+// reduces the n transformed elements at p into 128 bytes of independent
+// accumulators, which the compiler maps to the lanes of two to eight vector
+// registers of the target, such that neither the order of the operator
+// in each accumulator nor the latency of one vector operation holds back
+// the next one; the accumulators are combined pairwise at the end
+template <typename T, typename X, typename BOP, typename UOP>
+TF_FORCE_INLINE T simd_reduce_kernel(X* p, size_t n, BOP& bop, UOP& uop) {
+
+  constexpr size_t L = 128 / sizeof(T);
+
+  T acc[L];
+
+  for(size_t k=0; k<L; k++) {
+    acc[k] = simd_operator<BOP, T>::identity();
+  }
+
+  size_t i = 0;
+
+  for(; i+L<=n; i+=L) {
+    for(size_t k=0; k<L; k++) {
+      acc[k] = bop(acc[k], static_cast<T>(uop(p[i+k])));
+    }
+  }
+
+  for(size_t k=0; i<n; i++, k++) {
+    acc[k] = bop(acc[k], static_cast<T>(uop(p[i])));
+  }
+
+  for(size_t s=L/2; s>0; s/=2) {
+    for(size_t k=0; k<s; k++) {
+      acc[k] = bop(acc[k], acc[k+s]);
+    }
+  }
+
+  return acc[0];
+}
+
+#if defined(TF_SIMD_X86_DISPATCH)
+
+template <typename T, typename X, typename BOP, typename UOP>
+__attribute__((target("avx512f"))) TF_SIMD_NO_CONTRACT
+T simd_reduce_avx512(X* p, size_t n, BOP& bop, UOP& uop) {
+  return simd_reduce_kernel<T>(p, n, bop, uop);
+}
+
+template <typename T, typename X, typename BOP, typename UOP>
+__attribute__((target("avx2,fma"))) TF_SIMD_NO_CONTRACT
+T simd_reduce_avx2(X* p, size_t n, BOP& bop, UOP& uop) {
+  return simd_reduce_kernel<T>(p, n, bop, uop);
+}
+
+#endif
+
+// Function: simd_reduce
+// reduces the n transformed elements at p with the kernel of the widest
+// instruction set of the running processor; no kernel contracts a transform
+// into the sum, such that every kernel gives the same bits
+template <typename T, typename X, typename BOP, typename UOP>
+TF_SIMD_NO_CONTRACT
+T simd_reduce(X* p, size_t n, BOP& bop, UOP& uop) {
+#if defined(TF_SIMD_X86_DISPATCH)
+  switch(simd_width()) {
+    case 64:
+      return simd_reduce_avx512<T>(p, n, bop, uop);
+
+    case 32:
+      return simd_reduce_avx2<T>(p, n, bop, uop);
+
+    default:
+    break;
+  }
+#endif
+  return simd_reduce_kernel<T>(p, n, bop, uop);
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// vectorized reduction
+// ----------------------------------------------------------------------------
+
+// Procedure: _simd_reduce
+// reduces the N transformed elements at first into r with the vectorized
+// kernel, which starts every chunk from the identity of the operator:
+//   1. with the deterministic partitioner, each fixed chunk is reduced
+//      on its own, and the chunks are combined in a fixed tree order
+//   2. otherwise, each worker reduces its chunks into one partial result,
+//      and the partial results are combined in the order of the workers
+template <typename T, typename X, typename BOP, typename UOP, typename P>
+void FlowBuilder::_simd_reduce(
+  Subflow& sf, X* first, size_t N, T& r, BOP& bop, UOP& uop, P& part
+) {
+
+  size_t W = sf._executor.num_workers();
+
+  // fixed chunks combined in a fixed order, whatever the number of workers
+  if(is_deterministic_partitioner<P>::value) {
+
+    DeterministicPartitioner fixed(part.chunk_size());
+
+    size_t chunk_size = fixed.adjusted_chunk_size(N);
+    size_t C = std::max(size_t{1}, N / chunk_size);
+
+    std::vector<absl::optional<T>> partials(C);
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next, &partials, &bop, &uop] (size_t w) mutable {
+      fixed.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        partials[s0 / chunk_size] = detail::simd_reduce<T>(
+          first + s0, e0 - s0, bop, uop
+        );
+      });
+    };
+
+    _launch_loop(sf, fixed, N, std::min(W, C), next, loop);
+
+    detail::reduce_tree(C, [&] (size_t i) -> absl::optional<T>& {
+      return partials[i];
+    }, [&bop] (T& a, T& b) { a = bop(a, b); });
+
+    r = bop(r, *partials[0]);
+    return;
+  }
+
+  // only myself - no need to spawn another graph
+  if(W <= 1 || N <= part.chunk_size()) {
+    r = bop(r, detail::simd_reduce<T>(first, N, bop, uop));
+    return;
+  }
+
+  if(N < W) {
+    W = N;
+  }
+
+  // a worker without chunks leaves the identity
+  std::vector<CachelineAligned<T>> partials(W);
+  for(auto& partial : partials) {
+    partial.data = detail::simd_operator<BOP, T>::identity();
+  }
+
+  std::atomic<size_t> next(0);
+
+  auto loop = [=, &next, &partials, &bop, &uop] (size_t w) mutable {
+    T sum = detail::simd_operator<BOP, T>::identity();
+    part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+      sum = bop(sum, detail::simd_reduce<T>(first + s0, e0 - s0, bop, uop));
+    });
+    partials[w].data = sum;
+  };
+
+  _launch_loop(sf, part, N, W, next, loop);
+
+  for(auto& partial : partials) {
+    r = bop(r, partial.data);
+  }
+}
+
 // ----------------------------------------------------------------------------
 // default reduction
 // ----------------------------------------------------------------------------
 
-template <typename B, typename E, typename T, typename O>
-Task FlowBuilder::reduce(B beg, E end, T& init, O bop) {
+template <typename B, typename E, typename T, typename O, typename P>
+Task FlowBuilder::reduce(B beg, E end, T& init, O bop, P part) {
 
   using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
   using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
-  using namespace std::string_literals;
-
-  Task task = emplace([b=beg, e=end, &r=init, bop] (Subflow& sf) mutable {
+  Task task = emplace([b=beg, e=end, &r=init, bop, part] (Subflow& sf) mutable {
 
     // fetch the iterator values
     B_t beg = b;
@@ -25,118 +348,129 @@ Task FlowBuilder::reduce(B beg, E end, T& init, O bop) {
       return;
     }
 
-    //size_t C = (c == 0) ? 1 : c;
-    size_t chunk_size = 1;
     size_t W = sf._executor.num_workers();
     size_t N = std::distance(beg, end);
 
-    // only myself - no need to spawn another graph
-    if(W <= 1 || N <= chunk_size) {
-      for(; beg!=end; r = bop(r, *beg++));
+    // arithmetic sums and products run through the vectorized kernel
+    if constexpr(detail::is_simd_reduction<B_t, T, O>::value &&
+                 std::is_same<typename std::iterator_traits<B_t>::value_type, T>::value) {
+      auto identity = [] (const T& x) { return x; };
+      _simd_reduce(sf, &*beg, N, r, bop, identity, part);
       return;
     }
 
-    if(N < W) {
-      W = N;
-    }
-
-    std::mutex mutex;
-    std::atomic<size_t> next(0);
-      
-    auto loop = [=, &mutex, &next, &r] () mutable {
+    auto combine = [&bop] (T& a, T& b) { a = bop(a, b); };
 
-      size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
+    // fixed chunks combined in a fixed order, whatever the number of workers
+    if(is_deterministic_partitioner<P>::value) {
 
-      if(s0 >= N) {
+      if(N == 1) {
+        r = bop(r, *beg);
         return;
       }
 
-      std::advance(beg, s0);
+      DeterministicPartitioner fixed(part.chunk_size());
 
-      if(N - s0 == 1) {
-        std::lock_guard<std::mutex> lock(mutex);
-        r = bop(r, *beg);
-        return;
-      }
+      size_t chunk_size = fixed.adjusted_chunk_size(N);
+      size_t C = std::max(size_t{1}, N / chunk_size);
 
-      auto beg1 = beg++;
-      auto beg2 = beg++;
+      std::vector<absl::optional<T>> partials(C);
+      std::atomic<size_t> next(0);
 
-      T sum = bop(*beg1, *beg2);
+      auto loop = [=, &next, &partials] (size_t w) mutable {
+        auto at = detail::make_chunk_cursor(beg);
+        fixed.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+          auto first = at(s0);
+          auto last  = at(e0);
+          auto beg1 = first++;
+          auto beg2 = first++;
+          T sum = bop(*beg1, *beg2);
+          for(; first != last; ++first) {
+            sum = bop(sum, *first);
+          }
+          partials[s0 / chunk_size] = std::move(sum);
+        });
+      };
 
-      size_t z = s0 + 2;
-      size_t p1 = 2 * W * (chunk_size + 1);
-      double p2 = 0.5 / static_cast<double>(W);
-      s0 = next.load(std::memory_order_relaxed);
+      _launch_loop(sf, fixed, N, std::min(W, C), next, loop);
 
-      while(s0 < N) {
+      detail::reduce_tree(C, [&] (size_t i) -> absl::optional<T>& {
+        return partials[i];
+      }, combine);
 
-        size_t r = N - s0;
+      r = bop(r, *partials[0]);
+      return;
+    }
 
-        // fine-grained
-        if(r < p1) {
-          while(1) {
-            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-            if(s0 >= N) {
-              break;
-            }
-            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-            std::advance(beg, s0-z);
-            for(size_t x=s0; x<e0; x++, beg++) {
-              sum = bop(sum, *beg);
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= part.chunk_size()) {
+      for(; beg!=end; r = bop(r, *beg++));
+      return;
+    }
+
+    if(N < W) {
+      W = N;
+    }
+
+    // the partial sum of each worker, or its only element if it got one
+    struct Partial {
+      absl::optional<T> sum;
+      absl::optional<B_t> head;
+    };
+
+    std::vector<CachelineAligned<Partial>> partials(W);
+    std::atomic<size_t> next(0);
+
+    auto loop = [=, &next, &partials] (size_t w) mutable {
+
+      // the head element of a worker waits for a second one
+      // to initialize the partial sum
+      auto at = detail::make_chunk_cursor(beg);
+      B_t head = beg;
+      bool has_head = false;
+      absl::optional<T> sum;
+
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto first = at(s0);
+        auto last  = at(e0);
+        if(!sum) {
+          if(!has_head) {
+            head = first++;
+            has_head = true;
+            if(first == last) {
+              return;
             }
-            z = e0;
           }
-          break;
+          sum.emplace(bop(*head, *first++));
         }
-        // coarse-grained
-        else {
-          size_t q = static_cast<size_t>(p2 * r);
-          if(q < chunk_size) {
-            q = chunk_size;
-          }
-          size_t e0 = (q <= r) ? s0 + q : N;
-          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                  std::memory_order_relaxed)) {
-            std::advance(beg, s0-z);
-            for(size_t x = s0; x<e0; x++, beg++) {
-              sum = bop(sum, *beg);
-            }
-            z = e0;
-            s0 = next.load(std::memory_order_relaxed);
-          }
+        for(; first != last; ++first) {
+          *sum = bop(*sum, *first);
         }
-      }
+      });
 
-      std::lock_guard<std::mutex> lock(mutex);
-      r = bop(r, sum);
-    };
-
-    for(size_t w=0; w<W; w++) {
-
-      //if(w*2 >= N) {
-      //  break;
-      //}
-      //sf._named_silent_async(
-      //  sf._worker, "part-"s + std::to_string(w), loop
-      //);
-      
-      auto r = N - next.load(std::memory_order_relaxed);
-      // no more loop work to do - finished by previous async tasks
-      if(!r) {
-        break;
+      if(sum) {
+        partials[w].data.sum = std::move(sum);
       }
-      // tail optimization
-      if(r <= chunk_size || w == W-1) {
-        loop(); 
-        break;
-      }
-      else {
-        sf._named_silent_async(sf._worker, "loop-"s + std::to_string(w), loop);
+      else if(has_head) {
+        partials[w].data.head = head;
       }
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+
+    detail::reduce_tree(W, [&] (size_t i) -> absl::optional<T>& {
+      return partials[i].data.sum;
+    }, combine);
+
+    if(partials[0].data.sum) {
+      r = bop(r, *partials[0].data.sum);
     }
 
-    sf.join();
+    for(auto& partial : partials) {
+      if(partial.data.head) {
+        r = bop(r, **partial.data.head);
+      }
+    }
   });
 
   return task;
@@ -146,16 +480,14 @@ Task FlowBuilder::reduce(B beg, E end, T& init, O bop) {
 // default transform and reduction
 // ----------------------------------------------------------------------------
 
-template <typename B, typename E, typename T, typename BOP, typename UOP>
+template <typename B, typename E, typename T, typename BOP, typename UOP, typename P>
 Task FlowBuilder::transform_reduce(
-  B beg, E end, T& init, BOP bop, UOP uop
+  B beg, E end, T& init, BOP bop, UOP uop, P part
 ) {
 
   using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
   using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
-  using namespace std::string_literals;
-
-  Task task = emplace([b=beg, e=end, &r=init, bop, uop] (Subflow& sf) mutable {
+  Task task = emplace([b=beg, e=end, &r=init, bop, uop, part] (Subflow& sf) mutable {
 
     // fetch the iterator values
     B_t beg = b;
@@ -165,13 +497,62 @@ Task FlowBuilder::transform_reduce(
       return;
     }
 
-    //size_t chunk_size = (c == 0) ? 1 : c;
-    size_t chunk_size = 1;
     size_t W = sf._executor.num_workers();
     size_t N = std::distance(beg, end);
 
+    // arithmetic sums and products of transformed elements of the same type
+    // run through the vectorized kernel
+    if constexpr(detail::is_simd_reduction<B_t, T, BOP>::value &&
+                 std::is_same<neo::decay_t<decltype(uop(*beg))>, T>::value) {
+      _simd_reduce(sf, &*beg, N, r, bop, uop, part);
+      return;
+    }
+
+    auto combine = [&bop] (T& a, T& b) { a = bop(std::move(a), std::move(b)); };
+
+    // fixed chunks combined in a fixed order, whatever the number of workers
+    if(is_deterministic_partitioner<P>::value) {
+
+      if(N == 1) {
+        r = bop(std::move(r), uop(*beg));
+        return;
+      }
+
+      DeterministicPartitioner fixed(part.chunk_size());
+
+      size_t chunk_size = fixed.adjusted_chunk_size(N);
+      size_t C = std::max(size_t{1}, N / chunk_size);
+
+      std::vector<absl::optional<T>> partials(C);
+      std::atomic<size_t> next(0);
+
+      auto loop = [=, &next, &partials] (size_t w) mutable {
+        auto at = detail::make_chunk_cursor(beg);
+        fixed.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+          auto first = at(s0);
+          auto last  = at(e0);
+          auto beg1 = first++;
+          auto beg2 = first++;
+          T sum = bop(uop(*beg1), uop(*beg2));
+          for(; first != last; ++first) {
+            sum = bop(std::move(sum), uop(*first));
+          }
+          partials[s0 / chunk_size] = std::move(sum);
+        });
+      };
+
+      _launch_loop(sf, fixed, N, std::min(W, C), next, loop);
+
+      detail::reduce_tree(C, [&] (size_t i) -> absl::optional<T>& {
+        return partials[i];
+      }, combine);
+
+      r = bop(std::move(r), std::move(*partials[0]));
+      return;
+    }
+
     // only myself - no need to spawn another graph
-    if(W <= 1 || N <= chunk_size) {
+    if(W <= 1 || N <= part.chunk_size()) {
       for(; beg!=end; r = bop(std::move(r), uop(*beg++)));
       return;
     }
@@ -180,107 +561,230 @@ Task FlowBuilder::transform_reduce(
       W = N;
     }
 
-    std::mutex mutex;
+    // the partial sum of each worker, or its only element if it got one
+    struct Partial {
+      absl::optional<T> sum;
+      absl::optional<B_t> head;
+    };
+
+    std::vector<CachelineAligned<Partial>> partials(W);
     std::atomic<size_t> next(0);
-      
-    auto loop = [=, &mutex, &next, &r] () mutable {
 
-      size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
+    auto loop = [=, &next, &partials] (size_t w) mutable {
+
+      // the head element of a worker waits for a second one
+      // to initialize the partial sum
+      auto at = detail::make_chunk_cursor(beg);
+      B_t head = beg;
+      bool has_head = false;
+      absl::optional<T> sum;
+
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto first = at(s0);
+        auto last  = at(e0);
+        if(!sum) {
+          if(!has_head) {
+            head = first++;
+            has_head = true;
+            if(first == last) {
+              return;
+            }
+          }
+          sum.emplace(bop(uop(*head), uop(*first++)));
+        }
+        for(; first != last; ++first) {
+          *sum = bop(std::move(*sum), uop(*first));
+        }
+      });
 
-      if(s0 >= N) {
-        return;
+      if(sum) {
+        partials[w].data.sum = std::move(sum);
+      }
+      else if(has_head) {
+        partials[w].data.head = head;
       }
+    };
 
-      std::advance(beg, s0);
+    _launch_loop(sf, part, N, W, next, loop);
 
-      if(N - s0 == 1) {
-        std::lock_guard<std::mutex> lock(mutex);
-        r = bop(std::move(r), uop(*beg));
-        return;
+    detail::reduce_tree(W, [&] (size_t i) -> absl::optional<T>& {
+      return partials[i].data.sum;
+    }, combine);
+
+    if(partials[0].data.sum) {
+      r = bop(std::move(r), std::move(*partials[0].data.sum));
+    }
+
+    for(auto& partial : partials) {
+      if(partial.data.head) {
+        r = bop(std::move(r), uop(**partial.data.head));
       }
+    }
+  });
+
+  return task;
+}
 
-      auto beg1 = beg++;
-      auto beg2 = beg++;
+// ----------------------------------------------------------------------------
+// reduction by key
+// ----------------------------------------------------------------------------
 
-      T sum = bop(uop(*beg1), uop(*beg2));
+// Procedure: _reduce_by_key
+// applies the N elements starting at beg to the bins of result by their
+// keys, in either of two ways:
+//   1. with fewer bins than elements per worker, each worker applies its
+//      chunks to private bins, and then each worker merges the private bins
+//      of all workers in its own range of keys into result
+//   2. otherwise, private bins would outweigh the elements, so each worker
+//      sorts the entries of its chunks into one shard per range of keys,
+//      and then each worker applies the entries of its own shard from all
+//      workers to result
+// either way, no two workers write the same bin of result, and hot bins
+// cost no contention
+template <typename B, typename R, typename KOP, typename F, typename P>
+void FlowBuilder::_reduce_by_key(
+  Subflow& sf, B beg, size_t N, R& result, KOP& key, F& make_bins, P& part
+) {
 
-      size_t z = s0 + 2;
-      size_t p1 = 2 * W * (chunk_size + 1);
-      double p2 = 0.5 / static_cast<double>(W);
-      s0 = next.load(std::memory_order_relaxed);
+  using bins_type = decltype(make_bins(size_t{0}));
+  using entry_type = typename bins_type::entry_type;
 
-      while(s0 < N) {
+  size_t W = sf._executor.num_workers();
+  size_t K = result.size();
 
-        size_t r = N - s0;
+  // only myself - no need to spawn another graph
+  if(W <= 1 || N <= part.chunk_size()) {
+    auto bins = make_bins(0);
+    for(size_t i=0; i<N; i++, ++beg) {
+      bins.apply(result, key(*beg), *beg);
+    }
+    return;
+  }
 
-        // fine-grained
-        if(r < p1) {
-          while(1) {
-            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-            if(s0 >= N) {
-              break;
-            }
-            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-            std::advance(beg, s0-z);
-            for(size_t x=s0; x<e0; x++, beg++) {
-              sum = bop(std::move(sum), uop(*beg));
-            }
-            z = e0;
-          }
-          break;
+  if(N < W) {
+    W = N;
+  }
+
+  std::atomic<size_t> next(0);
+
+  // private bins, allocated by the workers that get any chunk
+  if(K * W <= N) {
+
+    std::vector<absl::optional<bins_type>> locals(W);
+
+    auto loop = [=, &next, &key, &make_bins, &locals] (size_t w) mutable {
+      auto at = detail::make_chunk_cursor(beg);
+      auto& bins = locals[w];
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        if(!bins) {
+          bins.emplace(make_bins(K));
         }
-        // coarse-grained
-        else {
-          size_t q = static_cast<size_t>(p2 * r);
-          if(q < chunk_size) {
-            q = chunk_size;
-          }
-          size_t e0 = (q <= r) ? s0 + q : N;
-          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                  std::memory_order_relaxed)) {
-            std::advance(beg, s0-z);
-            for(size_t x = s0; x<e0; x++, beg++) {
-              sum = bop(std::move(sum), uop(*beg));
-            }
-            z = e0;
-            s0 = next.load(std::memory_order_relaxed);
+        auto itr = at(s0);
+        for(size_t i=s0; i<e0; i++, ++itr) {
+          bins->add(key(*itr), *itr);
+        }
+      });
+    };
+
+    _launch_loop(sf, part, N, W, next, loop);
+
+    auto merge = [&] (size_t w) {
+      for(auto& bins : locals) {
+        if(bins) {
+          for(size_t k=w*K/W, e=(w+1)*K/W; k<e; k++) {
+            bins->merge(result, k);
           }
         }
       }
-
-      std::lock_guard<std::mutex> lock(mutex);
-      r = bop(std::move(r), std::move(sum));
     };
 
-    for(size_t w=0; w<W; w++) {
-      //if(w*2 >= N) {
-      //  break;
-      //}
-      //sf._named_silent_async(sf._worker, "loop-"s + std::to_string(w), loop);
-      
-      auto r = N - next.load(std::memory_order_relaxed);
-      // no more loop work to do - finished by previous async tasks
-      if(!r) {
-        break;
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, merge);
+    return;
+  }
+
+  // shards[w][s] holds the entries of worker w in the keys of worker s,
+  // [s*K/W, (s+1)*K/W), which contiguous ranges keep apart in the cache
+  std::vector<std::vector<std::vector<entry_type>>> shards(
+    W, std::vector<std::vector<entry_type>>(W)
+  );
+
+  auto loop = [=, &next, &key, &make_bins, &shards] (size_t w) mutable {
+    auto at = detail::make_chunk_cursor(beg);
+    auto bins = make_bins(0);
+    auto& mine = shards[w];
+    part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+      auto itr = at(s0);
+      for(size_t i=s0; i<e0; i++, ++itr) {
+        size_t k = key(*itr);
+        mine[((k+1)*W-1)/K].push_back(bins.entry(k, *itr));
       }
-      // tail optimization
-      if(r <= chunk_size || w == W-1) {
-        loop(); 
-        break;
-      }
-      else {
-        sf._named_silent_async(sf._worker, "loop-"s + std::to_string(w), loop);
+    });
+  };
+
+  _launch_loop(sf, part, N, W, next, loop);
+
+  auto apply = [&] (size_t s) {
+    auto bins = make_bins(0);
+    for(auto& theirs : shards) {
+      for(auto& e : theirs[s]) {
+        bins.apply(result, e);
       }
     }
+  };
+
+  sf.reset(false);
+  _launch_loop(sf, StaticPartitioner(), W, W, next, apply);
+}
 
-    sf.join();
+// Function: histogram
+template <typename B, typename E, typename H, typename KOP, typename P>
+Task FlowBuilder::histogram(B first, E last, H& bins, KOP key, P part) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using T = neo::decay_t<decltype(std::declval<H&>()[0])>;
+
+  Task task = emplace([b=first, e=last, &h=bins, key, part]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    auto make_bins = [] (size_t K) { return detail::HistogramBins<T>(K); };
+
+    _reduce_by_key(sf, beg, std::distance(beg, end), h, key, make_bins, part);
   });
 
   return task;
 }
 
-}  // end of namespace tf -----------------------------------------------------
+// Function: reduce_by_key
+template <typename B, typename E, typename R, typename KOP, typename BOP, typename UOP, typename P>
+Task FlowBuilder::reduce_by_key(
+  B first, E last, R& result, KOP key, BOP bop, UOP uop, P part
+) {
 
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using T = neo::decay_t<decltype(std::declval<R&>()[0])>;
+
+  Task task = emplace([b=first, e=last, &r=result, key, bop, uop, part]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
 
+    auto make_bins = [&bop, &uop] (size_t K) {
+      return detail::ReduceBins<T, BOP, UOP>(K, bop, uop);
+    };
+
+    _reduce_by_key(sf, beg, std::distance(beg, end), r, key, make_bins, part);
+  });
 
+  return task;
+}
 
+}  // end of namespace tf -----------------------------------------------------
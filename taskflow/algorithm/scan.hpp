@@ -0,0 +1,285 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Struct: scan_identity
+// unary operator of the scans that do not transform their elements
+struct scan_identity {
+  template <typename U>
+  const U& operator () (const U& u) const { return u; }
+};
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// scan
+// ----------------------------------------------------------------------------
+
+// Procedure: _scan
+// scans the N elements starting at beg into d_beg in three phases:
+//   1. each worker scans a contiguous block into the output and keeps the
+//      sum of the block (the first block starts from the initial value)
+//   2. the calling worker turns the block sums into block prefixes
+//   3. each worker but the first adds the prefix of the preceding blocks
+//      to the output of its block
+// every element is read before its output is written, such that
+// the scan can run in place, and an exclusive block that has no running
+// value to start from leaves its first output to the fix-up phase
+template <bool I, typename T, typename B, typename D, typename BOP, typename UOP>
+void FlowBuilder::_scan(
+  Subflow& sf, B beg, size_t N, D d_beg, BOP& bop, UOP& uop,
+  absl::optional<T> init
+) {
+
+  // scans [s, e) from the running value acc if any
+  auto scan_block = [&] (size_t s, size_t e, absl::optional<T>& acc) {
+    auto itr = std::next(beg, s);
+    auto out = std::next(d_beg, s);
+    if(!acc) {
+      acc.emplace(uop(*itr));
+      if(I) {
+        *out = *acc;
+      }
+      ++itr;
+      ++out;
+      ++s;
+    }
+    T& sum = *acc;
+    for(; s<e; s++, ++itr, ++out) {
+      if(I) {
+        sum = bop(sum, uop(*itr));
+        *out = sum;
+      }
+      else {
+        T v = uop(*itr);
+        *out = sum;
+        sum = bop(sum, std::move(v));
+      }
+    }
+  };
+
+  // at least a few cache lines of work per block
+  size_t W = std::min(sf._executor.num_workers(), N / 64);
+
+  // only myself - no need to spawn another graph
+  if(W <= 1) {
+    scan_block(0, N, init);
+    return;
+  }
+
+  std::vector<absl::optional<T>> sums(W);
+  std::atomic<size_t> next(0);
+
+  sums[0] = std::move(init);
+
+  auto phase1 = [&] (size_t w) {
+    scan_block(w*N/W, (w+1)*N/W, sums[w]);
+  };
+
+  _launch_loop(sf, StaticPartitioner(), W, W, next, phase1);
+
+  for(size_t w=1; w<W; w++) {
+    sums[w] = bop(*sums[w-1], *sums[w]);
+  }
+
+  auto phase3 = [&] (size_t w) {
+    size_t s = (w+1)*N/W;
+    size_t e = (w+2)*N/W;
+    const T& prefix = *sums[w];
+    auto out = std::next(d_beg, s);
+    if(!I) {
+      *out = prefix;
+      ++out;
+      ++s;
+    }
+    for(; s<e; s++, ++out) {
+      *out = bop(prefix, *out);
+    }
+  };
+
+  sf.reset(false);
+
+  _launch_loop(sf, StaticPartitioner(), W-1, W-1, next, phase3);
+}
+
+// Function: inclusive_scan
+template <typename B, typename E, typename D, typename BOP>
+Task FlowBuilder::inclusive_scan(B first, E last, D d_first, BOP bop) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+  using T = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    detail::scan_identity uop;
+
+    _scan<true>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>()
+    );
+  });
+
+  return task;
+}
+
+// Function: inclusive_scan
+template <typename B, typename E, typename D, typename BOP, typename T>
+Task FlowBuilder::inclusive_scan(B first, E last, D d_first, BOP bop, T init) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    detail::scan_identity uop;
+
+    _scan<true>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>(init)
+    );
+  });
+
+  return task;
+}
+
+// Function: exclusive_scan
+template <typename B, typename E, typename D, typename T, typename BOP>
+Task FlowBuilder::exclusive_scan(B first, E last, D d_first, T init, BOP bop) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    detail::scan_identity uop;
+
+    _scan<false>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>(init)
+    );
+  });
+
+  return task;
+}
+
+// Function: transform_inclusive_scan
+template <typename B, typename E, typename D, typename BOP, typename UOP>
+Task FlowBuilder::transform_inclusive_scan(
+  B first, E last, D d_first, BOP bop, UOP uop
+) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+  using T = neo::decay_t<decltype(std::declval<UOP&>()(*std::declval<B_t>()))>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    _scan<true>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>()
+    );
+  });
+
+  return task;
+}
+
+// Function: transform_inclusive_scan
+template <typename B, typename E, typename D, typename BOP, typename UOP, typename T>
+Task FlowBuilder::transform_inclusive_scan(
+  B first, E last, D d_first, BOP bop, UOP uop, T init
+) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    _scan<true>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>(init)
+    );
+  });
+
+  return task;
+}
+
+// Function: transform_exclusive_scan
+template <typename B, typename E, typename D, typename T, typename BOP, typename UOP>
+Task FlowBuilder::transform_exclusive_scan(
+  B first, E last, D d_first, T init, BOP bop, UOP uop
+) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using D_t = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace([=] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    B_t beg = first;
+    E_t end = last;
+    D_t d_beg = d_first;
+
+    if(beg == end) {
+      return;
+    }
+
+    _scan<false>(
+      sf, beg, std::distance(beg, end), d_beg, bop, uop, absl::optional<T>(init)
+    );
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,450 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Function: first_segment
+// returns the first of the S segments whose first element is at position k
+// or beyond, from the offsets of their first elements
+template <typename O>
+size_t first_segment(O offsets, size_t S, size_t k) {
+  size_t lo = 0;
+  size_t hi = S;
+  while(lo < hi) {
+    size_t s = lo + (hi - lo) / 2;
+    if(static_cast<size_t>(offsets[s]) < k) {
+      lo = s + 1;
+    }
+    else {
+      hi = s;
+    }
+  }
+  return lo;
+}
+
+// Struct: SegmentedBlock
+// the partial results of a block of elements for the segments that cross
+// its boundaries: the head segment starts before the block and the tail
+// segment starts in the block and ends after it
+template <typename T>
+struct SegmentedBlock {
+  size_t first {0};
+  size_t last {0};
+  size_t head_end {0};
+  bool has_head {false};
+  bool spans {false};
+  bool has_tail {false};
+  absl::optional<T> head;
+  absl::optional<T> tail;
+};
+
+// Function: make_segmented_blocks
+// splits the elements [lo, lo+N) of the S segments into W blocks of equal
+// size, where a block owns the segments that start in it, the last block
+// also owns those that start at lo+N, and a block that has no segment
+// starting at its first element takes part of the segment before
+template <typename T, typename O>
+std::vector<SegmentedBlock<T>> make_segmented_blocks(
+  O offsets, size_t S, size_t lo, size_t N, size_t W
+) {
+  std::vector<SegmentedBlock<T>> blocks(W);
+  for(size_t w=0; w<W; w++) {
+    blocks[w].first = first_segment(offsets, S, lo + w*N/W);
+  }
+  for(size_t w=0; w<W; w++) {
+    auto& b = blocks[w];
+    size_t bs = lo + w*N/W;
+    size_t be = lo + (w+1)*N/W;
+    b.last = (w+1 < W) ? blocks[w+1].first : S;
+    if(b.first > 0 && static_cast<size_t>(offsets[b.first]) > bs) {
+      b.has_head = true;
+      b.spans = static_cast<size_t>(offsets[b.first]) > be;
+      b.head_end = std::min(static_cast<size_t>(offsets[b.first]), be);
+    }
+  }
+  return blocks;
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// segmented reduce
+// ----------------------------------------------------------------------------
+
+// Procedure: _segmented_reduce
+// reduces each of the S segments of the values into d_beg in two phases,
+// balanced by the number of elements rather than of segments:
+//   1. each worker folds the segments that start and end in its block of
+//      elements into the output, and keeps the partial results of the
+//      segments that cross the boundaries of its block
+//   2. the calling worker combines the partial results of every segment
+//      that crosses blocks, in the order of the blocks
+// a long segment thus spreads over many workers, and many short segments
+// fall into the block of a single worker
+template <typename T, typename B, typename O, typename D, typename BOP>
+void FlowBuilder::_segmented_reduce(
+  Subflow& sf, B values, O offsets, size_t S, D d_beg, BOP& bop,
+  absl::optional<T> init
+) {
+
+  // folds the elements [s, e) into the running value acc if any
+  auto fold = [&] (size_t s, size_t e, absl::optional<T>& acc) {
+    if(s == e) {
+      return;
+    }
+    auto itr = std::next(values, s);
+    if(!acc) {
+      acc.emplace(*itr);
+      ++itr;
+      ++s;
+    }
+    T& sum = *acc;
+    for(; s<e; s++, ++itr) {
+      sum = bop(sum, *itr);
+    }
+  };
+
+  // reduces the segments [s, e) from the initial value if any, leaving
+  // the output of an empty segment untouched without one
+  auto reduce = [&] (size_t s, size_t e) {
+    auto out = std::next(d_beg, s);
+    for(; s<e; s++, ++out) {
+      absl::optional<T> acc(init);
+      fold(static_cast<size_t>(offsets[s]), static_cast<size_t>(offsets[s+1]), acc);
+      if(acc) {
+        *out = std::move(*acc);
+      }
+    }
+  };
+
+  size_t lo = static_cast<size_t>(offsets[0]);
+  size_t N = static_cast<size_t>(offsets[S]) - lo;
+
+  // at least a few cache lines of elements or segments per worker
+  size_t W = std::min(sf._executor.num_workers(), (N + S) / 1024);
+
+  // only myself - no need to spawn another graph
+  if(W <= 1) {
+    reduce(0, S);
+    return;
+  }
+
+  auto blocks = detail::make_segmented_blocks<T>(offsets, S, lo, N, W);
+
+  std::atomic<size_t> next(0);
+
+  auto phase1 = [&] (size_t w) {
+    auto& b = blocks[w];
+    size_t be = lo + (w+1)*N/W;
+    if(b.has_head) {
+      fold(lo + w*N/W, b.head_end, b.head);
+    }
+    if(b.first == b.last) {
+      return;
+    }
+    // the last segment may cross the end of the block
+    size_t s = b.last - 1;
+    if(static_cast<size_t>(offsets[s+1]) > be) {
+      b.has_tail = true;
+      b.tail = init;
+      fold(static_cast<size_t>(offsets[s]), be, b.tail);
+      reduce(b.first, s);
+    }
+    else {
+      reduce(b.first, b.last);
+    }
+  };
+
+  _launch_loop(sf, StaticPartitioner(), W, W, next, phase1);
+
+  absl::optional<T> carry;
+  size_t seg = 0;
+
+  for(auto& b : blocks) {
+    if(b.has_head && b.head) {
+      if(carry) {
+        carry = bop(*carry, *b.head);
+      }
+      else {
+        carry = std::move(b.head);
+      }
+    }
+    if(b.has_head && !b.spans) {
+      *std::next(d_beg, seg) = std::move(*carry);
+      carry.reset();
+    }
+    if(b.has_tail) {
+      carry = std::move(b.tail);
+      seg = b.last - 1;
+    }
+  }
+}
+
+// Function: segmented_reduce
+template <typename B, typename OB, typename OE, typename D, typename BOP>
+Task FlowBuilder::segmented_reduce(
+  B values, OB offsets_first, OE offsets_last, D d_first, BOP bop
+) {
+
+  using B_t  = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using OB_t = neo::decay_t<unwrap_ref_decay_t<OB>>;
+  using OE_t = neo::decay_t<unwrap_ref_decay_t<OE>>;
+  using D_t  = neo::decay_t<unwrap_ref_decay_t<D>>;
+  using T    = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace(
+  [v=values, ob=offsets_first, oe=offsets_last, d=d_first, bop]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t  beg = v;
+    OB_t o_beg = ob;
+    OE_t o_end = oe;
+    D_t  d_beg = d;
+
+    // the offsets of S segments come with the end of the last one
+    size_t S = std::distance(o_beg, o_end);
+
+    if(S <= 1) {
+      return;
+    }
+
+    _segmented_reduce(sf, beg, o_beg, S - 1, d_beg, bop, absl::optional<T>());
+  });
+
+  return task;
+}
+
+// Function: segmented_reduce
+template <typename B, typename OB, typename OE, typename D, typename T, typename BOP>
+Task FlowBuilder::segmented_reduce(
+  B values, OB offsets_first, OE offsets_last, D d_first, T init, BOP bop
+) {
+
+  using B_t  = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using OB_t = neo::decay_t<unwrap_ref_decay_t<OB>>;
+  using OE_t = neo::decay_t<unwrap_ref_decay_t<OE>>;
+  using D_t  = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace(
+  [v=values, ob=offsets_first, oe=offsets_last, d=d_first, init, bop]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t  beg = v;
+    OB_t o_beg = ob;
+    OE_t o_end = oe;
+    D_t  d_beg = d;
+
+    // the offsets of S segments come with the end of the last one
+    size_t S = std::distance(o_beg, o_end);
+
+    if(S <= 1) {
+      return;
+    }
+
+    _segmented_reduce(sf, beg, o_beg, S - 1, d_beg, bop, absl::optional<T>(init));
+  });
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// segmented scan
+// ----------------------------------------------------------------------------
+
+// Procedure: _segmented_scan
+// scans each of the S segments of the values into d_beg in three phases,
+// balanced by the number of elements rather than of segments:
+//   1. each worker scans the segments in its block of elements into the
+//      output, where the part of a segment that starts before the block
+//      starts over from its first element in the block
+//   2. the calling worker turns the sums of the parts of every segment that
+//      crosses blocks into the prefixes of those parts
+//   3. each worker adds the prefix of its first part to its output
+// as in _scan, every element is read before its output is written, such
+// that the scan can run in place
+template <typename T, typename B, typename O, typename D, typename BOP>
+void FlowBuilder::_segmented_scan(
+  Subflow& sf, B values, O offsets, size_t S, D d_beg, BOP& bop,
+  absl::optional<T> init
+) {
+
+  // scans the elements [s, e) from the running value acc if any
+  auto scan = [&] (size_t s, size_t e, absl::optional<T>& acc) {
+    if(s == e) {
+      return;
+    }
+    auto itr = std::next(values, s);
+    auto out = std::next(d_beg, s);
+    if(!acc) {
+      acc.emplace(*itr);
+      *out = *acc;
+      ++itr;
+      ++out;
+      ++s;
+    }
+    T& sum = *acc;
+    for(; s<e; s++, ++itr, ++out) {
+      sum = bop(sum, *itr);
+      *out = sum;
+    }
+  };
+
+  // scans the segments [s, e) from the initial value if any
+  auto scan_segments = [&] (size_t s, size_t e) {
+    for(; s<e; s++) {
+      absl::optional<T> acc(init);
+      scan(static_cast<size_t>(offsets[s]), static_cast<size_t>(offsets[s+1]), acc);
+    }
+  };
+
+  size_t lo = static_cast<size_t>(offsets[0]);
+  size_t N = static_cast<size_t>(offsets[S]) - lo;
+
+  // at least a few cache lines of elements or segments per worker
+  size_t W = std::min(sf._executor.num_workers(), (N + S) / 1024);
+
+  // only myself - no need to spawn another graph
+  if(W <= 1) {
+    scan_segments(0, S);
+    return;
+  }
+
+  auto blocks = detail::make_segmented_blocks<T>(offsets, S, lo, N, W);
+
+  std::atomic<size_t> next(0);
+
+  auto phase1 = [&] (size_t w) {
+    auto& b = blocks[w];
+    size_t be = lo + (w+1)*N/W;
+    if(b.has_head) {
+      scan(lo + w*N/W, b.head_end, b.head);
+    }
+    if(b.first == b.last) {
+      return;
+    }
+    // the last segment may cross the end of the block
+    size_t s = b.last - 1;
+    if(static_cast<size_t>(offsets[s+1]) > be) {
+      b.has_tail = true;
+      b.tail = init;
+      scan(static_cast<size_t>(offsets[s]), be, b.tail);
+      scan_segments(b.first, s);
+    }
+    else {
+      scan_segments(b.first, b.last);
+    }
+  };
+
+  _launch_loop(sf, StaticPartitioner(), W, W, next, phase1);
+
+  // the head of each block turns from the sum of its part into the prefix
+  // of the part, the running value of the segment before the block
+  absl::optional<T> carry;
+
+  for(auto& b : blocks) {
+    if(b.has_head) {
+      absl::optional<T> sum = std::move(b.head);
+      b.head = carry;
+      if(sum) {
+        carry = bop(*carry, *sum);
+      }
+      if(!b.spans) {
+        carry.reset();
+      }
+    }
+    if(b.has_tail) {
+      carry = std::move(b.tail);
+    }
+  }
+
+  auto phase3 = [&] (size_t w) {
+    auto& b = blocks[w];
+    if(!b.has_head) {
+      return;
+    }
+    const T& prefix = *b.head;
+    auto out = std::next(d_beg, lo + w*N/W);
+    for(size_t s=lo + w*N/W; s<b.head_end; s++, ++out) {
+      *out = bop(prefix, *out);
+    }
+  };
+
+  sf.reset(false);
+  _launch_loop(sf, StaticPartitioner(), W, W, next, phase3);
+}
+
+// Function: segmented_inclusive_scan
+template <typename B, typename OB, typename OE, typename D, typename BOP>
+Task FlowBuilder::segmented_inclusive_scan(
+  B values, OB offsets_first, OE offsets_last, D d_first, BOP bop
+) {
+
+  using B_t  = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using OB_t = neo::decay_t<unwrap_ref_decay_t<OB>>;
+  using OE_t = neo::decay_t<unwrap_ref_decay_t<OE>>;
+  using D_t  = neo::decay_t<unwrap_ref_decay_t<D>>;
+  using T    = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace(
+  [v=values, ob=offsets_first, oe=offsets_last, d=d_first, bop]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t  beg = v;
+    OB_t o_beg = ob;
+    OE_t o_end = oe;
+    D_t  d_beg = d;
+
+    // the offsets of S segments come with the end of the last one
+    size_t S = std::distance(o_beg, o_end);
+
+    if(S <= 1) {
+      return;
+    }
+
+    _segmented_scan(sf, beg, o_beg, S - 1, d_beg, bop, absl::optional<T>());
+  });
+
+  return task;
+}
+
+// Function: segmented_inclusive_scan
+template <typename B, typename OB, typename OE, typename D, typename BOP, typename T>
+Task FlowBuilder::segmented_inclusive_scan(
+  B values, OB offsets_first, OE offsets_last, D d_first, BOP bop, T init
+) {
+
+  using B_t  = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using OB_t = neo::decay_t<unwrap_ref_decay_t<OB>>;
+  using OE_t = neo::decay_t<unwrap_ref_decay_t<OE>>;
+  using D_t  = neo::decay_t<unwrap_ref_decay_t<D>>;
+
+  Task task = emplace(
+  [v=values, ob=offsets_first, oe=offsets_last, d=d_first, bop, init]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t  beg = v;
+    OB_t o_beg = ob;
+    OE_t o_end = oe;
+    D_t  d_beg = d;
+
+    // the offsets of S segments come with the end of the last one
+    size_t S = std::distance(o_beg, o_end);
+
+    if(S <= 1) {
+      return;
+    }
+
+    _segmented_scan(sf, beg, o_beg, S - 1, d_beg, bop, absl::optional<T>(init));
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
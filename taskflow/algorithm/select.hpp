@@ -0,0 +1,421 @@
+#pragma once
+
+#include "sort.hpp"
+
+#include <cmath>
+
+namespace tf {
+
+namespace detail {
+
+// Function: sample_index
+// returns the index in [0, n) of the i-th sample of a range of n elements,
+// scrambled such that the samples of periodic or sorted input are not
+// aligned with its period
+inline size_t sample_index(size_t i, size_t n) {
+  uint64_t x = (static_cast<uint64_t>(i) + 1) * 0x9E3779B97F4A7C15ull;
+  x ^= x >> 31;
+  x *= 0xBF58476D1CE4E5B9ull;
+  x ^= x >> 27;
+  return static_cast<size_t>(x % n);
+}
+
+// Procedure: bounded_heap_push
+// keeps in the max-heap heap the k best elements of those pushed to it,
+// where the best elements come first in the order of comp
+template <typename T, typename U, typename C>
+void bounded_heap_push(std::vector<T>& heap, size_t k, U&& v, C& comp) {
+  if(heap.size() < k) {
+    heap.push_back(std::forward<U>(v));
+    std::push_heap(heap.begin(), heap.end(), comp);
+  }
+  else if(comp(v, heap.front())) {
+    std::pop_heap(heap.begin(), heap.end(), comp);
+    heap.back() = std::forward<U>(v);
+    std::push_heap(heap.begin(), heap.end(), comp);
+  }
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// nth_element
+// ----------------------------------------------------------------------------
+
+// Procedure: _nth_element
+// places the element of rank nth among the N elements starting at beg at
+// beg+nth, with no greater element before it and no smaller one after it,
+// by a parallel sample select over the range [lo, hi) that holds nth:
+//   1. the calling worker sorts a sample of [lo, hi) and takes the samples
+//      a few standard deviations below and above the rank of nth as the
+//      pivots, which bracket nth with a high probability
+//   2. each worker counts the elements of its block below the low pivot,
+//      between the pivots, and above the high pivot
+//   3. each worker moves the elements of its block to the buffer by class,
+//      and then its share of the buffer back, which leaves [lo, hi) as the
+//      three classes in order
+//   4. the class that holds nth becomes [lo, hi), until it is too small to
+//      split in parallel or all its elements are equivalent
+template <typename B, typename C>
+void FlowBuilder::_nth_element(Subflow& sf, B beg, size_t nth, size_t N, C& comp) {
+
+  using value_type = typename std::iterator_traits<B>::value_type;
+
+  std::vector<value_type> samples;
+  std::unique_ptr<value_type[]> buffer;
+  std::vector<std::array<size_t, 3>> offsets;
+  std::atomic<size_t> next(0);
+
+  for(size_t lo = 0, hi = N;;) {
+
+    size_t n = hi - lo;
+    size_t W = std::min(sf._executor.num_workers(), n / parallel_sort_cutoff<B>());
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      std::nth_element(beg + lo, beg + nth, beg + hi, comp);
+      return;
+    }
+
+    // a sample of S elements with the pivots d ranks away from the rank t
+    // of nth leaves about 6/sqrt(S) of the range between the pivots
+    size_t S = std::min(n, std::max(
+      size_t{1024}, static_cast<size_t>(4 * std::sqrt(static_cast<double>(n)))
+    ));
+    size_t d = static_cast<size_t>(3 * std::sqrt(static_cast<double>(S))) + 1;
+    size_t t = (nth - lo) * S / n;
+
+    samples.clear();
+    for(size_t i=0; i<S; i++) {
+      samples.push_back(beg[lo + detail::sample_index(i, n)]);
+    }
+    std::sort(samples.begin(), samples.end(), comp);
+
+    bool has_low  = t >= d;
+    bool has_high = t + d < S;
+    const value_type& p1 = samples[has_low ? t - d : 0];
+    const value_type& p2 = samples[has_high ? t + d : S - 1];
+
+    auto classify = [&] (const value_type& v) -> size_t {
+      if(has_low && comp(v, p1)) {
+        return 0;
+      }
+      if(has_high && comp(p2, v)) {
+        return 2;
+      }
+      return 1;
+    };
+
+    offsets.assign(W, {0, 0, 0});
+
+    auto count = [&] (size_t w) {
+      std::array<size_t, 3> c {0, 0, 0};
+      for(size_t i=lo+w*n/W, e=lo+(w+1)*n/W; i<e; i++) {
+        c[classify(beg[i])]++;
+      }
+      offsets[w] = c;
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, count);
+
+    // the classes go one after another in the buffer, and the elements of
+    // a block after those of the preceding blocks in each class
+    std::array<size_t, 3> starts {0, 0, 0};
+    for(size_t c=0, total=0; c<3; c++) {
+      starts[c] = total;
+      for(auto& o : offsets) {
+        size_t k = o[c];
+        o[c] = total;
+        total += k;
+      }
+    }
+
+    size_t lows = starts[1];
+    size_t mids = starts[2] - starts[1];
+
+    // every element is between the pivots, which happens with many
+    // elements equivalent to the pivots
+    if(mids == n) {
+      if(has_low && has_high && !comp(p1, p2)) {
+        return;
+      }
+      std::nth_element(beg + lo, beg + nth, beg + hi, comp);
+      return;
+    }
+
+    // default-initialized elements leave the first touch of the pages
+    // to the workers that scatter to them
+    if(!buffer) {
+      buffer.reset(new value_type[n]);
+    }
+
+    auto scatter = [&] (size_t w) {
+      auto o = offsets[w];
+      for(size_t i=lo+w*n/W, e=lo+(w+1)*n/W; i<e; i++) {
+        buffer[o[classify(beg[i])]++] = std::move(beg[i]);
+      }
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, scatter);
+
+    auto move_back = [&] (size_t w) {
+      std::move(
+        buffer.get() + w*n/W, buffer.get() + (w+1)*n/W, beg + lo + w*n/W
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, move_back);
+
+    if(nth < lo + lows) {
+      hi = lo + lows;
+    }
+    else if(nth < lo + lows + mids) {
+      // the elements between two equivalent pivots are all equivalent
+      if(has_low && has_high && !comp(p1, p2)) {
+        return;
+      }
+      hi = lo + lows + mids;
+      lo = lo + lows;
+    }
+    else {
+      lo = lo + lows + mids;
+    }
+  }
+}
+
+// Function: nth_element
+template <typename B, typename E, typename C>
+Task FlowBuilder::nth_element(B first, B nth, E last, C comp) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([b=first, m=nth, e=last, comp] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    B_t mid = m;
+    E_t end = e;
+
+    if(mid == end) {
+      return;
+    }
+
+    _nth_element(sf, beg, static_cast<size_t>(mid - beg), end - beg, comp);
+  });
+
+  return task;
+}
+
+// Function: nth_element
+template <typename B, typename E>
+Task FlowBuilder::nth_element(B first, B nth, E last) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  return nth_element(first, nth, last, std::less<value_type>{});
+}
+
+// ----------------------------------------------------------------------------
+// partial_sort
+// ----------------------------------------------------------------------------
+
+// Function: partial_sort
+// selects the element of rank K, which leaves the K smallest elements
+// before it, and sorts them
+template <typename B, typename E, typename C>
+Task FlowBuilder::partial_sort(B first, B middle, E last, C comp) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  Task task = emplace([b=first, m=middle, e=last, comp] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    B_t mid = m;
+    E_t end = e;
+
+    size_t N = end - beg;
+    size_t K = mid - beg;
+
+    if(K == 0) {
+      return;
+    }
+
+    // only myself - no need to spawn another graph
+    if(sf._executor.num_workers() <= 1 || N <= parallel_sort_cutoff<B_t>()) {
+      std::partial_sort(beg, mid, end, comp);
+      return;
+    }
+
+    if(K < N) {
+      _nth_element(sf, beg, K, N, comp);
+    }
+
+    if(K <= parallel_sort_cutoff<B_t>()) {
+      std::sort(beg, mid, comp);
+      return;
+    }
+
+    sf.reset(false);
+    parallel_pdqsort(sf, beg, mid, comp, log2(K));
+    sf.join();
+  });
+
+  return task;
+}
+
+// Function: partial_sort
+template <typename B, typename E>
+Task FlowBuilder::partial_sort(B first, B middle, E last) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  return partial_sort(first, middle, last, std::less<value_type>{});
+}
+
+// ----------------------------------------------------------------------------
+// top_k
+// ----------------------------------------------------------------------------
+
+// Function: top_k
+// keeps the K best elements of each block in a bounded heap when K is
+// small relative to the blocks, and merges the sorted heaps pairwise in
+// parallel; a larger K copies the range to a buffer, selects the element
+// of rank K in it, and sorts the elements before it
+template <typename B, typename E, typename O, typename C>
+Task FlowBuilder::top_k(B first, E last, size_t k, O d_first, C comp) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using O_t = neo::decay_t<unwrap_ref_decay_t<O>>;
+  using value_type = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([b=first, e=last, k, o=d_first, comp]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+    O_t d_beg = o;
+
+    size_t N = end - beg;
+    size_t K = std::min(k, N);
+
+    if(K == 0) {
+      return;
+    }
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      std::partial_sort_copy(beg, end, d_beg, std::next(d_beg, K), comp);
+      return;
+    }
+
+    std::atomic<size_t> next(0);
+
+    // a block of many more elements than K rarely replaces the top of its
+    // heap, which makes the scan close to a single pass over the block
+    if(K <= N / (8*W)) {
+
+      std::vector<std::vector<value_type>> heaps(W);
+
+      auto scan = [&] (size_t w) {
+        auto& heap = heaps[w];
+        heap.reserve(K);
+        for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++) {
+          detail::bounded_heap_push(heap, K, beg[i], comp);
+        }
+        std::sort_heap(heap.begin(), heap.end(), comp);
+      };
+
+      _launch_loop(sf, StaticPartitioner(), W, W, next, scan);
+
+      // each round merges the heaps 2^r apart, keeping the K best elements
+      for(size_t r=1; r<W; r*=2) {
+
+        size_t M = (W + 2*r - 1) / (2*r);
+
+        auto merge = [&, r] (size_t m) {
+          size_t i = 2*r*m;
+          if(i + r >= W) {
+            return;
+          }
+          auto& h1 = heaps[i];
+          auto& h2 = heaps[i+r];
+          std::vector<value_type> out(std::min(K, h1.size() + h2.size()));
+          auto x = h1.begin(), y = h2.begin();
+          for(auto& v : out) {
+            if(y == h2.end() || (x != h1.end() && !comp(*y, *x))) {
+              v = std::move(*x++);
+            }
+            else {
+              v = std::move(*y++);
+            }
+          }
+          h1 = std::move(out);
+          std::vector<value_type>().swap(h2);
+        };
+
+        sf.reset(false);
+        _launch_loop(sf, StaticPartitioner(), M, M, next, merge);
+      }
+
+      std::move(heaps[0].begin(), heaps[0].end(), d_beg);
+      return;
+    }
+
+    std::vector<value_type> buffer(N);
+
+    auto copy = [&] (size_t w) {
+      std::copy(beg + w*N/W, beg + (w+1)*N/W, buffer.begin() + w*N/W);
+    };
+
+    _launch_loop(sf, StaticPartitioner(), W, W, next, copy);
+
+    if(K < N) {
+      _nth_element(sf, buffer.begin(), K, N, comp);
+    }
+
+    if(K <= parallel_sort_cutoff<B_t>()) {
+      std::sort(buffer.begin(), buffer.begin() + K, comp);
+    }
+    else {
+      sf.reset(false);
+      parallel_pdqsort(sf, buffer.begin(), buffer.begin() + K, comp, log2(K));
+      sf.join();
+    }
+
+    size_t V = std::min(W, K / 1024 + 1);
+
+    auto move_out = [&] (size_t w) {
+      std::move(
+        buffer.begin() + w*K/V, buffer.begin() + (w+1)*K/V,
+        std::next(d_beg, w*K/V)
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), V, V, next, move_out);
+  });
+
+  return task;
+}
+
+// Function: top_k
+template <typename B, typename E, typename O>
+Task FlowBuilder::top_k(B first, E last, size_t k, O d_first) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  return top_k(first, last, k, d_first, std::less<value_type>{});
+}
+
+}  // end of namespace tf -----------------------------------------------------
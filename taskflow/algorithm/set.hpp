@@ -0,0 +1,399 @@
+#pragma once
+
+#include "merge.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Class: CountingOutput
+// an output iterator that counts the elements written through it
+class CountingOutput {
+
+  public:
+
+  using iterator_category = std::output_iterator_tag;
+  using value_type        = void;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = void;
+  using reference         = void;
+
+  CountingOutput& operator * () { return *this; }
+  CountingOutput& operator ++ () { return *this; }
+  CountingOutput& operator ++ (int) { return *this; }
+
+  template <typename T>
+  CountingOutput& operator = (T&&) {
+    _count++;
+    return *this;
+  }
+
+  size_t count() const { return _count; }
+
+  private:
+
+  size_t _count {0};
+};
+
+// Function: set_split
+// returns the split (i, j) of a[0, n) and b[0, m) at the output position k
+// of their merge, moved back in both ranges to the first element equivalent
+// to the k-th one of the merge, such that no two chunks between the splits
+// hold equivalent elements
+template <typename A, typename B, typename C>
+std::pair<size_t, size_t> set_split(
+  A a, size_t n, B b, size_t m, size_t k, C& comp
+) {
+
+  size_t i = merge_co_rank(a, n, b, m, k, comp);
+  size_t j = k - i;
+
+  auto split = [&] (auto&& pivot) {
+    return std::make_pair(
+      static_cast<size_t>(std::lower_bound(a, a + i, pivot, comp) - a),
+      static_cast<size_t>(std::lower_bound(b, b + j, pivot, comp) - b)
+    );
+  };
+
+  if(i == n) {
+    return j == m ? std::make_pair(n, m) : split(b[j]);
+  }
+  if(j < m && comp(b[j], a[i])) {
+    return split(b[j]);
+  }
+  return split(a[i]);
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// set operations
+// ----------------------------------------------------------------------------
+
+// Function: _set_operation
+// runs the sequential set operation op over W chunks of a[0, n) and b[0, m)
+// and returns the number of output elements, where
+//   1. the calling worker splits both ranges at the W parts of their merge,
+//      where no equivalent elements fall into different chunks
+//   2. each worker counts the output elements of its chunk
+//   3. the calling worker scans the counts into output offsets
+//   4. each worker writes the output of its chunk at its offset
+template <typename A, typename B, typename O, typename C, typename F>
+size_t FlowBuilder::_set_operation(
+  Subflow& sf, A a, size_t n, B b, size_t m, O out, size_t W, C& comp, F& op
+) {
+
+  std::vector<size_t> is(W+1), js(W+1), offsets(W+1);
+  std::atomic<size_t> next(0);
+
+  for(size_t w=0; w<=W; w++) {
+    std::tie(is[w], js[w]) = detail::set_split(a, n, b, m, w*(n+m)/W, comp);
+  }
+
+  auto count = [&] (size_t w) {
+    offsets[w] = op(
+      a + is[w], a + is[w+1], b + js[w], b + js[w+1], detail::CountingOutput()
+    ).count();
+  };
+
+  _launch_loop(sf, StaticPartitioner(), W, W, next, count);
+
+  size_t total = 0;
+  for(auto& o : offsets) {
+    size_t c = o;
+    o = total;
+    total += c;
+  }
+
+  auto write = [&] (size_t w) {
+    op(a + is[w], a + is[w+1], b + js[w], b + js[w+1], std::next(out, offsets[w]));
+  };
+
+  sf.reset(false);
+  _launch_loop(sf, StaticPartitioner(), W, W, next, write);
+
+  return total;
+}
+
+// Function: set_intersection
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T, typename C
+>
+Task FlowBuilder::set_intersection(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+) {
+
+  using B1_t = neo::decay_t<unwrap_ref_decay_t<B1>>;
+  using E1_t = neo::decay_t<unwrap_ref_decay_t<E1>>;
+  using B2_t = neo::decay_t<unwrap_ref_decay_t<B2>>;
+  using E2_t = neo::decay_t<unwrap_ref_decay_t<E2>>;
+  using O_t  = neo::decay_t<unwrap_ref_decay_t<O>>;
+
+  Task task = emplace(
+  [b1=first1, e1=last1, b2=first2, e2=last2, o=d_first, &r=result, comp]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B1_t beg1 = b1;
+    E1_t end1 = e1;
+    B2_t beg2 = b2;
+    E2_t end2 = e2;
+    O_t  d_beg = o;
+
+    size_t n = std::distance(beg1, end1);
+    size_t m = std::distance(beg2, end2);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), (n + m) / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::set_intersection(beg1, end1, beg2, end2, d_beg, comp);
+      return;
+    }
+
+    auto op = [&comp] (auto a0, auto a1, auto c0, auto c1, auto out) {
+      return std::set_intersection(a0, a1, c0, c1, out, comp);
+    };
+
+    r = std::next(d_beg, _set_operation(sf, beg1, n, beg2, m, d_beg, W, comp, op));
+  });
+
+  return task;
+}
+
+// Function: set_intersection
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T
+>
+Task FlowBuilder::set_intersection(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B1>>
+  >::value_type;
+  return set_intersection(
+    first1, last1, first2, last2, d_first, result, std::less<value_type>{}
+  );
+}
+
+// Function: set_union
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T, typename C
+>
+Task FlowBuilder::set_union(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+) {
+
+  using B1_t = neo::decay_t<unwrap_ref_decay_t<B1>>;
+  using E1_t = neo::decay_t<unwrap_ref_decay_t<E1>>;
+  using B2_t = neo::decay_t<unwrap_ref_decay_t<B2>>;
+  using E2_t = neo::decay_t<unwrap_ref_decay_t<E2>>;
+  using O_t  = neo::decay_t<unwrap_ref_decay_t<O>>;
+
+  Task task = emplace(
+  [b1=first1, e1=last1, b2=first2, e2=last2, o=d_first, &r=result, comp]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B1_t beg1 = b1;
+    E1_t end1 = e1;
+    B2_t beg2 = b2;
+    E2_t end2 = e2;
+    O_t  d_beg = o;
+
+    size_t n = std::distance(beg1, end1);
+    size_t m = std::distance(beg2, end2);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), (n + m) / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::set_union(beg1, end1, beg2, end2, d_beg, comp);
+      return;
+    }
+
+    auto op = [&comp] (auto a0, auto a1, auto c0, auto c1, auto out) {
+      return std::set_union(a0, a1, c0, c1, out, comp);
+    };
+
+    r = std::next(d_beg, _set_operation(sf, beg1, n, beg2, m, d_beg, W, comp, op));
+  });
+
+  return task;
+}
+
+// Function: set_union
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T
+>
+Task FlowBuilder::set_union(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B1>>
+  >::value_type;
+  return set_union(
+    first1, last1, first2, last2, d_first, result, std::less<value_type>{}
+  );
+}
+
+// Function: set_difference
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T, typename C
+>
+Task FlowBuilder::set_difference(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+) {
+
+  using B1_t = neo::decay_t<unwrap_ref_decay_t<B1>>;
+  using E1_t = neo::decay_t<unwrap_ref_decay_t<E1>>;
+  using B2_t = neo::decay_t<unwrap_ref_decay_t<B2>>;
+  using E2_t = neo::decay_t<unwrap_ref_decay_t<E2>>;
+  using O_t  = neo::decay_t<unwrap_ref_decay_t<O>>;
+
+  Task task = emplace(
+  [b1=first1, e1=last1, b2=first2, e2=last2, o=d_first, &r=result, comp]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B1_t beg1 = b1;
+    E1_t end1 = e1;
+    B2_t beg2 = b2;
+    E2_t end2 = e2;
+    O_t  d_beg = o;
+
+    size_t n = std::distance(beg1, end1);
+    size_t m = std::distance(beg2, end2);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), (n + m) / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::set_difference(beg1, end1, beg2, end2, d_beg, comp);
+      return;
+    }
+
+    auto op = [&comp] (auto a0, auto a1, auto c0, auto c1, auto out) {
+      return std::set_difference(a0, a1, c0, c1, out, comp);
+    };
+
+    r = std::next(d_beg, _set_operation(sf, beg1, n, beg2, m, d_beg, W, comp, op));
+  });
+
+  return task;
+}
+
+// Function: set_difference
+template <typename B1, typename E1, typename B2, typename E2, typename O,
+  typename T
+>
+Task FlowBuilder::set_difference(
+  B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B1>>
+  >::value_type;
+  return set_difference(
+    first1, last1, first2, last2, d_first, result, std::less<value_type>{}
+  );
+}
+
+// ----------------------------------------------------------------------------
+// unique
+// ----------------------------------------------------------------------------
+
+// Function: unique
+// removes the duplicates of each block in place with std::unique, where the
+// first element of a block is a duplicate if it is equivalent to the last
+// element of the previous block, and moves the remaining elements of the
+// blocks through a buffer as remove_if
+template <typename B, typename E, typename T, typename P>
+Task FlowBuilder::unique(B first, E last, T& result, P pred) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using value_type = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([b=first, e=last, &r=result, pred]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t N = std::distance(beg, end);
+
+    // at least a few cache lines of input per worker
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      r = std::unique(beg, end, pred);
+      return;
+    }
+
+    // the blocks whose first element is a duplicate, decided before
+    // any worker removes the duplicates of its block
+    std::vector<size_t> skips(W, 0), offsets(W);
+    for(size_t w=1; w<W; w++) {
+      auto itr = std::next(beg, w*N/W);
+      skips[w] = pred(*std::prev(itr), *itr);
+    }
+
+    std::atomic<size_t> next(0);
+
+    auto compact = [&] (size_t w) {
+      auto s = std::next(beg, w*N/W);
+      auto e = std::next(beg, (w+1)*N/W);
+      offsets[w] = std::distance(s, std::unique(s, e, pred)) - skips[w];
+    };
+
+    _launch_loop(sf, StaticPartitioner(), W, W, next, compact);
+
+    std::vector<size_t> counts(offsets);
+
+    size_t K = 0;
+    for(auto& o : offsets) {
+      size_t c = o;
+      o = K;
+      K += c;
+    }
+
+    std::vector<value_type> kept(K);
+
+    auto scatter = [&] (size_t w) {
+      auto s = std::next(beg, w*N/W + skips[w]);
+      std::move(s, std::next(s, counts[w]), kept.begin() + offsets[w]);
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, scatter);
+
+    auto move_back = [&] (size_t w) {
+      std::move(
+        kept.begin() + w*K/W, kept.begin() + (w+1)*K/W, std::next(beg, w*K/W)
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, move_back);
+
+    r = std::next(beg, K);
+  });
+
+  return task;
+}
+
+// Function: unique
+template <typename B, typename E, typename T>
+Task FlowBuilder::unique(B first, E last, T& result) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  return unique(first, last, result, std::equal_to<value_type>{});
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+
+// the SIMD kernels use the vector extensions of GCC and Clang, and
+// the x86 kernels are compiled for their instruction sets with the target
+// attribute and dispatched at run time
+#if defined(__GNUC__)
+  #define TF_SIMD_VECTOR_EXTENSIONS
+  #if defined(__x86_64__) || defined(__i386__)
+    #define TF_SIMD_X86_DISPATCH
+  #endif
+#endif
+
+// a kernel that must round alike on every instruction set keeps
+// multiplications and additions apart instead of contracting them into
+// fused multiply-adds, which GCC does across statements in its default
+// GNU mode and Clang does only within one expression by default
+#if defined(__GNUC__) && !defined(__clang__)
+  #define TF_SIMD_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+  #define TF_SIMD_NO_CONTRACT
+#endif
+
+namespace tf {
+
+namespace detail {
+
+// ----------------------------------------------------------------------------
+// instruction sets
+// ----------------------------------------------------------------------------
+
+// Function: simd_width
+// returns the width in bytes of the widest vector registers the running
+// processor supports among those the SIMD kernels are compiled for
+inline size_t simd_width() {
+#if defined(TF_SIMD_X86_DISPATCH)
+  static const size_t width = [] () -> size_t {
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) {
+      return 64;
+    }
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+      return 32;
+    }
+    return 16;
+  }();
+  return width;
+#elif defined(TF_SIMD_VECTOR_EXTENSIONS)
+  return 16;
+#else
+  return 0;
+#endif
+}
+
+}  // end of namespace detail -------------------------------------------------
+
+}  // end of namespace tf -----------------------------------------------------
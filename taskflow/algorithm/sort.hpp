@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../core/executor.hpp"
+#include "merge.hpp"
+
+#include <cstring>
 
 namespace tf {
 
@@ -424,6 +427,344 @@ void parallel_3wqsort(tf::Subflow& sf, RandItr first, RandItr last, C compare) {
   //sf.join();
 }
 
+// ----------------------------------------------------------------------------
+// radix sort
+// ----------------------------------------------------------------------------
+
+namespace detail {
+
+// Struct: is_radix_key
+// arithmetic keys whose order is the order of an unsigned integer of
+// the same size
+template <typename T>
+struct is_radix_key : std::integral_constant<bool,
+  std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+  (std::is_integral<T>::value || std::numeric_limits<T>::is_iec559) &&
+  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+> {};
+
+// unsigned integer of the same size as the key type T
+template <typename T>
+using radix_bits_t = std::conditional_t<sizeof(T) == 1, uint8_t,
+                     std::conditional_t<sizeof(T) == 2, uint16_t,
+                     std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+// Function: radix_bits
+// maps a key to an unsigned integer of the same order: the sign bit of
+// a signed integer is flipped, and so are all bits of a negative float
+template <typename T>
+radix_bits_t<T> radix_bits(T key) {
+  using U = radix_bits_t<T>;
+  constexpr U sign = static_cast<U>(U(1) << (sizeof(T)*8 - 1));
+  U u;
+  std::memcpy(&u, &key, sizeof(T));
+  if(std::is_floating_point<T>::value) {
+    return (u & sign) ? static_cast<U>(~u) : static_cast<U>(u | sign);
+  }
+  return std::is_signed<T>::value ? static_cast<U>(u ^ sign) : u;
+}
+
+// value type of a radix sort, which has no values for a null pointer
+struct radix_no_value {};
+
+template <typename V>
+struct radix_value {
+  using type = typename std::iterator_traits<V>::value_type;
+};
+
+template <>
+struct radix_value<std::nullptr_t> {
+  using type = radix_no_value;
+};
+
+}  // end of namespace detail -------------------------------------------------
+
+// Procedure: _radix_sort
+// sorts the N keys starting at k, along with the values starting at v
+// unless v is a null pointer, in one pass per key byte from the least
+// significant one; every pass
+//   1. counts the digits of a contiguous block of keys per worker
+//   2. turns the counts into the output offset of each worker and digit,
+//      skipping the pass if all keys have the same digit
+//   3. scatters the block of each worker into the other range, through
+//      cacheline-sized buffers per digit for a range beyond the cache,
+//      such that the writes to the output range come in whole cachelines
+// the passes ping-pong between the range and a scratch range and the
+// keys of equal digits keep their order, such that the sort is stable
+template <typename K, typename V>
+void FlowBuilder::_radix_sort(Subflow& sf, K k, size_t N, V v) {
+
+  using key_type = typename std::iterator_traits<K>::value_type;
+  using value_type = typename detail::radix_value<V>::type;
+
+  constexpr bool has_values = !std::is_same<V, std::nullptr_t>::value;
+  constexpr size_t L = std::max<size_t>(1, TF_CACHELINE_SIZE / sizeof(key_type));
+
+  // at least a cutoff of keys per block
+  size_t W = std::min(sf._executor.num_workers(), N / parallel_sort_cutoff<K>());
+
+  if(W == 0) {
+    W = 1;
+  }
+
+  // the buffers pay off once the scattered writes miss the cache
+  bool combine = N * (sizeof(key_type) + (has_values ? sizeof(value_type) : 0))
+               > (size_t{1} << 24);
+
+  std::unique_ptr<key_type[]> kbuf(new key_type[N]);
+  std::vector<value_type> vbuf(has_values ? N : 0);
+  std::vector<std::array<size_t, 256>> counts(W);
+  std::atomic<size_t> next(0);
+
+  // runs loop(w) for every worker w, on the calling worker if only one
+  auto parallel = [&] (auto& loop) {
+    if(W == 1) {
+      loop(0);
+    }
+    else {
+      sf.reset(false);
+      _launch_loop(sf, StaticPartitioner(), W, W, next, loop);
+    }
+  };
+
+  // sorts ks by the digit at shift into kd, returning false if skipped
+  auto pass = [&] (auto ks, auto kd, auto vs, auto vd, size_t shift) {
+
+    auto digit = [shift] (key_type key) {
+      return static_cast<size_t>((detail::radix_bits(key) >> shift) & 255);
+    };
+
+    auto count = [&] (size_t w) {
+      auto& c = counts[w];
+      c.fill(0);
+      for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++) {
+        c[digit(ks[i])]++;
+      }
+    };
+
+    parallel(count);
+
+    for(size_t d=0, total=0; d<256; d++) {
+      size_t base = total;
+      for(size_t w=0; w<W; w++) {
+        size_t c = counts[w][d];
+        counts[w][d] = total;
+        total += c;
+      }
+      if(total - base == N) {
+        return false;
+      }
+    }
+
+    auto scatter = [&] (size_t w) {
+
+      auto& offset = counts[w];
+
+      size_t i = w*N/W;
+      size_t e = (w+1)*N/W;
+
+      // output ranges within the cache take every key directly
+      if(!combine) {
+        for(; i<e; i++) {
+          size_t o = offset[digit(ks[i])]++;
+          kd[o] = ks[i];
+          if constexpr(has_values) {
+            vd[o] = std::move(vs[i]);
+          }
+        }
+        return;
+      }
+
+      std::array<size_t, 256> fill;
+      std::vector<key_type> kwc(256 * L);
+      std::vector<value_type> vwc(has_values ? 256 * L : 0);
+
+      fill.fill(0);
+
+      // writes the f buffered elements of digit d to the output range
+      auto flush = [&] (size_t d, size_t f) {
+        for(size_t j=0; j<f; j++) {
+          kd[offset[d] + j] = kwc[d*L + j];
+          if constexpr(has_values) {
+            vd[offset[d] + j] = std::move(vwc[d*L + j]);
+          }
+        }
+        offset[d] += f;
+      };
+
+      for(; i<e; i++) {
+        size_t d = digit(ks[i]);
+        size_t f = fill[d]++;
+        kwc[d*L + f] = ks[i];
+        if constexpr(has_values) {
+          vwc[d*L + f] = std::move(vs[i]);
+        }
+        if(f + 1 == L) {
+          flush(d, L);
+          fill[d] = 0;
+        }
+      }
+
+      for(size_t d=0; d<256; d++) {
+        flush(d, fill[d]);
+      }
+    };
+
+    parallel(scatter);
+
+    return true;
+  };
+
+  bool in_buf = false;
+
+  for(size_t shift=0; shift<8*sizeof(key_type); shift+=8) {
+    bool sorted = in_buf ? pass(kbuf.get(), k, vbuf.begin(), v, shift) :
+                           pass(k, kbuf.get(), v, vbuf.begin(), shift);
+    if(sorted) {
+      in_buf = !in_buf;
+    }
+  }
+
+  if(in_buf) {
+    auto move_back = [&] (size_t w) {
+      size_t s = w*N/W;
+      size_t e = (w+1)*N/W;
+      std::copy(kbuf.get() + s, kbuf.get() + e, k + s);
+      if constexpr(has_values) {
+        std::move(vbuf.begin() + s, vbuf.begin() + e, v + s);
+      }
+    };
+    parallel(move_back);
+  }
+}
+
+// Function: radix_sort
+template <typename B, typename E>
+Task FlowBuilder::radix_sort(B beg, E end) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+
+  static_assert(
+    detail::is_radix_key<typename std::iterator_traits<B_t>::value_type>::value,
+    "radix sort requires integral or floating-point keys"
+  );
+
+  Task task = emplace([b=beg, e=end] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t N = std::distance(beg, end);
+
+    // few keys are sorted faster by comparison
+    if(N <= parallel_sort_cutoff<B_t>()) {
+      std::sort(beg, end);
+      return;
+    }
+
+    _radix_sort(sf, beg, N, nullptr);
+  });
+
+  return task;
+}
+
+// Function: sort_by_key
+template <typename KB, typename KE, typename V>
+Task FlowBuilder::sort_by_key(KB k_first, KE k_last, V v_first) {
+
+  using KB_t = neo::decay_t<unwrap_ref_decay_t<KB>>;
+  using KE_t = neo::decay_t<unwrap_ref_decay_t<KE>>;
+  using V_t  = neo::decay_t<unwrap_ref_decay_t<V>>;
+  using key_type = typename std::iterator_traits<KB_t>::value_type;
+
+  if constexpr(detail::is_radix_key<key_type>::value) {
+    return emplace([kb=k_first, ke=k_last, vb=v_first] (Subflow& sf) mutable {
+      // fetch the iterator values
+      KB_t kbeg = kb;
+      KE_t kend = ke;
+      V_t  vbeg = vb;
+      _radix_sort(sf, kbeg, std::distance(kbeg, kend), vbeg);
+    });
+  }
+  else {
+    return sort_by_key(k_first, k_last, v_first, std::less<key_type>{});
+  }
+}
+
+// Function: sort_by_key
+// pairs up the keys and values for the stable sort, since the sort
+// moves the elements of a single range
+template <typename KB, typename KE, typename V, typename C>
+Task FlowBuilder::sort_by_key(KB k_first, KE k_last, V v_first, C comp) {
+
+  using KB_t = neo::decay_t<unwrap_ref_decay_t<KB>>;
+  using KE_t = neo::decay_t<unwrap_ref_decay_t<KE>>;
+  using V_t  = neo::decay_t<unwrap_ref_decay_t<V>>;
+  using pair_type = std::pair<
+    typename std::iterator_traits<KB_t>::value_type,
+    typename std::iterator_traits<V_t>::value_type
+  >;
+
+  Task task = emplace([kb=k_first, ke=k_last, vb=v_first, comp]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    KB_t kbeg = kb;
+    KE_t kend = ke;
+    V_t  vbeg = vb;
+
+    size_t N = std::distance(kbeg, kend);
+    size_t W = std::min(sf._executor.num_workers(), N / parallel_sort_cutoff<KB_t>());
+
+    std::vector<pair_type> kv(N);
+    std::atomic<size_t> next(0);
+
+    // moves the pairs from (to) the key and value ranges
+    auto pack = [&] (size_t w, bool in) {
+      for(size_t i=w*N/W, e=(w+1)*N/W; i<e; i++) {
+        if(in) {
+          kv[i].first  = std::move(kbeg[i]);
+          kv[i].second = std::move(vbeg[i]);
+        }
+        else {
+          kbeg[i] = std::move(kv[i].first);
+          vbeg[i] = std::move(kv[i].second);
+        }
+      }
+    };
+
+    auto by_key = [&comp] (const pair_type& a, const pair_type& b) {
+      return comp(a.first, b.first);
+    };
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      W = 1;
+      pack(0, true);
+      std::stable_sort(kv.begin(), kv.end(), by_key);
+      pack(0, false);
+      return;
+    }
+
+    auto pack_in = [&] (size_t w) { pack(w, true); };
+    auto pack_out = [&] (size_t w) { pack(w, false); };
+
+    _launch_loop(sf, StaticPartitioner(), W, W, next, pack_in);
+
+    std::vector<pair_type> buf(N);
+
+    sf.reset(false);
+    _stable_sort(sf, kv.begin(), N, buf.begin(), by_key);
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), W, W, next, pack_out);
+  });
+
+  return task;
+}
+
 // ----------------------------------------------------------------------------
 // tf::Taskflow::sort
 // ----------------------------------------------------------------------------
@@ -464,10 +805,170 @@ Task FlowBuilder::sort(B beg, E end, C cmp) {
 }
 
 // Function: sort
+// arithmetic keys are sorted in increasing order by the radix sort
 template <typename B, typename E>
 Task FlowBuilder::sort(B beg, E end) {
-  using value_type = neo::decay_t<decltype(*std::declval<B>())>;
-  return sort(beg, end, std::less<value_type>{});
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  if constexpr(detail::is_radix_key<value_type>::value) {
+    return radix_sort(beg, end);
+  }
+  else {
+    return sort(beg, end, std::less<value_type>{});
+  }
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::stable_sort
+// ----------------------------------------------------------------------------
+
+// Procedure: _stable_sort
+// sorts the N elements starting at beg through the scratch range buf:
+//   1. each of K workers stable-sorts a contiguous run
+//   2. every pass merges pairs of adjacent runs from one range into the
+//      other, each worker producing the output of one run
+//   3. the workers move the result back if it ended up in the scratch range
+template <typename R, typename S, typename C>
+void FlowBuilder::_stable_sort(Subflow& sf, R beg, size_t N, S buf, C& cmp) {
+
+  // at least a cutoff of elements per run
+  size_t K = std::min(sf._executor.num_workers(), N / parallel_sort_cutoff<R>());
+
+  // only myself - no need to spawn another graph
+  if(K <= 1) {
+    std::stable_sort(beg, beg + N, cmp);
+    return;
+  }
+
+  // position of the r-th run, clamped to the end
+  auto run = [N, K] (size_t r) { return std::min(r, K) * N / K; };
+
+  std::atomic<size_t> next(0);
+
+  auto sort_runs = [&] (size_t w) {
+    std::stable_sort(beg + run(w), beg + run(w+1), cmp);
+  };
+
+  _launch_loop(sf, StaticPartitioner(), K, K, next, sort_runs);
+
+  // the numbers of elements each worker takes from the first run of its pair
+  std::vector<std::pair<size_t, size_t>> cuts(K);
+
+  // merges runs of s into runs of 2s from src to dst, worker w producing
+  // the output of run w; the cuts are searched up front by the caller,
+  // since the merges move the elements out of src
+  auto merge_runs = [&] (auto src, auto dst, size_t s) {
+
+    for(size_t w=0; w<K; w++) {
+      size_t lo = run(w - w % (2*s));
+      size_t mi = run(w - w % (2*s) + s);
+      size_t hi = run(w - w % (2*s) + 2*s);
+      cuts[w].first = detail::merge_co_rank(
+        src + lo, mi - lo, src + mi, hi - mi, run(w) - lo, cmp
+      );
+      cuts[w].second = detail::merge_co_rank(
+        src + lo, mi - lo, src + mi, hi - mi, run(w+1) - lo, cmp
+      );
+    }
+
+    auto loop = [&] (size_t w) {
+      size_t lo = run(w - w % (2*s));
+      size_t mi = run(w - w % (2*s) + s);
+      size_t k0 = run(w) - lo;
+      size_t k1 = run(w+1) - lo;
+      size_t i0 = cuts[w].first;
+      size_t i1 = cuts[w].second;
+      detail::move_merge(
+        src + lo + i0, src + lo + i1, src + mi + (k0 - i0), src + mi + (k1 - i1),
+        dst + run(w), cmp
+      );
+    };
+
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), K, K, next, loop);
+  };
+
+  bool in_buf = false;
+
+  for(size_t s=1; s<K; s*=2) {
+    if(in_buf) {
+      merge_runs(buf, beg, s);
+    }
+    else {
+      merge_runs(beg, buf, s);
+    }
+    in_buf = !in_buf;
+  }
+
+  if(in_buf) {
+    auto move_back = [&] (size_t w) {
+      std::move(buf + w*N/K, buf + (w+1)*N/K, beg + w*N/K);
+    };
+    sf.reset(false);
+    _launch_loop(sf, StaticPartitioner(), K, K, next, move_back);
+  }
+}
+
+// Function: stable_sort
+template <typename B, typename E, typename C>
+Task FlowBuilder::stable_sort(B beg, E end, C cmp) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using value_type = typename std::iterator_traits<B_t>::value_type;
+
+  Task task = emplace([b=beg, e=end, cmp] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= parallel_sort_cutoff<B_t>()) {
+      std::stable_sort(beg, end, cmp);
+      return;
+    }
+
+    std::vector<value_type> buffer(N);
+
+    _stable_sort(sf, beg, N, buffer.begin(), cmp);
+  });
+
+  return task;
+}
+
+// Function: stable_sort
+template <typename B, typename E>
+Task FlowBuilder::stable_sort(B beg, E end) {
+  using value_type = typename std::iterator_traits<
+    neo::decay_t<unwrap_ref_decay_t<B>>
+  >::value_type;
+  return stable_sort(beg, end, std::less<value_type>{});
+}
+
+// Function: stable_sort
+template <typename B, typename E, typename C, typename S>
+Task FlowBuilder::stable_sort(B beg, E end, C cmp, S buffer) {
+
+  using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
+  using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
+  using S_t = neo::decay_t<unwrap_ref_decay_t<S>>;
+
+  Task task = emplace([b=beg, e=end, cmp, buffer] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    B_t beg = b;
+    E_t end = e;
+    S_t buf = buffer;
+
+    _stable_sort(sf, beg, std::distance(beg, end), buf, cmp);
+  });
+
+  return task;
 }
 
 }  // namespace tf ------------------------------------------------------------
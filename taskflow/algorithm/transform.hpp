@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../core/executor.hpp"
+#include "launch.hpp"
 
 namespace tf {
 
@@ -9,17 +9,17 @@ namespace tf {
 // ----------------------------------------------------------------------------
 
 // Function: transform
-template <typename B, typename E, typename O, typename C>
-Task FlowBuilder::transform(B first1, E last1, O d_first, C c) {
-
-  using namespace std::string_literals;
+template <typename B, typename E, typename O, typename C, typename P,
+  neo::enable_if_t<is_partitioner<neo::decay_t<P>>::value, void>*
+>
+Task FlowBuilder::transform(B first1, E last1, O d_first, C c, P part) {
 
   using B_t = neo::decay_t<unwrap_ref_decay_t<B>>;
   using E_t = neo::decay_t<unwrap_ref_decay_t<E>>;
   using O_t = neo::decay_t<unwrap_ref_decay_t<O>>;
 
   Task task = emplace(
-  [first1, last1, d_first, c] (Subflow& sf) mutable {
+  [first1, last1, d_first, c, part] (Subflow& sf) mutable {
 
     // fetch the stateful values
     B_t beg   = first1;
@@ -30,12 +30,11 @@ Task FlowBuilder::transform(B first1, E last1, O d_first, C c) {
       return;
     }
 
-    size_t chunk_size = 1;
     size_t W = sf._executor.num_workers();
     size_t N = std::distance(beg, end);
 
     // only myself - no need to spawn another graph
-    if(W <= 1 || N <= chunk_size) {
+    if(W <= 1 || N <= part.chunk_size()) {
       std::transform(beg, end, d_beg, c);
       return;
     }
@@ -45,83 +44,33 @@ Task FlowBuilder::transform(B first1, E last1, O d_first, C c) {
     }
 
     std::atomic<size_t> next(0);
-      
-    auto loop = [=, &next] () mutable {
-
-      size_t z = 0;
-      size_t p1 = 2 * W * (chunk_size + 1);
-      double p2 = 0.5 / static_cast<double>(W);
-      size_t s0 = next.load(std::memory_order_relaxed);
-
-      while(s0 < N) {
-
-        size_t r = N - s0;
-
-        // fine-grained
-        if(r < p1) {
-          while(1) {
-            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-            if(s0 >= N) {
-              return;
-            }
-            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-            std::advance(beg, s0-z);
-            std::advance(d_beg, s0-z);
-            for(size_t x=s0; x<e0; x++) {
-              *d_beg++ = c(*beg++);
-            }
-            z = e0;
-          }
-          break;
-        }
-        // coarse-grained
-        else {
-          size_t q = static_cast<size_t>(p2 * r);
-          if(q < chunk_size) {
-            q = chunk_size;
-          }
-          size_t e0 = (q <= r) ? s0 + q : N;
-          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                  std::memory_order_relaxed)) {
-            std::advance(beg, s0-z);
-            std::advance(d_beg, s0-z);
-            for(size_t x = s0; x< e0; x++) {
-              *d_beg++ = c(*beg++);
-            }
-            z = e0;
-            s0 = next.load(std::memory_order_relaxed);
-          }
+
+    auto loop = [=, &next] (size_t w) mutable {
+      auto at   = detail::make_chunk_cursor(beg);
+      auto d_at = detail::make_chunk_cursor(d_beg);
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto first = at(s0);
+        auto last  = at(e0);
+        auto d_first = d_at(s0);
+        for(; first != last; ++first, ++d_first) {
+          *d_first = c(*first);
         }
-      }
+      });
     };
 
-    for(size_t w=0; w<W; w++) {
-      auto r = N - next.load(std::memory_order_relaxed);
-      // no more loop work to do - finished by previous async tasks
-      if(!r) {
-        break;
-      }
-      // tail optimization
-      if(r <= chunk_size || w == W-1) {
-        loop(); 
-        break;
-      }
-      else {
-        sf._named_silent_async(sf._worker, "loop-"s + std::to_string(w), loop);
-      }
-    }
-
-    sf.join();
+    _launch_loop(sf, part, N, W, next, loop);
   });
 
   return task;
 }
 
 // Function: transform
-template <typename B1, typename E1, typename B2, typename O, typename C>
-Task FlowBuilder::transform(B1 first1, E1 last1, B2 first2, O d_first, C c) {
-
-  using namespace std::string_literals;
+template <typename B1, typename E1, typename B2, typename O, typename C, typename P,
+  neo::enable_if_t<!is_partitioner<neo::decay_t<C>>::value, void>*
+>
+Task FlowBuilder::transform(
+  B1 first1, E1 last1, B2 first2, O d_first, C c, P part
+) {
 
   using B1_t = neo::decay_t<unwrap_ref_decay_t<B1>>;
   using E1_t = neo::decay_t<unwrap_ref_decay_t<E1>>;
@@ -129,7 +78,7 @@ Task FlowBuilder::transform(B1 first1, E1 last1, B2 first2, O d_first, C c) {
   using O_t = neo::decay_t<unwrap_ref_decay_t<O>>;
 
   Task task = emplace(
-  [first1, last1, first2, d_first, c] (Subflow& sf) mutable {
+  [first1, last1, first2, d_first, c, part] (Subflow& sf) mutable {
 
     // fetch the stateful values
     B1_t beg1 = first1;
@@ -141,12 +90,11 @@ Task FlowBuilder::transform(B1 first1, E1 last1, B2 first2, O d_first, C c) {
       return;
     }
 
-    size_t chunk_size = 1;
     size_t W = sf._executor.num_workers();
     size_t N = std::distance(beg1, end1);
 
     // only myself - no need to spawn another graph
-    if(W <= 1 || N <= chunk_size) {
+    if(W <= 1 || N <= part.chunk_size()) {
       std::transform(beg1, end1, beg2, d_beg, c);
       return;
     }
@@ -156,82 +104,26 @@ Task FlowBuilder::transform(B1 first1, E1 last1, B2 first2, O d_first, C c) {
     }
 
     std::atomic<size_t> next(0);
-      
-    auto loop = [=, &next] () mutable {
-
-      size_t z = 0;
-      size_t p1 = 2 * W * (chunk_size + 1);
-      double p2 = 0.5 / static_cast<double>(W);
-      size_t s0 = next.load(std::memory_order_relaxed);
-
-      while(s0 < N) {
-
-        size_t r = N - s0;
-
-        // fine-grained
-        if(r < p1) {
-          while(1) {
-            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-            if(s0 >= N) {
-              return;
-            }
-            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-            std::advance(beg1, s0-z);
-            std::advance(beg2, s0-z);
-            std::advance(d_beg, s0-z);
-            for(size_t x=s0; x<e0; x++) {
-              *d_beg++ = c(*beg1++, *beg2++);
-            }
-            z = e0;
-          }
-          break;
-        }
-        // coarse-grained
-        else {
-          size_t q = static_cast<size_t>(p2 * r);
-          if(q < chunk_size) {
-            q = chunk_size;
-          }
-          size_t e0 = (q <= r) ? s0 + q : N;
-          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                  std::memory_order_relaxed)) {
-            std::advance(beg1, s0-z);
-            std::advance(beg2, s0-z);
-            std::advance(d_beg, s0-z);
-            for(size_t x = s0; x< e0; x++) {
-              *d_beg++ = c(*beg1++, *beg2++);
-            }
-            z = e0;
-            s0 = next.load(std::memory_order_relaxed);
-          }
+
+    auto loop = [=, &next] (size_t w) mutable {
+      auto at1  = detail::make_chunk_cursor(beg1);
+      auto at2  = detail::make_chunk_cursor(beg2);
+      auto d_at = detail::make_chunk_cursor(d_beg);
+      part.loop(N, W, w, next, [&] (size_t s0, size_t e0) {
+        auto first1 = at1(s0);
+        auto last1  = at1(e0);
+        auto first2 = at2(s0);
+        auto d_first = d_at(s0);
+        for(; first1 != last1; ++first1, ++first2, ++d_first) {
+          *d_first = c(*first1, *first2);
         }
-      }
+      });
     };
 
-    for(size_t w=0; w<W; w++) {
-      auto r = N - next.load(std::memory_order_relaxed);
-      // no more loop work to do - finished by previous async tasks
-      if(!r) {
-        break;
-      }
-      // tail optimization
-      if(r <= chunk_size || w == W-1) {
-        loop(); 
-        break;
-      }
-      else {
-        sf._named_silent_async(sf._worker, "loop-"s + std::to_string(w), loop);
-      }
-    }
-
-    sf.join();
+    _launch_loop(sf, part, N, W, next, loop);
   });
 
   return task;
 }
 
-
 }  // end of namespace tf -----------------------------------------------------
-
-
-
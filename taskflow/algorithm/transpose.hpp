@@ -0,0 +1,65 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// transpose
+// ----------------------------------------------------------------------------
+
+// Function: transpose
+// splits the input into square tiles of a few cache lines per side, each
+// of which the workers read row by row and write column by column, such
+// that a tile of the input and of the output stays in the L1 cache
+template <typename T>
+Task FlowBuilder::transpose(const T* in, T* out, size_t rows, size_t cols) {
+
+  Task task = emplace([=] (Subflow& sf) {
+
+    // tiles of up to 16KB
+    constexpr size_t TB = sizeof(T) <= 4 ? 64 : (sizeof(T) <= 16 ? 32 : 16);
+
+    size_t TR = (rows + TB - 1) / TB;
+    size_t TC = (cols + TB - 1) / TB;
+    size_t TT = TR * TC;
+
+    auto tile = [=] (size_t t) {
+      size_t i0 = (t / TC) * TB, i1 = std::min(i0 + TB, rows);
+      size_t j0 = (t % TC) * TB, j1 = std::min(j0 + TB, cols);
+      for(size_t i=i0; i<i1; i++) {
+        for(size_t j=j0; j<j1; j++) {
+          out[j*rows + i] = in[i*cols + j];
+        }
+      }
+    };
+
+    size_t W = std::min(sf._executor.num_workers(), TT);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      for(size_t t=0; t<TT; t++) {
+        tile(t);
+      }
+      return;
+    }
+
+    std::atomic<size_t> next(0);
+
+    GuidedPartitioner part(1);
+
+    auto loop = [&] (size_t w) {
+      part.loop(TT, W, w, next, [&] (size_t s0, size_t e0) {
+        for(size_t t=s0; t<e0; t++) {
+          tile(t);
+        }
+      });
+    };
+
+    _launch_loop(sf, part, TT, W, next, loop);
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
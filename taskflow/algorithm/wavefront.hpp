@@ -0,0 +1,107 @@
+#pragma once
+
+#include "launch.hpp"
+
+namespace tf {
+
+namespace detail {
+
+// Class: Wavefront
+// runs the cells of a rows x cols grid, where a cell runs after its north
+// and west neighbors; a cell with both neighbors counts their completions
+// in a byte, and the neighbor that completes second runs it, while a cell
+// on the first row or column has one neighbor only and needs no counter
+template <typename C>
+class Wavefront {
+
+  public:
+
+  Wavefront(Subflow& sf, C& callable, size_t rows, size_t cols) :
+    _sf       {sf},
+    _callable {callable},
+    _rows     {rows},
+    _cols     {cols},
+    _counters {new std::atomic<uint8_t>[rows * cols]()} {
+  }
+
+  // runs the cell (i, j) and then the cells it makes ready: the east one
+  // on this worker, and the south one as a silent async of the subflow
+  // if both are ready
+  void run(size_t i, size_t j) {
+    while(true) {
+      _callable(i, j);
+      bool east  = j+1 < _cols && _ready(i, j+1);
+      bool south = i+1 < _rows && _ready(i+1, j);
+      if(east && south) {
+        _sf.silent_async([this, i, j] () { run(i+1, j); });
+      }
+      if(east) {
+        j++;
+      }
+      else if(south) {
+        i++;
+      }
+      else {
+        return;
+      }
+    }
+  }
+
+  private:
+
+  Subflow& _sf;
+  C& _callable;
+  size_t _rows;
+  size_t _cols;
+  std::unique_ptr<std::atomic<uint8_t>[]> _counters;
+
+  bool _ready(size_t i, size_t j) {
+    return i == 0 || j == 0 ||
+           _counters[i*_cols + j].fetch_add(1, std::memory_order_acq_rel) == 1;
+  }
+};
+
+}  // end of namespace detail -------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// wavefront
+// ----------------------------------------------------------------------------
+
+// Function: wavefront
+template <typename R, typename C, typename F>
+Task FlowBuilder::wavefront(R rows, C cols, F callable) {
+
+  using R_t = neo::decay_t<unwrap_ref_decay_t<R>>;
+  using C_t = neo::decay_t<unwrap_ref_decay_t<C>>;
+
+  Task task = emplace([rows, cols, callable] (Subflow& sf) mutable {
+
+    // fetch the stateful values
+    size_t M = static_cast<R_t>(rows);
+    size_t N = static_cast<C_t>(cols);
+
+    if(M == 0 || N == 0) {
+      return;
+    }
+
+    // only myself - no need to spawn another graph
+    if(sf._executor.num_workers() <= 1 || M == 1 || N == 1) {
+      for(size_t i=0; i<M; i++) {
+        for(size_t j=0; j<N; j++) {
+          callable(i, j);
+        }
+      }
+      return;
+    }
+
+    detail::Wavefront<F> grid(sf, callable, M, N);
+
+    grid.run(0, 0);
+
+    sf.join();
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
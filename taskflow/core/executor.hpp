@@ -61,6 +61,7 @@ class Executor {
 
     @param N number of workers (default std::thread::hardware_concurrency)
     @param wix worker interface class to alter worker (thread) behaviors
+    @param pool node pool to allocate asynchronous tasks from
     
     The constructor spawns @c N worker threads to run tasks in a
     work-stealing loop. The number of workers must be greater than zero
@@ -70,10 +71,14 @@ class Executor {
 
     Users can alter the worker behavior, such as changing thread affinity,
     via deriving an instance from tf::WorkerInterface.
+
+    If @c pool is @c nullptr, the executor creates a tf::NodePool of its own.
+    Several executors can share a pool by passing the same pointer.
     */
     explicit Executor(
       size_t N = std::thread::hardware_concurrency(),
-      std::shared_ptr<WorkerInterface> wix = nullptr 
+      std::shared_ptr<WorkerInterface> wix = nullptr,
+      std::shared_ptr<NodePool> pool = nullptr
     );
 
     /**
@@ -689,6 +694,31 @@ class Executor {
     */
     size_t num_observers() const noexcept;
 
+    /**
+    @brief returns the node pool of the executor
+
+    The executor allocates asynchronous tasks from this pool, and
+    a taskflow can select the same pool to keep the memory of a tenant
+    in one place.
+    The pool reports its memory usage and gives back empty blocks
+    on demand:
+
+    @code{.cpp}
+    tf::Executor executor;
+    tf::Taskflow taskflow(executor.node_pool());
+    // ... build and run the taskflow
+    std::cout << executor.node_pool().num_allocated_objects() << '/'
+              << executor.node_pool().capacity() << '\n';
+    taskflow.clear();
+    executor.node_pool().trim();  // release empty blocks
+    @endcode
+
+    Each worker caches a few free slots in front of the pool,
+    and they are counted as allocated until the worker exits.
+    A taskflow that selects this pool must not outlive it.
+    */
+    NodePool& node_pool() noexcept;
+
   private:
     const size_t _MAX_STEALS;
 
@@ -711,6 +741,7 @@ class Executor {
     std::atomic<bool> _done {0};
 
     std::shared_ptr<WorkerInterface> _worker_interface;
+    std::shared_ptr<NodePool> _node_pool;
     std::unordered_set<std::shared_ptr<ObserverInterface>> _observers;
 
     Worker* _this_worker();
@@ -728,7 +759,7 @@ class Executor {
     void _schedule(const SmallVector<Node*>&);
     void _set_up_topology(Worker*, Topology*);
     void _tear_down_topology(Worker&, Topology*);
-    void _tear_down_async(Node*);
+    void _tear_down_async(Worker&, Node*);
     void _tear_down_invoke(Worker&, Node*);
     void _cancel_invoke(Worker&, Node*);
     void _increment_topology();
@@ -739,6 +770,7 @@ class Executor {
     void _invoke_dynamic_task(Worker&, Node*);
     void _consume_graph(Worker&, Node*, Graph&);
     void _detach_dynamic_task(Worker&, Node*, Graph&);
+    NodePool& _subflow_pool(Node*, NodePool&);
     void _invoke_condition_task(Worker&, Node*, SmallVector<int>&);
     void _invoke_multi_condition_task(Worker&, Node*, SmallVector<int>&);
     void _invoke_module_task(Worker&, Node*);
@@ -751,6 +783,15 @@ class Executor {
     template <typename P>
     void _loop_until(Worker&, P&&);
 
+    template <typename C, typename... Cs>
+    void _parallel_invoke(Worker&, Node*, C&&, Cs&&...);
+
+    template <typename C, neo::enable_if_t<is_runtime_task<C>::value, void>* = nullptr>
+    static void _invoke_branch(Runtime&, C&);
+
+    template <typename C, neo::enable_if_t<!is_runtime_task<C>::value, void>* = nullptr>
+    static void _invoke_branch(Runtime&, C&);
+
     template <typename C, neo::enable_if_t<is_cudaflow_task<C>::value, void>* = nullptr>
     void _invoke_cudaflow_task_entry(Node*, C&&);
 
@@ -795,17 +836,24 @@ namespace detail {
 
 
 // Constructor
-inline Executor::Executor(size_t N, std::shared_ptr<WorkerInterface> wix) :
+inline Executor::Executor(
+  size_t N, std::shared_ptr<WorkerInterface> wix, std::shared_ptr<NodePool> pool
+) :
   _MAX_STEALS {((N+1) << 1)},
   _threads    {N},
   _workers    {N},
   _notifier   {N},
-  _worker_interface {std::move(wix)} {
+  _worker_interface {std::move(wix)},
+  _node_pool  {std::move(pool)} {
 
   if(N == 0) {
     TF_THROW("no cpu workers to execute taskflows");
   }
 
+  if(!_node_pool) {
+    _node_pool = std::make_shared<NodePool>(static_cast<unsigned>(N));
+  }
+
   _spawn(N);
 
   // instantite the default observer if requested
@@ -845,6 +893,11 @@ inline size_t Executor::num_taskflows() const {
   return _taskflows.size();
 }
 
+// Function: node_pool
+inline NodePool& Executor::node_pool() noexcept {
+  return *_node_pool;
+}
+
 // Function: _this_worker
 inline Worker* Executor::_this_worker() {
   auto itr = _wids.find(std::this_thread::get_id());
@@ -867,7 +920,15 @@ auto Executor::named_async(const std::string& name, F&& f, ArgsT&&... args) -> F
 
   Future<R> fu(p.get_future(), tpg);
 
-  auto node = node_pool().animate(
+  auto w = _this_worker();
+
+  // a worker allocates the node from its own cache without locking
+  auto node = w ? node_pool().animate(
+    w->_node_cache,
+    absl::in_place_type_t<Node::Async>{},
+    detail::AsyncWorker<R, F, ArgsT...>(std::move(p), std::forward<F>(f), args...),
+    std::move(tpg)
+  ) : node_pool().animate(
     absl::in_place_type_t<Node::Async>{},
     detail::AsyncWorker<R, F, ArgsT...>(std::move(p), std::forward<F>(f), args...),
     std::move(tpg)
@@ -875,7 +936,6 @@ auto Executor::named_async(const std::string& name, F&& f, ArgsT&&... args) -> F
 
   node->_name = name;
 
-  auto w = _this_worker();
   if(w) {
     _schedule(*w, node);
   }
@@ -901,14 +961,20 @@ void Executor::named_silent_async(
 
   _increment_topology();
 
-  Node* node = node_pool().animate(
+  auto w = _this_worker();
+
+  // a worker allocates the node from its own cache without locking
+  Node* node = w ? node_pool().animate(
+    w->_node_cache,
+    absl::in_place_type_t<Node::SilentAsync>{},
+    std::bind(std::forward<F>(f), args...)
+  ) : node_pool().animate(
     absl::in_place_type_t<Node::SilentAsync>{},
     std::bind(std::forward<F>(f), args...)
   );
 
   node->_name = name;
 
-  auto w = _this_worker();
   if(w) {
     _schedule(*w, node);
   }
@@ -989,6 +1055,9 @@ inline void Executor::_spawn(size_t N) {
         ptr = std::current_exception();
       }
       
+      // return the cached node slots to the pool
+      node_pool().flush(w._node_cache);
+      
       // call the user-specified epilogue function
       if(_worker_interface) {
         _worker_interface->scheduler_epilogue(w, ptr);
@@ -1050,6 +1119,70 @@ inline void Executor::_loop_until(Worker& w, P&& stop_predicate) {
   }
 }
 
+// Procedure: _parallel_invoke
+// runs the first callable on the calling worker and the others as runtime
+// tasks of nodes on the stack of the calling worker, which are children of
+// a dummy parent on the same stack rather than nodes of a graph
+template <typename C, typename... Cs>
+void Executor::_parallel_invoke(Worker& w, Node* p, C&& c, Cs&&... cs) {
+
+  constexpr size_t N = sizeof...(Cs);
+
+  Runtime rt(*this, w, p);
+
+  if(N == 0) {
+    _invoke_branch(rt, c);
+    return;
+  }
+
+  // dummy parent
+  Node join;
+
+  Node jobs[N + (N == 0)] = {
+    Node(
+      absl::in_place_type_t<Node::Runtime>{},
+      [&cs] (Runtime& r) { _invoke_branch(r, cs); }
+    )...
+  };
+
+  join._join_counter.store(N, std::memory_order_relaxed);
+
+  // the calling worker pops the jobs in the order of the callables, and
+  // thieves steal them from the back
+  for(size_t i=N; i-->0;) {
+    jobs[i]._topology = p->_topology;
+    jobs[i]._parent = &join;
+    _schedule(w, &jobs[i]);
+  }
+
+  auto done = [&join] () {
+    return join._join_counter.load(std::memory_order_acquire) == 0;
+  };
+
+  // the jobs must complete before they go out of scope
+  try {
+    _invoke_branch(rt, c);
+  }
+  catch(...) {
+    _loop_until(w, done);
+    throw;
+  }
+
+  _loop_until(w, done);
+}
+
+// Procedure: _invoke_branch
+template <typename C, neo::enable_if_t<is_runtime_task<C>::value, void>*>
+void Executor::_invoke_branch(Runtime& rt, C& c) {
+  c(rt);
+}
+
+// Procedure: _invoke_branch
+template <typename C, neo::enable_if_t<!is_runtime_task<C>::value, void>*>
+void Executor::_invoke_branch(Runtime&, C& c) {
+  c();
+}
+
 // Function: _explore_task
 inline void Executor::_explore_task(Worker& w, Node*& t) {
 
@@ -1391,7 +1524,7 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
     // async task
     case Node::ASYNC: {
       _invoke_async_task(worker, node);
-      _tear_down_async(node);
+      _tear_down_async(worker, node);
       return ;
     }
     break;
@@ -1399,7 +1532,7 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
     // silent async task
     case Node::SILENT_ASYNC: {
       _invoke_silent_async_task(worker, node);
-      _tear_down_async(node);
+      _tear_down_async(worker, node);
       return ;
     }
     break;
@@ -1516,14 +1649,14 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
 }
 
 // Procedure: _tear_down_async
-inline void Executor::_tear_down_async(Node* node) {
+inline void Executor::_tear_down_async(Worker& worker, Node* node) {
   if(node->_parent) {
     node->_parent->_join_counter.fetch_sub(1);
   }
   else {
     _decrement_topology_and_notify();
   }
-  node_pool().recycle(node);
+  node_pool().recycle(worker._node_cache, node);
 }
 
 // Proecdure: _tear_down_invoke
@@ -1548,12 +1681,12 @@ inline void Executor::_cancel_invoke(Worker& worker, Node* node) {
     // async task needs to carry out the promise
     case Node::ASYNC:
       absl::get_if<Node::Async>(&(node->_handle))->work(true);
-      _tear_down_async(node);
+      _tear_down_async(worker, node);
     break;
 
     // silent async doesn't need to carry out the promise
     case Node::SILENT_ASYNC:
-      _tear_down_async(node);
+      _tear_down_async(worker, node);
     break;
 
     // tear down topology if the node is the last leaf
@@ -1593,6 +1726,7 @@ inline void Executor::_invoke_dynamic_task(Worker& w, Node* node) {
   auto handle = absl::get_if<Node::Dynamic>(&node->_handle);
 
   handle->subgraph._clear();
+  handle->subgraph._pool = &_subflow_pool(node, *handle->subgraph._pool);
 
   Subflow sf(*this, w, node, handle->subgraph);
 
@@ -1638,6 +1772,15 @@ inline void Executor::_detach_dynamic_task(
   _schedule(w, src);
 }
 
+// Function: _subflow_pool
+// returns the pool of the subflow graphs spawned by a node: a detached
+// subflow is merged into the running taskflow, so its nodes are animated
+// from the pool of that taskflow, while a node without a topology, such as
+// one of a graph run by run_and_wait, cannot detach and keeps the given pool
+inline NodePool& Executor::_subflow_pool(Node* node, NodePool& pool) {
+  return node->_topology ? *node->_topology->_taskflow._graph._pool : pool;
+}
+
 // Procedure: _consume_graph
 inline void Executor::_consume_graph(Worker& w, Node* p, Graph& g) {
 
@@ -2048,7 +2191,7 @@ auto Subflow::named_async(const std::string& name, F&& f, ArgsT&&... args) -> Fu
 template <typename F, typename... ArgsT>
 auto Subflow::_named_async(
   Worker& w,
-  const std::string& name,
+  const TaskName& name,
   F&& f,
   ArgsT&&... args
 ) -> Future<neo::FRet<F, ArgsT...>>
@@ -2065,7 +2208,8 @@ auto Subflow::_named_async(
 
   Future<R> fu(p.get_future(), tpg);
 
-  auto node = node_pool().animate(
+  auto node = _executor.node_pool().animate(
+    w._node_cache,
     absl::in_place_type_t<Node::Async>{},
     detail::AsyncWorker<R, F, ArgsT...>(std::move(p), std::forward<F>(f), args...),
     std::move(tpg)
@@ -2090,12 +2234,13 @@ auto Subflow::async(F&& f, ArgsT&&... args) -> Future<neo::FRet<F, ArgsT...>>
 // Function: _named_silent_async
 template <typename F, typename... ArgsT>
 void Subflow::_named_silent_async(
-  Worker& w, const std::string& name, F&& f, ArgsT&&... args
+  Worker& w, const TaskName& name, F&& f, ArgsT&&... args
 ) {
 
   _parent->_join_counter.fetch_add(1);
 
-  auto node = node_pool().animate(
+  auto node = _executor.node_pool().animate(
+    w._node_cache,
     absl::in_place_type_t<Node::SilentAsync>{},
     std::bind(std::forward<F>(f), args...)
   );
@@ -2107,6 +2252,12 @@ void Subflow::_named_silent_async(
   _executor._schedule(w, node);
 }
 
+// Procedure: parallel_invoke
+template <typename... Cs>
+void Subflow::parallel_invoke(Cs&&... callables) {
+  _executor._parallel_invoke(_worker, _parent, std::forward<Cs>(callables)...);
+}
+
 // Function: silent_async
 template <typename F, typename... ArgsT>
 void Subflow::named_silent_async(const std::string& name, F&& f, ArgsT&&... args) {
@@ -2137,7 +2288,7 @@ inline void Runtime::schedule(Task task) {
 // Procedure: emplace
 template <typename T, neo::enable_if_t<is_dynamic_task<T>::value>*>
 void Runtime::run_and_wait(T&& target) {
-    Graph graph;
+    Graph graph(_executor._subflow_pool(_parent, _executor.node_pool()));
     Subflow sf(_executor, _worker, _parent, graph);
     target(sf);
     if(sf._joinable) {
@@ -2151,6 +2302,12 @@ void Runtime::run_and_wait(T&& target) {
     _executor._consume_graph(_worker, _parent, target.graph());
 }
 
+// Procedure: parallel_invoke
+template <typename... Cs>
+void Runtime::parallel_invoke(Cs&&... callables) {
+  _executor._parallel_invoke(_worker, _parent, std::forward<Cs>(callables)...);
+}
+
 }  // end of namespace tf -----------------------------------------------------
 
 
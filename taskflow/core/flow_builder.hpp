@@ -1,6 +1,7 @@
 #pragma once
 
 #include "task.hpp"
+#include "../algorithm/partitioner.hpp"
 
 /**
 @file flow_builder.hpp
@@ -465,10 +466,12 @@ class FlowBuilder {
     @tparam B beginning iterator type
     @tparam E ending iterator type
     @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
 
     @param first iterator to the beginning (inclusive)
     @param last iterator to the end (exclusive)
     @param callable a callable object to apply to the dereferenced iterator
+    @param part partitioning algorithm to schedule parallel iterations
 
     @return a tf::Task handle
 
@@ -488,8 +491,8 @@ class FlowBuilder {
 
     Please refer to @ref ParallelIterations for details.
     */
-    template <typename B, typename E, typename C>
-    Task for_each(B first, E last, C callable);
+    template <typename B, typename E, typename C, typename P = DefaultPartitioner>
+    Task for_each(B first, E last, C callable, P part = P());
 
     /**
     @brief constructs a parallel-transform task
@@ -498,11 +501,13 @@ class FlowBuilder {
     @tparam E ending index type (must be integral)
     @tparam S step type (must be integral)
     @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
 
     @param first index of the beginning (inclusive)
     @param last index of the end (exclusive)
     @param step step size
     @param callable a callable object to apply to each valid index
+    @param part partitioning algorithm to schedule parallel iterations
 
     @return a tf::Task handle
 
@@ -510,217 +515,2013 @@ class FlowBuilder {
     in the range <tt>[first, last)</tt> with the step size.
     This method is equivalent to the parallel execution of the following loop:
 
-    @code{.cpp}
-    // case 1: step size is positive
-    for(auto i=first; i<last; i+=step) {
-      callable(i);
-    }
+    @code{.cpp}
+    // case 1: step size is positive
+    for(auto i=first; i<last; i+=step) {
+      callable(i);
+    }
+
+    // case 2: step size is negative
+    for(auto i=first, i>last; i+=step) {
+      callable(i);
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+    The callable needs to take a single argument of the integral index type.
+
+    Please refer to @ref ParallelIterations for details.
+    */
+    template <typename B, typename E, typename S, typename C, typename P = DefaultPartitioner>
+    Task for_each_index(B first, E last, S step, C callable, P part = P());
+
+    /**
+    @brief constructs a parallel-for task over the tiles of a multi-dimensional index range
+
+    @tparam R index range type (tf::IndexRange2D or tf::IndexRange3D)
+    @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param range box of indices split into tiles
+    @param callable a callable object to apply to each tile of the range
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that invokes the callable once per tile of
+    the range with the tile as an index range of the same type.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto& tile : tiles(range)) {
+      callable(tile);
+    }
+    @endcode
+
+    The partitioner splits the tiles into chunks in the order of recursive
+    bisection of the box along its longest dimension,
+    such that the tiles of a chunk, and hence of a worker, form a compact
+    block which shares rows and columns in the cache.
+    The chunk size of the partitioner counts tiles.
+
+    @code{.cpp}
+    tf::IndexRange2D<int> range({0, 0}, {N, N}, {64, 64});
+    taskflow.for_each_index(range, [&](const tf::IndexRange2D<int>& tile){
+      for(int i=tile.begin(0); i<tile.end(0); i++) {
+        for(int j=tile.begin(1); j<tile.end(1); j++) {
+          c[i][j] = a[i][j] + b[i][j];
+        }
+      }
+    });
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelIterations for details.
+    */
+    template <typename R, typename C, typename P = DefaultPartitioner>
+    Task for_each_index(R range, C callable, P part = P());
+
+    /**
+    @brief constructs a parallel-for task over chunks of a range
+
+    @tparam B beginning iterator or index type
+    @tparam E ending iterator or index type
+    @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first iterator (or index) to the beginning (inclusive)
+    @param last iterator (or index) to the end (exclusive)
+    @param callable a callable object to apply to each chunk of the range
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that splits the range <tt>[first, last)</tt>
+    into contiguous chunks using the partitioner and invokes the callable
+    once per chunk with its sub-range <tt>[chunk_first, chunk_last)</tt>,
+    which lets the callable amortize per-chunk setup such as
+    allocating a buffer or a vectorized loop prologue.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto& chunk : partition(first, last)) {
+      callable(chunk.first, chunk.last);
+    }
+    @endcode
+
+    The callable may take a third argument of type @c size_t,
+    the index of the worker that runs the chunk in
+    <tt>[0, num_workers)</tt>.
+    No two chunks with the same worker index run at the same time,
+    such that the index can select a per-worker buffer without locking.
+
+    @code{.cpp}
+    std::vector<std::vector<float>> buffers(executor.num_workers());
+    taskflow.for_each_range(size_t{0}, N, [&](size_t beg, size_t end, size_t w){
+      auto& buffer = buffers[w];
+      buffer.resize(end - beg);
+      kernel(beg, end, buffer.data());
+    });
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelIterations for details.
+    */
+    template <typename B, typename E, typename C, typename P = DefaultPartitioner>
+    Task for_each_range(B first, E last, C callable, P part = P());
+
+    // ------------------------------------------------------------------------
+    // transform
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a parallel-transform task
+
+    @tparam B beginning input iterator type
+    @tparam E ending input iterator type
+    @tparam O output iterator type
+    @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first1 iterator to the beginning of the first range
+    @param last1 iterator to the end of the first range
+    @param d_first iterator to the beginning of the output range
+    @param c an unary callable to apply to dereferenced input elements
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that applies the callable object to an
+    input range and stores the result in another output range.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    while (first1 != last1) {
+      *d_first++ = c(*first1++);
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+    The callable needs to take a single argument of the dereferenced
+    iterator type.
+    */
+    template <typename B, typename E, typename O, typename C, typename P = DefaultPartitioner,
+      neo::enable_if_t<is_partitioner<neo::decay_t<P>>::value, void>* = nullptr
+    >
+    Task transform(B first1, E last1, O d_first, C c, P part = P());
+
+    /**
+    @brief constructs a parallel-transform task
+
+    @tparam B1 beginning input iterator type for the first input range
+    @tparam E1 ending input iterator type for the first input range
+    @tparam B2 beginning input iterator type for the first second range
+    @tparam O output iterator type
+    @tparam C callable type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first1 iterator to the beginning of the first input range
+    @param last1 iterator to the end of the first input range
+    @param first2 iterator to the beginning of the second input range
+    @param d_first iterator to the beginning of the output range
+    @param c a binary operator to apply to dereferenced input elements
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that applies the callable object to two
+    input ranges and stores the result in another output range.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    while (first1 != last1) {
+      *d_first++ = c(*first1++, *first2++);
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+    The callable needs to take two arguments of dereferenced elements
+    from the two input ranges.
+    */
+    template <typename B1, typename E1, typename B2, typename O, typename C,
+      typename P = DefaultPartitioner,
+      neo::enable_if_t<!is_partitioner<neo::decay_t<C>>::value, void>* = nullptr
+    >
+    Task transform(B1 first1, E1 last1, B2 first2, O d_first, C c, P part = P());
+
+    // ------------------------------------------------------------------------
+    // reduction
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a STL-styled parallel-reduce task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T result type
+    @tparam O binary reducer type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param init initial value of the reduction and the storage for the reduced result
+    @param bop binary operator that will be applied
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow to perform parallel reduction over @c init
+    and the elements in the range <tt>[first, last)</tt>.
+    The reduced result is store in @c init.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      init = bop(init, *itr);
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Sums and products of arithmetic elements of type @c T, stored in an array
+    or a std::vector and reduced with std::plus or std::multiplies,
+    run through a vectorized kernel.
+
+    Please refer to @ref ParallelReduction for details.
+    */
+    template <typename B, typename E, typename T, typename O, typename P = DefaultPartitioner>
+    Task reduce(B first, E last, T& init, O bop, P part = P());
+
+    // ------------------------------------------------------------------------
+    // transfrom and reduction
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a STL-styled parallel transform-reduce task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T result type
+    @tparam BOP binary reducer type
+    @tparam UOP unary transformion type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param init initial value of the reduction and the storage for the reduced result
+    @param bop binary operator that will be applied in unspecified order to the results of @c uop
+    @param uop unary operator that will be applied to transform each element in the range to the result type
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow to perform parallel reduction over @c init and
+    the transformed elements in the range <tt>[first, last)</tt>.
+    The reduced result is store in @c init.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      init = bop(init, uop(*itr));
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Sums and products of arithmetic elements stored in an array or
+    a std::vector and transformed to the arithmetic type @c T,
+    reduced with std::plus or std::multiplies, run through a vectorized kernel.
+
+    Please refer to @ref ParallelReduction for details.
+    */
+    template <typename B, typename E, typename T, typename BOP, typename UOP,
+      typename P = DefaultPartitioner
+    >
+    Task transform_reduce(B first, E last, T& init, BOP bop, UOP uop, P part = P());
+
+    // ------------------------------------------------------------------------
+    // reduction by key
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a parallel-histogram task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam H bins type (random-accessible container of counts)
+    @tparam KOP key operator type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param bins counts of the <tt>bins.size()</tt> keys, which the task adds to
+    @param key unary operator that maps each element to its key in <tt>[0, bins.size())</tt>
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that counts the elements in the range
+    <tt>[first, last)</tt> of each key.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      bins[key(*itr)]++;
+    }
+    @endcode
+
+    Workers count their elements in private bins which they then merge
+    in parallel, or, if the private bins would outnumber the elements,
+    pass each element to the worker that owns its range of keys.
+    Either way, workers never contend for a bin.
+    Different workers may write different bins concurrently.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelReduction for details.
+    */
+    template <typename B, typename E, typename H, typename KOP,
+      typename P = DefaultPartitioner
+    >
+    Task histogram(B first, E last, H& bins, KOP key, P part = P());
+
+    /**
+    @brief constructs a parallel reduce-by-key task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam R result type (random-accessible container)
+    @tparam KOP key operator type
+    @tparam BOP binary reducer type
+    @tparam UOP unary transformion type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param result initial values and storage of the reduced results of the <tt>result.size()</tt> keys
+    @param key unary operator that maps each element to its key in <tt>[0, result.size())</tt>
+    @param bop binary operator that will be applied in unspecified order to the results of @c uop of the same key
+    @param uop unary operator that will be applied to transform each element in the range to the result type
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that reduces the transformed elements
+    in the range <tt>[first, last)</tt> of each key into the result
+    of that key.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      result[key(*itr)] = bop(result[key(*itr)], uop(*itr));
+    }
+    @endcode
+
+    Workers reduce their elements in private bins which they then merge
+    in parallel, or, if the private bins would outnumber the elements,
+    pass each transformed element to the worker that owns its range of keys.
+    Either way, workers never contend for a result.
+    Different workers may write different results concurrently.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelReduction for details.
+    */
+    template <typename B, typename E, typename R, typename KOP,
+      typename BOP, typename UOP, typename P = DefaultPartitioner
+    >
+    Task reduce_by_key(
+      B first, E last, R& result, KOP key, BOP bop, UOP uop, P part = P()
+    );
+
+    // ------------------------------------------------------------------------
+    // segmented reduction and scan
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a parallel segmented-reduce task
+
+    @tparam B iterator type of the values (random-accessible)
+    @tparam OB beginning iterator type of the offsets (random-accessible)
+    @tparam OE ending iterator type of the offsets
+    @tparam D iterator type of the output (random-accessible)
+    @tparam BOP binary reducer type
+
+    @param values start of the range of values
+    @param offsets_first start of the range of segment offsets
+    @param offsets_last end of the range of segment offsets
+    @param d_first start of the range of the reduced results, one per segment
+    @param bop binary operator that will be applied in order to the values
+               of each segment
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that reduces each of the
+    <tt>S = (offsets_last - offsets_first) - 1</tt> segments of the values,
+    where segment @c s holds the values in
+    <tt>[values + offsets_first[s], values + offsets_first[s+1])</tt>,
+    into <tt>d_first[s]</tt>, and leaves the result of an empty segment
+    untouched.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(size_t s=0; s<S; s++) {
+      auto b = values + offsets_first[s];
+      auto e = values + offsets_first[s+1];
+      if(b != e) {
+        d_first[s] = std::accumulate(std::next(b), e, *b, bop);
+      }
+    }
+    @endcode
+
+    The workers split the values into blocks of equal size,
+    such that a long segment spreads over several workers and
+    many short segments fall into one block,
+    and the partial results of the segments that cross blocks are
+    combined in order.
+    The operator @c bop must be associative.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSegmentedReduction for details.
+    */
+    template <typename B, typename OB, typename OE, typename D, typename BOP>
+    Task segmented_reduce(
+      B values, OB offsets_first, OE offsets_last, D d_first, BOP bop
+    );
+
+    /**
+    @brief constructs a parallel segmented-reduce task with an initial value
+
+    @tparam B iterator type of the values (random-accessible)
+    @tparam OB beginning iterator type of the offsets (random-accessible)
+    @tparam OE ending iterator type of the offsets
+    @tparam D iterator type of the output (random-accessible)
+    @tparam T initial value type
+    @tparam BOP binary reducer type
+
+    @param values start of the range of values
+    @param offsets_first start of the range of segment offsets
+    @param offsets_last end of the range of segment offsets
+    @param d_first start of the range of the reduced results, one per segment
+    @param init initial value of every segment
+    @param bop binary operator that will be applied in order to the values
+               of each segment
+
+    @return a tf::Task handle
+
+    The task is the same as
+    tf::FlowBuilder::segmented_reduce(B, OB, OE, D, BOP) except that
+    the reduction of each segment starts from @c init,
+    such that the result of an empty segment is @c init:
+
+    @code{.cpp}
+    for(size_t s=0; s<S; s++) {
+      d_first[s] = std::accumulate(
+        values + offsets_first[s], values + offsets_first[s+1], init, bop
+      );
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSegmentedReduction for details.
+    */
+    template <typename B, typename OB, typename OE, typename D, typename T,
+      typename BOP
+    >
+    Task segmented_reduce(
+      B values, OB offsets_first, OE offsets_last, D d_first, T init, BOP bop
+    );
+
+    /**
+    @brief constructs a parallel segmented inclusive-scan task
+
+    @tparam B iterator type of the values (random-accessible)
+    @tparam OB beginning iterator type of the offsets (random-accessible)
+    @tparam OE ending iterator type of the offsets
+    @tparam D iterator type of the output (random-accessible)
+    @tparam BOP binary operator type
+
+    @param values start of the range of values
+    @param offsets_first start of the range of segment offsets
+    @param offsets_last end of the range of segment offsets
+    @param d_first start of the output range, whose @c i-th element
+                   holds the scan of the @c i-th value
+    @param bop binary operator that will be applied in order to the values
+               of each segment
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that computes the inclusive scan of each of the
+    <tt>S = (offsets_last - offsets_first) - 1</tt> segments of the values
+    independently, as std::inclusive_scan, and writes the scan of
+    <tt>values[i]</tt> to <tt>d_first[i]</tt> for all @c i in
+    <tt>[offsets_first[0], offsets_first[S])</tt>.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(size_t s=0; s<S; s++) {
+      std::inclusive_scan(
+        values + offsets_first[s], values + offsets_first[s+1],
+        d_first + offsets_first[s], bop
+      );
+    }
+    @endcode
+
+    The workers split the values into blocks of equal size
+    and scan each part of a segment that crosses blocks from its first
+    element in the block, before they add the prefix of the part.
+    The scan can run in place, with @c d_first equal to @c values.
+    The operator @c bop must be associative.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSegmentedReduction for details.
+    */
+    template <typename B, typename OB, typename OE, typename D, typename BOP>
+    Task segmented_inclusive_scan(
+      B values, OB offsets_first, OE offsets_last, D d_first, BOP bop
+    );
+
+    /**
+    @brief constructs a parallel segmented inclusive-scan task with
+           an initial value
+
+    @tparam B iterator type of the values (random-accessible)
+    @tparam OB beginning iterator type of the offsets (random-accessible)
+    @tparam OE ending iterator type of the offsets
+    @tparam D iterator type of the output (random-accessible)
+    @tparam BOP binary operator type
+    @tparam T initial value type
+
+    @param values start of the range of values
+    @param offsets_first start of the range of segment offsets
+    @param offsets_last end of the range of segment offsets
+    @param d_first start of the output range, whose @c i-th element
+                   holds the scan of the @c i-th value
+    @param bop binary operator that will be applied in order to the values
+               of each segment
+    @param init initial value of the scan of every segment
+
+    @return a tf::Task handle
+
+    The task is the same as
+    tf::FlowBuilder::segmented_inclusive_scan(B, OB, OE, D, BOP) except that
+    the scan of each segment starts from @c init.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSegmentedReduction for details.
+    */
+    template <typename B, typename OB, typename OE, typename D, typename BOP,
+      typename T
+    >
+    Task segmented_inclusive_scan(
+      B values, OB offsets_first, OE offsets_last, D d_first, BOP bop, T init
+    );
+
+    // ------------------------------------------------------------------------
+    // sort
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel sort
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param cmp comparison function object
+
+    The task spawns a subflow to parallelly sort elements in the range
+    <tt>[first, last)</tt>.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename C>
+    Task sort(B first, E last, C cmp);
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel sort using
+           the @c std::less<T> comparator, where @c T is the element type
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+
+    The task spawns a subflow to parallelly sort elements in the range
+    <tt>[first, last)</tt> using the @c std::less<T> comparator,
+    where @c T is the dereferenced iterator type.
+    Integral and floating-point elements are sorted by
+    tf::FlowBuilder::radix_sort.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+     */
+    template <typename B, typename E>
+    Task sort(B first, E last);
+
+    /**
+    @brief constructs a dynamic task to perform parallel radix sort
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+
+    The task spawns a subflow to sort the integral or floating-point keys
+    in the range <tt>[first, last)</tt> in increasing order,
+    by one pass of per-worker digit counts and a parallel scatter
+    per key byte.
+    The task allocates a temporary buffer of <tt>last - first</tt> keys.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E>
+    Task radix_sort(B first, E last);
+
+    /**
+    @brief constructs a dynamic task to perform parallel sort of
+           values by their keys
+
+    @tparam KB beginning key iterator type (random-accessible)
+    @tparam KE ending key iterator type (random-accessible)
+    @tparam V beginning value iterator type (random-accessible)
+
+    @param k_first iterator to the beginning of the keys (inclusive)
+    @param k_last iterator to the end of the keys (exclusive)
+    @param v_first iterator to the beginning of the values
+
+    The task spawns a subflow to sort the keys in the range
+    <tt>[k_first, k_last)</tt> in increasing order, and the values
+    starting at @c v_first in the same order as their keys.
+    The sort is stable.
+    Integral and floating-point keys are sorted by radix sort,
+    and other keys by tf::FlowBuilder::sort_by_key(KB, KE, V, C)
+    using the @c std::less<K> comparator.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename KB, typename KE, typename V>
+    Task sort_by_key(KB k_first, KE k_last, V v_first);
+
+    /**
+    @brief constructs a dynamic task to perform parallel sort of
+           values by their keys using a custom comparator
+
+    @tparam KB beginning key iterator type (random-accessible)
+    @tparam KE ending key iterator type (random-accessible)
+    @tparam V beginning value iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param k_first iterator to the beginning of the keys (inclusive)
+    @param k_last iterator to the end of the keys (exclusive)
+    @param v_first iterator to the beginning of the values
+    @param comp comparison function object of two keys
+
+    The task spawns a subflow to sort the keys in the range
+    <tt>[k_first, k_last)</tt> using the comparator @c comp,
+    and the values starting at @c v_first in the same order as their keys.
+    The sort is stable.
+    The keys and values must be default-constructible.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename KB, typename KE, typename V, typename C>
+    Task sort_by_key(KB k_first, KE k_last, V v_first, C comp);
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel stable sort
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param cmp comparison function object
+
+    The task spawns a subflow to parallelly sort elements in the range
+    <tt>[first, last)</tt> with a merge sort that preserves the relative
+    order of equivalent elements.
+    The task allocates a temporary buffer of <tt>last - first</tt> elements,
+    which requires the element type to be default-constructible.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename C>
+    Task stable_sort(B first, E last, C cmp);
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel stable sort
+           using the @c std::less<T> comparator, where @c T is the element type
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+
+    The task spawns a subflow to parallelly sort elements in the range
+    <tt>[first, last)</tt> using the @c std::less<T> comparator,
+    where @c T is the dereferenced iterator type,
+    preserving the relative order of equivalent elements.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E>
+    Task stable_sort(B first, E last);
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel stable sort
+           using a caller-provided scratch buffer
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam C comparator type
+    @tparam S scratch iterator type (random-accessible)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param cmp comparison function object
+    @param buffer iterator to the beginning of a scratch range of at least
+                  <tt>last - first</tt> elements
+
+    The task is the same as tf::FlowBuilder::stable_sort(B, E, C) except
+    it merges through the scratch range <tt>[buffer, buffer + (last - first))</tt>
+    instead of allocating its own, such that repeated sorts can reuse
+    the same memory.
+    The content of the scratch range is unspecified after the sort.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename C, typename S>
+    Task stable_sort(B first, E last, C cmp, S buffer);
+
+    // ------------------------------------------------------------------------
+    // merge
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel merge
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param comp comparison function object
+
+    The task spawns a subflow to merge the two sorted ranges
+    <tt>[first1, last1)</tt> and <tt>[first2, last2)</tt> into
+    the output range starting at @c d_first.
+    Each worker computes the split of its own part of the output
+    by binary search, such that the merge is stable as std::merge:
+    equivalent elements of the first range come first.
+    The output range must not overlap either input range.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename C
+    >
+    Task merge(B1 first1, E1 last1, B2 first2, E2 last2, O d_first, C comp);
+
+    /**
+    @brief constructs a dynamic task to perform STL-styled parallel merge
+           using the @c std::less<T> comparator, where @c T is the element type
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type (random-accessible)
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+
+    The task is the same as tf::FlowBuilder::merge(B1, E1, B2, E2, O, C)
+    using the @c std::less<T> comparator.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O>
+    Task merge(B1 first1, E1 last1, B2 first2, E2 last2, O d_first);
+
+    // ------------------------------------------------------------------------
+    // scan
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs an STL-styled parallel inclusive-scan task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam BOP binary operator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param bop binary operator
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that computes the inclusive prefix sums of
+    the input range under the associative binary operator and
+    stores them in the output range.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    auto sum = *first;
+    *d_first++ = sum;
+    for(auto itr=std::next(first); itr!=last; itr++) {
+      sum = bop(sum, *itr);
+      *d_first++ = sum;
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename BOP>
+    Task inclusive_scan(B first, E last, D d_first, BOP bop);
+
+    /**
+    @brief constructs an STL-styled parallel inclusive-scan task
+           with an initial value
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam BOP binary operator type
+    @tparam T initial value type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param bop binary operator
+    @param init initial value
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that computes the inclusive prefix sums of
+    the input range, starting from the initial value, under the
+    associative binary operator and stores them in the output range.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      init = bop(init, *itr);
+      *d_first++ = init;
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename BOP, typename T>
+    Task inclusive_scan(B first, E last, D d_first, BOP bop, T init);
+
+    /**
+    @brief constructs an STL-styled parallel exclusive-scan task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam T initial value type
+    @tparam BOP binary operator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param init initial value
+    @param bop binary operator
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that computes the exclusive prefix sums of
+    the input range, starting from the initial value, under the
+    associative binary operator and stores them in the output range.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      auto v = *itr;
+      *d_first++ = init;
+      init = bop(init, v);
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename T, typename BOP>
+    Task exclusive_scan(B first, E last, D d_first, T init, BOP bop);
+
+    /**
+    @brief constructs an STL-styled parallel transform-inclusive-scan task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam BOP binary operator type
+    @tparam UOP unary operator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param bop binary operator
+    @param uop unary operator
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that transforms each element of the input range
+    by the unary operator and computes the inclusive prefix sums of
+    the transformed elements under the associative binary operator.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    auto sum = uop(*first);
+    *d_first++ = sum;
+    for(auto itr=std::next(first); itr!=last; itr++) {
+      sum = bop(sum, uop(*itr));
+      *d_first++ = sum;
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename BOP, typename UOP>
+    Task transform_inclusive_scan(B first, E last, D d_first, BOP bop, UOP uop);
+
+    /**
+    @brief constructs an STL-styled parallel transform-inclusive-scan task
+           with an initial value
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam BOP binary operator type
+    @tparam UOP unary operator type
+    @tparam T initial value type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param bop binary operator
+    @param uop unary operator
+    @param init initial value
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that transforms each element of the input range
+    by the unary operator and computes the inclusive prefix sums of
+    the transformed elements, starting from the initial value,
+    under the associative binary operator.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      init = bop(init, uop(*itr));
+      *d_first++ = init;
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename BOP, typename UOP, typename T>
+    Task transform_inclusive_scan(B first, E last, D d_first, BOP bop, UOP uop, T init);
+
+    /**
+    @brief constructs an STL-styled parallel transform-exclusive-scan task
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam D destination iterator type
+    @tparam T initial value type
+    @tparam BOP binary operator type
+    @tparam UOP unary operator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range (may be the same as @c first)
+    @param init initial value
+    @param bop binary operator
+    @param uop unary operator
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that transforms each element of the input range
+    by the unary operator and computes the exclusive prefix sums of
+    the transformed elements, starting from the initial value,
+    under the associative binary operator.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      auto v = uop(*itr);
+      *d_first++ = init;
+      init = bop(init, v);
+    }
+    @endcode
+
+    The scan runs in place if @c d_first is equal to @c first.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelScan for details.
+    */
+    template <typename B, typename E, typename D, typename T, typename BOP, typename UOP>
+    Task transform_exclusive_scan(B first, E last, D d_first, T init, BOP bop, UOP uop);
+
+    // ------------------------------------------------------------------------
+    // find
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a task to perform STL-styled find-if algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the found element in the input range
+    @param predicate unary predicate which returns @c true for the required element
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that finds the first element in the range
+    <tt>[first, last)</tt> for which the predicate returns @c true
+    and stores the iterator to it, or @c last if there is no such element,
+    in @c result.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    result = last;
+    for(auto itr=first; itr!=last; itr++) {
+      if(predicate(*itr)) {
+        result = itr;
+        break;
+      }
+    }
+    @endcode
+
+    Workers share the index of the first match found so far and
+    abandon the elements beyond it,
+    such that the work is about proportional to the position of the match.
+    The predicate may hence not be applied to every element.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelFind for details.
+    */
+    template <typename B, typename E, typename T, typename UOP, typename P = DefaultPartitioner>
+    Task find_if(B first, E last, T& result, UOP predicate, P part = P());
+
+    /**
+    @brief constructs a task to perform STL-styled find-if-not algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the found element in the input range
+    @param predicate unary predicate which returns @c false for the required element
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that finds the first element in the range
+    <tt>[first, last)</tt> for which the predicate returns @c false
+    and stores the iterator to it, or @c last if there is no such element,
+    in @c result.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    result = last;
+    for(auto itr=first; itr!=last; itr++) {
+      if(!predicate(*itr)) {
+        result = itr;
+        break;
+      }
+    }
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelFind for details.
+    */
+    template <typename B, typename E, typename T, typename UOP, typename P = DefaultPartitioner>
+    Task find_if_not(B first, E last, T& result, UOP predicate, P part = P());
+
+    /**
+    @brief constructs a task to perform STL-styled min-element algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam C comparator type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the smallest element in the input range
+    @param comp comparison function object
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that finds the smallest element in the range
+    <tt>[first, last)</tt> using the comparison function object
+    and stores the iterator to it in @c result.
+    If several elements are equivalent to the smallest element,
+    the iterator to the first such element is stored,
+    and @c last is stored if the range is empty.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    if(first == last) {
+      result = last;
+      return;
+    }
+    auto smallest = first;
+    for(++first; first != last; ++first) {
+      if(comp(*first, *smallest)) {
+        smallest = first;
+      }
+    }
+    result = smallest;
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelFind for details.
+    */
+    template <typename B, typename E, typename T, typename C, typename P = DefaultPartitioner>
+    Task min_element(B first, E last, T& result, C comp, P part = P());
+
+    /**
+    @brief constructs a task to perform STL-styled max-element algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam C comparator type
+    @tparam P partitioner type (default tf::DefaultPartitioner)
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the largest element in the input range
+    @param comp comparison function object
+    @param part partitioning algorithm to schedule parallel iterations
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that finds the largest element in the range
+    <tt>[first, last)</tt> using the comparison function object
+    and stores the iterator to it in @c result.
+    If several elements are equivalent to the largest element,
+    the iterator to the first such element is stored,
+    and @c last is stored if the range is empty.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    if(first == last) {
+      result = last;
+      return;
+    }
+    auto largest = first;
+    for(++first; first != last; ++first) {
+      if(comp(*largest, *first)) {
+        largest = first;
+      }
+    }
+    result = largest;
+    @endcode
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelFind for details.
+    */
+    template <typename B, typename E, typename T, typename C, typename P = DefaultPartitioner>
+    Task max_element(B first, E last, T& result, C comp, P part = P());
+
+    // ------------------------------------------------------------------------
+    // partition
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a task to perform STL-styled parallel copy-if algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam O output iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param d_first start of the output range
+    @param result resulting iterator to the end of the copied elements
+    @param predicate unary predicate which returns @c true for the elements to copy
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that copies the elements in the range
+    <tt>[first, last)</tt> for which the predicate returns @c true
+    to the output range starting at @c d_first, in their order,
+    and stores the iterator past the last copied element in @c result.
+    This method is equivalent to the parallel execution of the following loop:
+
+    @code{.cpp}
+    result = d_first;
+    for(auto itr=first; itr!=last; itr++) {
+      if(predicate(*itr)) {
+        *result++ = *itr;
+      }
+    }
+    @endcode
+
+    The workers count the elements to copy in their blocks before they
+    copy them, such that the predicate is applied twice to every element.
+    The output range must not overlap the input range.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelPartition for details.
+    */
+    template <typename B, typename E, typename O, typename T, typename UOP>
+    Task copy_if(B first, E last, O d_first, T& result, UOP predicate);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel remove-if algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the new end of the range
+    @param predicate unary predicate which returns @c true for the elements to remove
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that moves the elements in the range
+    <tt>[first, last)</tt> for which the predicate returns @c false
+    to the beginning of the range, in their order, as std::remove_if,
+    and stores the new end of the range in @c result.
+    The elements beyond the new end are left in a valid but unspecified state.
+    The task moves the kept elements through a temporary buffer,
+    which requires the element type to be default-constructible.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelPartition for details.
+    */
+    template <typename B, typename E, typename T, typename UOP>
+    Task remove_if(B first, E last, T& result, UOP predicate);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel partition algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the first element of the second group
+    @param predicate unary predicate which returns @c true for the elements
+                     of the first group
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that reorders the elements in the range
+    <tt>[first, last)</tt> such that the elements for which the predicate
+    returns @c true precede the others, as std::partition,
+    and stores the iterator to the first element of the second group
+    in @c result.
+    The task swaps the elements in place, and the relative order of
+    the elements is not preserved.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelPartition for details.
+    */
+    template <typename B, typename E, typename T, typename UOP>
+    Task partition(B first, E last, T& result, UOP predicate);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel stable-partition
+           algorithm
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+    @tparam UOP unary predicate type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the first element of the second group
+    @param predicate unary predicate which returns @c true for the elements
+                     of the first group
+
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::partition except that
+    the relative order of the elements in each group is preserved,
+    as std::stable_partition.
+    The task moves the elements through a temporary buffer,
+    which requires the element type to be default-constructible.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelPartition for details.
+    */
+    template <typename B, typename E, typename T, typename UOP>
+    Task stable_partition(B first, E last, T& result, UOP predicate);
+
+    // ------------------------------------------------------------------------
+    // set operations
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a task to perform STL-styled parallel set-intersection algorithm
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type
+    @tparam T resulting iterator type
+    @tparam C comparator type
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param result resulting iterator to the end of the output range
+    @param comp comparison function object
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that
+    copies the elements of the sorted range <tt>[first1, last1)</tt>
+    that are also found in the sorted range <tt>[first2, last2)</tt>
+    to the output range starting at @c d_first,
+    and stores the iterator past the last output element in @c result.
+    The output is the same as that of std::set_intersection,
+    where an element found @c m times in the first range
+    and @c n times in the second range is copied from the first range
+    <tt>std::min(m, n)</tt> times.
+    Both ranges must be sorted with respect to @c comp.
+    The workers split both ranges at equal parts of their merge,
+    moved back to the first of the equivalent elements,
+    count the output elements of their chunks,
+    and write them at the output positions of their chunks,
+    such that the comparator is applied twice to most elements.
+    The output range must not overlap either input range.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSetOperations for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T, typename C
+    >
+    Task set_intersection(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+    );
+
+    /**
+    @brief constructs a task to perform STL-styled parallel set-intersection algorithm
+           using the @c std::less<T> comparator, where @c T is the element type
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type
+    @tparam T resulting iterator type
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param result resulting iterator to the end of the output range
+
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::set_intersection(B1, E1, B2, E2, O, T&, C)
+    using the @c std::less<T> comparator.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSetOperations for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T
+    >
+    Task set_intersection(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+    );
+
+    /**
+    @brief constructs a task to perform STL-styled parallel set-union algorithm
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type
+    @tparam T resulting iterator type
+    @tparam C comparator type
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param result resulting iterator to the end of the output range
+    @param comp comparison function object
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that
+    copies the elements found in either of the sorted ranges
+    <tt>[first1, last1)</tt> and <tt>[first2, last2)</tt>
+    to the output range starting at @c d_first, in sorted order,
+    and stores the iterator past the last output element in @c result.
+    The output is the same as that of std::set_union,
+    where an element found @c m times in the first range
+    and @c n times in the second range is copied @c m times from the first
+    range and <tt>std::max(n-m, 0)</tt> times from the second range.
+    Both ranges must be sorted with respect to @c comp.
+    The workers split both ranges at equal parts of their merge,
+    moved back to the first of the equivalent elements,
+    count the output elements of their chunks,
+    and write them at the output positions of their chunks,
+    such that the comparator is applied twice to most elements.
+    The output range must not overlap either input range.
+
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSetOperations for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T, typename C
+    >
+    Task set_union(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+    );
+
+    /**
+    @brief constructs a task to perform STL-styled parallel set-union algorithm
+           using the @c std::less<T> comparator, where @c T is the element type
+
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
+    @tparam O output iterator type
+    @tparam T resulting iterator type
+
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param result resulting iterator to the end of the output range
 
-    // case 2: step size is negative
-    for(auto i=first, i>last; i+=step) {
-      callable(i);
-    }
-    @endcode
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::set_union(B1, E1, B2, E2, O, T&, C)
+    using the @c std::less<T> comparator.
 
     Arguments are templated to enable stateful range using std::reference_wrapper.
-    The callable needs to take a single argument of the integral index type.
 
-    Please refer to @ref ParallelIterations for details.
+    Please refer to @ref ParallelSetOperations for details.
     */
-    template <typename B, typename E, typename S, typename C>
-    Task for_each_index(B first, E last, S step, C callable);
-
-    // ------------------------------------------------------------------------
-    // transform
-    // ------------------------------------------------------------------------
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T
+    >
+    Task set_union(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+    );
 
     /**
-    @brief constructs a parallel-transform task
+    @brief constructs a task to perform STL-styled parallel set-difference algorithm
 
-    @tparam B beginning input iterator type
-    @tparam E ending input iterator type
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
     @tparam O output iterator type
-    @tparam C callable type
+    @tparam T resulting iterator type
+    @tparam C comparator type
 
-    @param first1 iterator to the beginning of the first range
-    @param last1 iterator to the end of the first range
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
     @param d_first iterator to the beginning of the output range
-    @param c an unary callable to apply to dereferenced input elements
+    @param result resulting iterator to the end of the output range
+    @param comp comparison function object
 
     @return a tf::Task handle
 
-    The task spawns a subflow that applies the callable object to an
-    input range and stores the result in another output range.
-    This method is equivalent to the parallel execution of the following loop:
-
-    @code{.cpp}
-    while (first1 != last1) {
-      *d_first++ = c(*first1++);
-    }
-    @endcode
+    The task spawns a subflow that
+    copies the elements of the sorted range <tt>[first1, last1)</tt>
+    that are not found in the sorted range <tt>[first2, last2)</tt>
+    to the output range starting at @c d_first,
+    and stores the iterator past the last output element in @c result.
+    The output is the same as that of std::set_difference,
+    where an element found @c m times in the first range
+    and @c n times in the second range is copied
+    <tt>std::max(m-n, 0)</tt> times.
+    Both ranges must be sorted with respect to @c comp.
+    The workers split both ranges at equal parts of their merge,
+    moved back to the first of the equivalent elements,
+    count the output elements of their chunks,
+    and write them at the output positions of their chunks,
+    such that the comparator is applied twice to most elements.
+    The output range must not overlap either input range.
 
     Arguments are templated to enable stateful range using std::reference_wrapper.
-    The callable needs to take a single argument of the dereferenced
-    iterator type.
+
+    Please refer to @ref ParallelSetOperations for details.
     */
-    template <typename B, typename E, typename O, typename C>
-    Task transform(B first1, E last1, O d_first, C c);
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T, typename C
+    >
+    Task set_difference(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result, C comp
+    );
 
     /**
-    @brief constructs a parallel-transform task
+    @brief constructs a task to perform STL-styled parallel set-difference algorithm
+           using the @c std::less<T> comparator, where @c T is the element type
 
-    @tparam B1 beginning input iterator type for the first input range
-    @tparam E1 ending input iterator type for the first input range
-    @tparam B2 beginning input iterator type for the first second range
+    @tparam B1 beginning iterator type of the first range (random-accessible)
+    @tparam E1 ending iterator type of the first range (random-accessible)
+    @tparam B2 beginning iterator type of the second range (random-accessible)
+    @tparam E2 ending iterator type of the second range (random-accessible)
     @tparam O output iterator type
-    @tparam C callable type
+    @tparam T resulting iterator type
 
-    @param first1 iterator to the beginning of the first input range
-    @param last1 iterator to the end of the first input range
-    @param first2 iterator to the beginning of the second input range
+    @param first1 iterator to the beginning of the first range (inclusive)
+    @param last1 iterator to the end of the first range (exclusive)
+    @param first2 iterator to the beginning of the second range (inclusive)
+    @param last2 iterator to the end of the second range (exclusive)
     @param d_first iterator to the beginning of the output range
-    @param c a binary operator to apply to dereferenced input elements
+    @param result resulting iterator to the end of the output range
 
     @return a tf::Task handle
 
-    The task spawns a subflow that applies the callable object to two
-    input ranges and stores the result in another output range.
-    This method is equivalent to the parallel execution of the following loop:
-
-    @code{.cpp}
-    while (first1 != last1) {
-      *d_first++ = c(*first1++, *first2++);
-    }
-    @endcode
+    The task is the same as tf::FlowBuilder::set_difference(B1, E1, B2, E2, O, T&, C)
+    using the @c std::less<T> comparator.
 
     Arguments are templated to enable stateful range using std::reference_wrapper.
-    The callable needs to take two arguments of dereferenced elements
-    from the two input ranges.
-    */
-    template <typename B1, typename E1, typename B2, typename O, typename C>
-    Task transform(B1 first1, E1 last1, B2 first2, O d_first, C c);
 
-    // ------------------------------------------------------------------------
-    // reduction
-    // ------------------------------------------------------------------------
+    Please refer to @ref ParallelSetOperations for details.
+    */
+    template <typename B1, typename E1, typename B2, typename E2, typename O,
+      typename T
+    >
+    Task set_difference(
+      B1 first1, E1 last1, B2 first2, E2 last2, O d_first, T& result
+    );
 
     /**
-    @brief constructs a STL-styled parallel-reduce task
+    @brief constructs a task to perform STL-styled parallel unique algorithm
 
     @tparam B beginning iterator type
     @tparam E ending iterator type
-    @tparam T result type
-    @tparam O binary reducer type
+    @tparam T resulting iterator type
+    @tparam P binary predicate type
 
-    @param first iterator to the beginning (inclusive)
-    @param last iterator to the end (exclusive)
-    @param init initial value of the reduction and the storage for the reduced result
-    @param bop binary operator that will be applied
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the new end of the range
+    @param pred binary predicate which returns @c true if two elements are
+                equivalent
 
     @return a tf::Task handle
 
-    The task spawns a subflow to perform parallel reduction over @c init
-    and the elements in the range <tt>[first, last)</tt>.
-    The reduced result is store in @c init.
-    This method is equivalent to the parallel execution of the following loop:
+    The task spawns a subflow that keeps the first element of every
+    group of consecutive equivalent elements in the range
+    <tt>[first, last)</tt> and moves the kept elements to the beginning
+    of the range, in their order, as std::unique,
+    and stores the new end of the range in @c result.
+    The elements beyond the new end are left in a valid but unspecified state.
+    The predicate must be an equivalence relation, since the workers remove
+    the duplicates of their blocks independently.
+    The task moves the kept elements through a temporary buffer,
+    which requires the element type to be default-constructible.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
 
-    @code{.cpp}
-    for(auto itr=first; itr!=last; itr++) {
-      init = bop(init, *itr);
-    }
-    @endcode
+    Please refer to @ref ParallelSetOperations for details.
+    */
+    template <typename B, typename E, typename T, typename P>
+    Task unique(B first, E last, T& result, P pred);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel unique algorithm
+           using the @c std::equal_to<T> predicate, where @c T is the element type
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T resulting iterator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param result resulting iterator to the new end of the range
+
+    @return a tf::Task handle
 
+    The task is the same as tf::FlowBuilder::unique(B, E, T&, P)
+    using the @c std::equal_to<T> predicate.
     Arguments are templated to enable stateful range using std::reference_wrapper.
 
-    Please refer to @ref ParallelReduction for details.
+    Please refer to @ref ParallelSetOperations for details.
     */
-    template <typename B, typename E, typename T, typename O>
-    Task reduce(B first, E last, T& init, O bop);
+    template <typename B, typename E, typename T>
+    Task unique(B first, E last, T& result);
 
     // ------------------------------------------------------------------------
-    // transfrom and reduction
+    // wavefront
     // ------------------------------------------------------------------------
 
     /**
-    @brief constructs a STL-styled parallel transform-reduce task
+    @brief constructs a task to run the cells of a grid in wavefront order
 
-    @tparam B beginning iterator type
-    @tparam E ending iterator type
-    @tparam T result type
-    @tparam BOP binary reducer type
-    @tparam UOP unary transformion type
+    @tparam R number of rows type (must be integral)
+    @tparam C number of columns type (must be integral)
+    @tparam F callable type
 
-    @param first iterator to the beginning (inclusive)
-    @param last iterator to the end (exclusive)
-    @param init initial value of the reduction and the storage for the reduced result
-    @param bop binary operator that will be applied in unspecified order to the results of @c uop
-    @param uop unary operator that will be applied to transform each element in the range to the result type
+    @param rows number of rows of the grid
+    @param cols number of columns of the grid
+    @param callable a callable object to apply to each cell of the grid
 
     @return a tf::Task handle
 
-    The task spawns a subflow to perform parallel reduction over @c init and
-    the transformed elements in the range <tt>[first, last)</tt>.
-    The reduced result is store in @c init.
-    This method is equivalent to the parallel execution of the following loop:
+    The task spawns a subflow that invokes <tt>callable(i, j)</tt> for each
+    cell <tt>(i, j)</tt> of the grid, with @c i in <tt>[0, rows)</tt> and
+    @c j in <tt>[0, cols)</tt>, after the calls of its north neighbor
+    <tt>(i-1, j)</tt> and its west neighbor <tt>(i, j-1)</tt> have returned.
+    This method is equivalent to the following loop, with the cells of each
+    anti-diagonal running in parallel:
 
     @code{.cpp}
-    for(auto itr=first; itr!=last; itr++) {
-      init = bop(init, uop(*itr));
+    for(size_t i=0; i<rows; i++) {
+      for(size_t j=0; j<cols; j++) {
+        callable(i, j);
+      }
     }
     @endcode
 
+    Instead of a task per cell, the grid keeps a one-byte counter per cell
+    and the worker that completes the second neighbor of a cell runs it,
+    such that a grid of many cells costs neither nodes nor edges.
+    The callable is shared by all workers and should process
+    a block of elements per cell to amortize the scheduling.
     Arguments are templated to enable stateful range using std::reference_wrapper.
 
-    Please refer to @ref ParallelReduction for details.
+    Please refer to @ref ParallelWavefront for details.
     */
-    template <typename B, typename E, typename T, typename BOP, typename UOP>
-    Task transform_reduce(B first, E last, T& init, BOP bop, UOP uop);
+    template <typename R, typename C, typename F>
+    Task wavefront(R rows, C cols, F callable);
 
     // ------------------------------------------------------------------------
-    // sort
+    // selection
     // ------------------------------------------------------------------------
 
     /**
-    @brief constructs a dynamic task to perform STL-styled parallel sort
+    @brief constructs a task to perform STL-styled parallel nth-element
+           algorithm
 
-    @tparam B beginning iterator type (random-accessible)
-    @tparam E ending iterator type (random-accessible)
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
     @tparam C comparator type
 
-    @param first iterator to the beginning (inclusive)
-    @param last iterator to the end (exclusive)
-    @param cmp comparison function object
+    @param first start of the input range
+    @param nth iterator to the position of the element to select
+    @param last end of the input range
+    @param comp binary comparator
 
-    The task spawns a subflow to parallelly sort elements in the range
-    <tt>[first, last)</tt>.
+    @return a tf::Task handle
 
+    The task spawns a subflow that reorders the elements in the range
+    <tt>[first, last)</tt> such that the element at @c nth is the one that
+    would be there if the range were sorted, no element before @c nth is
+    greater than it, and no element after @c nth is less than it,
+    as std::nth_element.
+    The task narrows the range around @c nth by sample select,
+    which takes two pivots from a sorted sample and moves the elements
+    below, between and above them through a temporary buffer in parallel,
+    and requires the element type to be default-constructible.
     Arguments are templated to enable stateful range using std::reference_wrapper.
 
-    Please refer to @ref ParallelSort for details.
+    Please refer to @ref ParallelSelection for details.
     */
     template <typename B, typename E, typename C>
-    Task sort(B first, E last, C cmp);
+    Task nth_element(B first, B nth, E last, C comp);
 
     /**
-    @brief constructs a dynamic task to perform STL-styled parallel sort using
-           the @c std::less<T> comparator, where @c T is the element type
+    @brief constructs a task to perform STL-styled parallel nth-element
+           algorithm using the @c std::less comparator
 
-    @tparam B beginning iterator type (random-accessible)
-    @tparam E ending iterator type (random-accessible)
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
 
-    @param first iterator to the beginning (inclusive)
-    @param last iterator to the end (exclusive)
+    @param first start of the input range
+    @param nth iterator to the position of the element to select
+    @param last end of the input range
 
-    The task spawns a subflow to parallelly sort elements in the range
-    <tt>[first, last)</tt> using the @c std::less<T> comparator,
-    where @c T is the dereferenced iterator type.
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::nth_element with
+    the @c std::less comparator.
+    */
+    template <typename B, typename E>
+    Task nth_element(B first, B nth, E last);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel partial-sort
+           algorithm
+
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
+    @tparam C comparator type
+
+    @param first start of the input range
+    @param middle end of the range to sort
+    @param last end of the input range
+    @param comp binary comparator
 
+    @return a tf::Task handle
+
+    The task spawns a subflow that places the <tt>middle - first</tt>
+    smallest elements of the range <tt>[first, last)</tt> in sorted order
+    in <tt>[first, middle)</tt>, as std::partial_sort.
+    The order of the elements in <tt>[middle, last)</tt> is unspecified.
+    The task selects the element at @c middle as tf::FlowBuilder::nth_element
+    and sorts the elements before it in parallel.
     Arguments are templated to enable stateful range using std::reference_wrapper.
 
-    Please refer to @ref ParallelSort for details.
-     */
+    Please refer to @ref ParallelSelection for details.
+    */
+    template <typename B, typename E, typename C>
+    Task partial_sort(B first, B middle, E last, C comp);
+
+    /**
+    @brief constructs a task to perform STL-styled parallel partial-sort
+           algorithm using the @c std::less comparator
+
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
+
+    @param first start of the input range
+    @param middle end of the range to sort
+    @param last end of the input range
+
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::partial_sort with
+    the @c std::less comparator.
+    */
     template <typename B, typename E>
-    Task sort(B first, E last);
+    Task partial_sort(B first, B middle, E last);
+
+    /**
+    @brief constructs a task to find the @c k smallest elements of a range
+           in parallel
+
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
+    @tparam O random-access output iterator type
+    @tparam C comparator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param k number of elements to find
+    @param d_first start of the output range
+    @param comp binary comparator
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that writes the <tt>min(k, last - first)</tt>
+    smallest elements of the range <tt>[first, last)</tt> in sorted order
+    to the range beginning at @c d_first, and leaves the input range
+    unchanged, as std::partial_sort_copy.
+    When @c k is small relative to the input, each worker keeps the @c k
+    smallest elements of its block in a bounded heap, in a single pass
+    over the block, and the sorted heaps are merged pairwise in parallel.
+    Otherwise, the task copies the input to a temporary buffer and selects
+    and sorts the @c k smallest elements in it as tf::FlowBuilder::partial_sort.
+    The element type must be default-constructible.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelSelection for details.
+    */
+    template <typename B, typename E, typename O, typename C>
+    Task top_k(B first, E last, size_t k, O d_first, C comp);
+
+    /**
+    @brief constructs a task to find the @c k smallest elements of a range
+           in parallel using the @c std::less comparator
+
+    @tparam B random-access iterator type
+    @tparam E ending iterator type
+    @tparam O random-access output iterator type
+
+    @param first start of the input range
+    @param last end of the input range
+    @param k number of elements to find
+    @param d_first start of the output range
+
+    @return a tf::Task handle
+
+    The task is the same as tf::FlowBuilder::top_k with
+    the @c std::less comparator.
+    */
+    template <typename B, typename E, typename O>
+    Task top_k(B first, E last, size_t k, O d_first);
+
+    // ------------------------------------------------------------------------
+    // dense matrix
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a task to multiply two row-major dense matrices
+
+    @tparam T element type (@c float or @c double)
+
+    @param A pointer to the @c M x @c K input matrix
+    @param B pointer to the @c K x @c N input matrix
+    @param C pointer to the @c M x @c N output matrix
+    @param M number of rows of @c A and @c C
+    @param K number of columns of @c A and rows of @c B
+    @param N number of columns of @c B and @c C
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that computes <tt>C = A * B</tt>,
+    where all matrices are dense and stored in row-major order
+    and @c C does not overlap @c A or @c B.
+    The task splits @c C into macro-tiles that the workers multiply
+    independently, each packing the blocks of @c A and @c B it needs into
+    contiguous panels sized for the L2 and L3 caches,
+    and runs a register-blocked micro-kernel over the panels.
+    On x86 processors with GCC or Clang, the micro-kernel is compiled for
+    AVX-512, AVX2 with FMA, and SSE2, and the task picks the widest one
+    the processor supports at run time; other compilers and processors
+    run a portable micro-kernel.
+
+    Please refer to @ref ParallelMatrix for details.
+    */
+    template <typename T>
+    Task matmul(const T* A, const T* B, T* C, size_t M, size_t K, size_t N);
+
+    /**
+    @brief constructs a task to transpose a row-major dense matrix
+
+    @tparam T element type
+
+    @param in pointer to the @c rows x @c cols input matrix
+    @param out pointer to the @c cols x @c rows output matrix
+    @param rows number of rows of the input matrix
+    @param cols number of columns of the input matrix
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that writes the transpose of the input matrix
+    to the output matrix, both dense and stored in row-major order,
+    such that <tt>out[j*rows + i] = in[i*cols + j]</tt>.
+    The output must not overlap the input.
+    The workers transpose square tiles of the matrix that fit
+    in the L1 cache.
+
+    Please refer to @ref ParallelMatrix for details.
+    */
+    template <typename T>
+    Task transpose(const T* in, T* out, size_t rows, size_t cols);
+
+    // ------------------------------------------------------------------------
+    // graph traversal
+    // ------------------------------------------------------------------------
+
+    /**
+    @brief constructs a task to perform a parallel breadth-first search
+           over a graph in compressed sparse row (CSR) format
+
+    @tparam OB beginning iterator type of the offsets
+    @tparam OE ending iterator type of the offsets
+    @tparam E iterator type of the edges
+    @tparam S source vertex type
+    @tparam L iterator type of the levels
+
+    @param offsets_first start of the range of edge offsets
+    @param offsets_last end of the range of edge offsets
+    @param edges start of the range of edge targets
+    @param source vertex to start the search from
+    @param levels start of the range of vertex levels
+
+    @return a tf::Task handle
+
+    The task spawns a subflow that labels every vertex @c v of the graph
+    with its level, the number of edges on a shortest path from @c source
+    to @c v, in <tt>levels[v]</tt>, and every vertex that @c source
+    does not reach with <tt>static_cast<L::value_type>(-1)</tt>.
+    The graph has <tt>N = (offsets_last - offsets_first) - 1</tt> vertices,
+    and the neighbors of vertex @c v are the vertices in
+    <tt>[edges + offsets_first[v], edges + offsets_first[v+1])</tt>.
+    This method is equivalent to the following loop:
+
+    @code{.cpp}
+    std::fill(levels, levels + N, -1);
+    std::queue<size_t> queue;
+    levels[source] = 0;
+    queue.push(source);
+    while(!queue.empty()) {
+      auto u = queue.front();
+      queue.pop();
+      for(auto e=offsets_first[u]; e<offsets_first[u+1]; e++) {
+        if(levels[edges[e]] == -1) {
+          levels[edges[e]] = levels[u] + 1;
+          queue.push(edges[e]);
+        }
+      }
+    }
+    @endcode
+
+    The task visits one level at a time, either top-down from a queue of
+    the frontier, with per-worker buffers of the next frontier and
+    a visited bitmap, or bottom-up from the unvisited vertices to a frontier
+    bitmap, and switches direction by the share of edges the frontier holds.
+    Since a bottom-up step searches the neighbors of a vertex for its parent,
+    the graph must be undirected, listing each edge in both directions.
+    All iterators must be random-access.
+    Arguments are templated to enable stateful range using std::reference_wrapper.
+
+    Please refer to @ref ParallelGraphTraversal for details.
+    */
+    template <typename OB, typename OE, typename E, typename S, typename L>
+    Task bfs(OB offsets_first, OE offsets_last, E edges, S source, L levels);
 
   protected:
 
@@ -733,6 +2534,49 @@ class FlowBuilder {
 
     template <typename L>
     void _linearize(L&);
+
+    template <typename P, typename L>
+    static void _launch_loop(
+      Subflow&, const P&, size_t, size_t, std::atomic<size_t>&, L&
+    );
+
+    template <bool I, typename T, typename B, typename D, typename BOP, typename UOP>
+    static void _scan(Subflow&, B, size_t, D, BOP&, UOP&, absl::optional<T>);
+
+    template <typename R, typename S, typename C>
+    static void _stable_sort(Subflow&, R, size_t, S, C&);
+
+    template <typename K, typename V>
+    static void _radix_sort(Subflow&, K, size_t, V);
+
+    template <typename T, typename X, typename BOP, typename UOP, typename P>
+    static void _simd_reduce(Subflow&, X*, size_t, T&, BOP&, UOP&, P&);
+
+    template <typename B, typename R, typename KOP, typename F, typename P>
+    static void _reduce_by_key(Subflow&, B, size_t, R&, KOP&, F&, P&);
+
+    template <typename T, typename B, typename O, typename D, typename BOP>
+    static void _segmented_reduce(Subflow&, B, O, size_t, D, BOP&, absl::optional<T>);
+
+    template <typename T, typename B, typename O, typename D, typename BOP>
+    static void _segmented_scan(Subflow&, B, O, size_t, D, BOP&, absl::optional<T>);
+
+    template <typename B, typename UOP>
+    static size_t _count_if(
+      Subflow&, B, size_t, size_t, UOP&, std::vector<size_t>&
+    );
+
+    template <typename A, typename B, typename O, typename C, typename F>
+    static size_t _set_operation(Subflow&, A, size_t, B, size_t, O, size_t, C&, F&);
+
+    template <typename B, typename C>
+    static void _nth_element(Subflow&, B, size_t, size_t, C&);
+
+    template <typename T, size_t VB>
+    static void _matmul(Subflow&, const T*, const T*, T*, size_t, size_t, size_t);
+
+    template <typename O, typename E, typename L>
+    static void _bfs(Subflow&, O, E, size_t, size_t, L);
 };
 
 // Constructor
@@ -1078,6 +2922,33 @@ class Subflow : public FlowBuilder {
     template <typename F, typename... ArgsT>
     void named_silent_async(const std::string& name, F&& f, ArgsT&&... args);
 
+    /**
+    @brief runs the given callables in parallel and waits until they all complete
+
+    @tparam Cs callable types
+    @param callables callables to run in parallel
+
+    This member function is the same as tf::Runtime::parallel_invoke,
+    which runs the callables without adding any task to this subflow
+    and hence without calling tf::Subflow::join.
+    Each callable is either a static task, <tt>void()</tt>,
+    or a runtime task, <tt>void(tf::Runtime&)</tt>.
+
+    @code{.cpp}
+    taskflow.emplace([&](tf::Subflow& sf){
+      sf.parallel_invoke(
+        [&](){ std::sort(v1.begin(), v1.end()); },
+        [&](){ std::sort(v2.begin(), v2.end()); }
+      );
+      // both vectors are sorted
+    });
+    @endcode
+
+    This member function must be called by the worker that runs the subflow.
+    */
+    template <typename... Cs>
+    void parallel_invoke(Cs&&... callables);
+
     /**
     @brief returns the executor that runs this subflow
     */
@@ -1093,10 +2964,10 @@ class Subflow : public FlowBuilder {
     Subflow(Executor&, Worker&, Node*, Graph&);
 
     template <typename F, typename... ArgsT>
-    auto _named_async(Worker& w, const std::string& name, F&& f, ArgsT&&... args) -> Future<neo::FRet<F, ArgsT...>>;
+    auto _named_async(Worker& w, const TaskName& name, F&& f, ArgsT&&... args) -> Future<neo::FRet<F, ArgsT...>>;
 
     template <typename F, typename... ArgsT>
-    void _named_silent_async(Worker& w, const std::string& name, F&& f, ArgsT&&... args);
+    void _named_silent_async(Worker& w, const TaskName& name, F&& f, ArgsT&&... args);
 };
 
 // Constructor
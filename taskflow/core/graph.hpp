@@ -3,11 +3,13 @@
 #include "../utility/traits.hpp"
 #include "../utility/iterator.hpp"
 #include "../utility/object_pool.hpp"
+#include "../utility/arena.hpp"
 #include "../utility/os.hpp"
 #include "../utility/math.hpp"
 #include "../utility/small_vector.hpp"
 #include "../utility/serializer.hpp"
 #include "error.hpp"
+#include "task_name.hpp"
 #include "declarations.hpp"
 #include "semaphore.hpp"
 #include "environment.hpp"
@@ -40,6 +42,25 @@ class CustomGraphBase {
   virtual ~CustomGraphBase() = default;
 };
 
+// ----------------------------------------------------------------------------
+// Node Pool
+// ----------------------------------------------------------------------------
+
+/**
+@brief alias of the object pool that animates and recycles task nodes
+
+A node pool can be owned by an executor (see tf::Executor::node_pool)
+and selected by a graph or a taskflow, such that the memory of a tenant
+can be inspected through tf::NodePool::num_allocated_objects and
+tf::NodePool::capacity, and given back through tf::NodePool::trim.
+*/
+using NodePool = ObjectPool<Node>;
+
+/**
+@private
+*/
+inline NodePool& node_pool();
+
 // ----------------------------------------------------------------------------
 // Class: Graph
 // ----------------------------------------------------------------------------
@@ -51,9 +72,14 @@ class CustomGraphBase {
 
 A graph is the ultimate storage for a task dependency graph and is the main
 gateway to interact with an executor.
-A graph manages a set of nodes in a global object pool that animates and
+A graph manages a set of nodes in an object pool that animates and
 recycles node objects efficiently without going through repetitive and
 expensive memory allocations and deallocations.
+By default, the pool is shared by the whole process;
+a graph can also select its own tf::NodePool, which must outlive the graph.
+A graph constructed over a tf::MonotonicArena bump-allocates its nodes
+from the arena and reclaims all of them at once by resetting the arena
+when the graph is cleared or destroyed.
 This class is mainly used for creating an opaque graph object in a custom
 class to interact with the executor through taskflow composition.
 
@@ -66,13 +92,29 @@ class Graph {
   friend class Subflow;
   friend class Taskflow;
   friend class Executor;
+  friend class GraphBuilder;
 
   public:
 
     /**
     @brief constructs a graph object
     */
-    Graph() = default;
+    Graph();
+
+    /**
+    @brief constructs a graph object that allocates nodes from the given pool
+    */
+    explicit Graph(NodePool& pool);
+
+    /**
+    @brief constructs a graph object that bump-allocates nodes from the
+           given arena
+
+    The graph resets the arena when it is cleared or destroyed,
+    so the arena must back no other object and must outlive the graph.
+    Nodes spawned by subflows at runtime still come from the default pool.
+    */
+    explicit Graph(MonotonicArena& arena);
 
     /**
     @brief disabled copy constructor
@@ -118,10 +160,18 @@ class Graph {
 
     std::vector<Node*> _nodes;
 
+    NodePool* _pool;
+
+    MonotonicArena* _arena {nullptr};
+
     void _clear();
     void _clear_detached();
     void _merge(Graph&&);
     void _erase(Node*);
+    void _recycle(Node*);
+
+    template <typename ...ArgsT>
+    Node* _animate(ArgsT&&... args);
 
     template <typename ...ArgsT>
     Node* _emplace_back(ArgsT&&... args);
@@ -243,6 +293,43 @@ class Runtime {
   template <typename T, neo::enable_if_t<!is_dynamic_task<T>::value>* = nullptr>
   void run_and_wait(T&& target);
 
+  /**
+  @brief runs the given callables in parallel and waits until they all complete
+
+  @tparam Cs callable types
+  @param callables callables to run in parallel
+
+  Each callable is either a static task, <tt>void()</tt>, or a runtime task,
+  <tt>void(tf::Runtime&)</tt>.
+  The calling worker runs the first callable itself and pushes the others
+  to its queue as jobs that live on its stack, without creating any task
+  in a graph.
+  While the other callables are running, the calling worker steals and
+  runs other tasks of the executor until they complete.
+  The overhead is hence low enough for recursive fork-join parallelism:
+
+  @code{.cpp}
+  int fibonacci(int n, tf::Runtime& rt) {
+    if(n < 2) return n;
+    int res1, res2;
+    rt.parallel_invoke(
+      [&](tf::Runtime& rt1){ res1 = fibonacci(n-1, rt1); },
+      [&](tf::Runtime& rt2){ res2 = fibonacci(n-2, rt2); }
+    );
+    return res1 + res2;
+  }
+
+  taskflow.emplace([&](tf::Runtime& rt){ res = fibonacci(30, rt); });
+  @endcode
+
+  @attention
+  A callable may run on a different worker than the caller.
+  A runtime callable must use the runtime object it is given rather than
+  the one of the caller, which belongs to the calling worker.
+  */
+  template <typename... Cs>
+  void parallel_invoke(Cs&&... callables);
+
   private:
 
   explicit Runtime(Executor&, Worker&, Node*);
@@ -281,6 +368,7 @@ class Node {
   friend class FlowBuilder;
   friend class Subflow;
   friend class Runtime;
+  friend class GraphBuilder;
 
   TF_ENABLE_POOLABLE_ON_THIS;
 
@@ -436,7 +524,7 @@ class Node {
 
   private:
 
-  std::string _name;
+  TaskName _name;
   
   unsigned _priority {0};
 
@@ -470,14 +558,10 @@ class Node {
 // Node Object Pool
 // ----------------------------------------------------------------------------
 
-/**
-@private
-*/
-
 // inline ObjectPool<Node> node_pool;
-inline ObjectPool<Node>& node_pool()
+inline NodePool& node_pool()
 {
-    static ObjectPool<Node> pool;
+    static NodePool pool;
     return pool;
 }
 
@@ -610,32 +694,32 @@ inline Node::~Node() {
     // the result of absl::get_if is guaranteed to be non-null
     // due to the index check above
     auto& subgraph = absl::get_if<Dynamic>(&_handle)->subgraph;
-    std::vector<Node*> nodes;
+    std::vector<std::pair<Node*, NodePool*>> nodes;
     nodes.reserve(subgraph.size());
 
-    std::move(
-      subgraph._nodes.begin(), subgraph._nodes.end(), std::back_inserter(nodes)
-    );
+    for(auto n : subgraph._nodes) {
+      nodes.emplace_back(n, subgraph._pool);
+    }
     subgraph._nodes.clear();
 
     size_t i = 0;
 
     while(i < nodes.size()) {
 
-      if(nodes[i]->_handle.index() == DYNAMIC) {
-        auto& sbg = absl::get_if<Dynamic>(&(nodes[i]->_handle))->subgraph;
-        std::move(
-          sbg._nodes.begin(), sbg._nodes.end(), std::back_inserter(nodes)
-        );
+      if(nodes[i].first->_handle.index() == DYNAMIC) {
+        auto& sbg = absl::get_if<Dynamic>(&(nodes[i].first->_handle))->subgraph;
+        for(auto n : sbg._nodes) {
+          nodes.emplace_back(n, sbg._pool);
+        }
         sbg._nodes.clear();
       }
 
       ++i;
     }
 
-    //auto& np = Graph::_node_pool();
+    // each node goes back to the pool of the graph that animated it
     for(i=0; i<nodes.size(); ++i) {
-      node_pool().recycle(nodes[i]);
+      nodes[i].second->recycle(nodes[i].first);
     }
   }
 }
@@ -681,8 +765,12 @@ inline size_t Node::num_strong_dependents() const {
 }
 
 // Function: name
+// a numbered name is formatted into its string the first time it is asked for
 inline const std::string& Node::name() const {
-  return _name;
+  if(_name._prefix && _name._name.empty()) {
+    _name._name = _name.str();
+  }
+  return _name._name;
 }
 
 // Function: _is_conditioner
@@ -759,15 +847,35 @@ inline Graph::~Graph() {
   _clear();
 }
 
+// Constructor
+inline Graph::Graph() : _pool {&node_pool()} {
+}
+
+// Constructor
+inline Graph::Graph(NodePool& pool) : _pool {&pool} {
+}
+
+// Constructor
+inline Graph::Graph(MonotonicArena& arena) :
+  _pool  {&node_pool()},
+  _arena {&arena} {
+}
+
 // Move constructor
 inline Graph::Graph(Graph&& other) :
-  _nodes {std::move(other._nodes)} {
+  _nodes {std::move(other._nodes)},
+  _pool  {other._pool},
+  _arena {other._arena} {
+  other._arena = nullptr;
 }
 
 // Move assignment
 inline Graph& Graph::operator = (Graph&& other) {
   _clear();
   _nodes = std::move(other._nodes);
+  _pool = other._pool;
+  _arena = other._arena;
+  other._arena = nullptr;
   return *this;
 }
 
@@ -779,9 +887,14 @@ inline void Graph::clear() {
 // Procedure: clear
 inline void Graph::_clear() {
   for(auto node : _nodes) {
-    node_pool().recycle(node);
+    _recycle(node);
   }
   _nodes.clear();
+
+  // arena nodes are reclaimed in bulk
+  if(_arena) {
+    _arena->reset();
+  }
 }
 
 // Procedure: clear_detached
@@ -792,13 +905,14 @@ inline void Graph::_clear_detached() {
   });
 
   for(auto itr = mid; itr != _nodes.end(); ++itr) {
-    node_pool().recycle(*itr);
+    _recycle(*itr);
   }
   _nodes.resize(std::distance(_nodes.begin(), mid));
 }
 
 // Procedure: merge
 inline void Graph::_merge(Graph&& g) {
+  assert(_pool == g._pool);
   for(auto n : g._nodes) {
     _nodes.push_back(n);
   }
@@ -810,7 +924,19 @@ inline void Graph::_erase(Node* node) {
   auto I = std::find(_nodes.begin(), _nodes.end(), node); 
   if(I != _nodes.end()) {
     _nodes.erase(I);
-    node_pool().recycle(node);
+    _recycle(node);
+  }
+}
+
+// Procedure: _recycle
+// a node bump-allocated from the arena has no pool block and only needs
+// to be destroyed; its memory is reclaimed when the arena is reset
+inline void Graph::_recycle(Node* node) {
+  if(node->_object_pool_block) {
+    _pool->recycle(node);
+  }
+  else {
+    node->~Node();
   }
 }
 
@@ -824,16 +950,37 @@ inline bool Graph::empty() const {
   return _nodes.empty();
 }
 
+// Function: _animate
+template <typename ...ArgsT>
+Node* Graph::_animate(ArgsT&&... args) {
+
+  if(_arena) {
+    auto node = new (_arena->allocate(sizeof(Node), alignof(Node)))
+      Node(std::forward<ArgsT>(args)...);
+    node->_object_pool_block = nullptr;
+    return node;
+  }
+
+  auto node = _pool->animate(std::forward<ArgsT>(args)...);
+
+  // a subflow draws from the pool of the graph that holds its task
+  if(node->_handle.index() == Node::DYNAMIC) {
+    absl::get_if<Node::Dynamic>(&node->_handle)->subgraph._pool = _pool;
+  }
+
+  return node;
+}
+
 // Function: emplace_back
 template <typename ...ArgsT>
 Node* Graph::_emplace_back(ArgsT&&... args) {
-  _nodes.push_back(node_pool().animate(std::forward<ArgsT>(args)...));
+  _nodes.push_back(_animate(std::forward<ArgsT>(args)...));
   return _nodes.back();
 }
 
 // Function: emplace_back
 inline Node* Graph::_emplace_back() {
-  _nodes.push_back(node_pool().animate());
+  _nodes.push_back(_animate());
   return _nodes.back();
 }
 
@@ -0,0 +1,364 @@
+#pragma once
+
+#include "executor.hpp"
+
+/**
+@file graph_builder.hpp
+@brief graph builder include file
+*/
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// Class: GraphBuilder
+// ----------------------------------------------------------------------------
+
+/**
+@class GraphBuilder
+
+@brief class to construct a large taskflow in parallel
+
+tf::FlowBuilder::emplace and tf::Task::precede are not thread-safe,
+which makes the construction of a very large taskflow sequential.
+A graph builder instead reserves a number of placeholder tasks in a taskflow
+and addresses them by index, such that many threads can assign their work
+and add dependencies concurrently.
+Dependencies are collected in per-worker edge buffers and are merged into
+the graph in parallel when tf::GraphBuilder::finalize is called.
+
+@code{.cpp}
+tf::Executor executor;
+tf::Taskflow taskflow;
+tf::GraphBuilder builder(taskflow, executor);
+
+// appends N placeholder tasks to the taskflow
+builder.reserve(N);
+
+// visits each index once on the executor
+builder.build([&](size_t i){
+  builder.task(i).work([i](){ simulate(i); });
+  if(i+1 < N) {
+    builder.precede(i, i+1);
+  }
+});
+
+// merges the dependencies into the taskflow
+builder.finalize();
+
+executor.run(taskflow).wait();
+@endcode
+
+tf::GraphBuilder::reserve, tf::GraphBuilder::build, and
+tf::GraphBuilder::finalize run on the executor and block until they
+complete, so they must not be called from a worker of that executor.
+tf::GraphBuilder::precede is thread-safe, and tf::GraphBuilder::task
+can be modified concurrently as long as no two threads modify the same task.
+The reserved tasks are appended contiguously to the taskflow;
+no other task may be added to the taskflow, and the taskflow may not run,
+until tf::GraphBuilder::finalize returns.
+*/
+class GraphBuilder {
+
+  struct Edge {
+    size_t from;
+    size_t to;
+  };
+
+  // buffer of the calling worker, cached for the duration of build
+  struct Local {
+    const GraphBuilder* builder {nullptr};
+    std::vector<Edge>* buffer {nullptr};
+  };
+
+  public:
+
+    /**
+    @brief constructs a graph builder over the given taskflow and executor
+    */
+    GraphBuilder(Taskflow& taskflow, Executor& executor);
+
+    /**
+    @brief destructs the graph builder after merging pending dependencies
+    */
+    ~GraphBuilder();
+
+    GraphBuilder(const GraphBuilder&) = delete;
+    GraphBuilder& operator = (const GraphBuilder&) = delete;
+
+    /**
+    @brief appends @c N placeholder tasks to the taskflow in parallel
+
+    The new tasks are addressed by the indices
+    <tt>[size(), size() + N)</tt>.
+    */
+    void reserve(size_t N);
+
+    /**
+    @brief queries the number of tasks reserved by the builder
+    */
+    size_t size() const;
+
+    /**
+    @brief returns the task at the given index
+    */
+    Task task(size_t i) const;
+
+    /**
+    @brief adds a dependency from task @c from to task @c to
+
+    The dependency becomes visible in the taskflow after
+    tf::GraphBuilder::finalize.
+    This member function is thread-safe.
+    */
+    void precede(size_t from, size_t to);
+
+    /**
+    @brief invokes the callable on every reserved index in parallel
+
+    @tparam C callable type
+
+    @param callable callable object to invoke on each index
+
+    The callable takes a single argument of type @c size_t and is invoked
+    exactly once per index by the workers of the executor.
+    */
+    template <typename C>
+    void build(C&& callable);
+
+    /**
+    @brief merges all pending dependencies into the taskflow in parallel
+    */
+    void finalize();
+
+  private:
+
+    Taskflow& _taskflow;
+    Executor& _executor;
+
+    size_t _base {0};
+    size_t _size {0};
+
+    std::mutex _mutex;
+
+    // one buffer per worker and a locked one for other threads
+    std::vector<CachelineAligned<std::vector<Edge>>> _buffers;
+
+    Node** _nodes();
+
+    static Local& _this_local();
+
+    template <typename F>
+    void _parallel(size_t, F&&);
+};
+
+// Constructor
+inline GraphBuilder::GraphBuilder(Taskflow& taskflow, Executor& executor) :
+  _taskflow {taskflow},
+  _executor {executor},
+  _buffers  (executor.num_workers() + 1) {
+}
+
+// Destructor
+inline GraphBuilder::~GraphBuilder() {
+  finalize();
+}
+
+// Function: size
+inline size_t GraphBuilder::size() const {
+  return _size;
+}
+
+// Function: task
+inline Task GraphBuilder::task(size_t i) const {
+  assert(i < _size);
+  return Task(_taskflow._graph._nodes[_base + i]);
+}
+
+// Procedure: reserve
+inline void GraphBuilder::reserve(size_t N) {
+
+  auto& graph = _taskflow._graph;
+
+  if(_size == 0) {
+    _base = graph._nodes.size();
+  }
+
+  assert(_base + _size == graph._nodes.size());
+
+  graph._nodes.resize(graph._nodes.size() + N);
+
+  Node** nodes = _nodes() + _size;
+
+  auto animate = [&graph, nodes] (size_t beg, size_t end) {
+    for(size_t i=beg; i<end; i++) {
+      nodes[i] = graph._animate();
+    }
+  };
+
+  // the arena is not thread-safe
+  if(graph._arena) {
+    animate(0, N);
+  }
+  else {
+    _parallel(N, animate);
+  }
+
+  _size += N;
+}
+
+// Procedure: precede
+inline void GraphBuilder::precede(size_t from, size_t to) {
+
+  assert(from < _size && to < _size);
+
+  auto& local = _this_local();
+
+  if(local.builder == this) {
+    local.buffer->push_back({from, to});
+    return;
+  }
+
+  auto id = _executor.this_worker_id();
+
+  if(id >= 0) {
+    _buffers[id].data.push_back({from, to});
+  }
+  else {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _buffers.back().data.push_back({from, to});
+  }
+}
+
+// Procedure: build
+template <typename C>
+void GraphBuilder::build(C&& callable) {
+  _parallel(_size, [this, &callable] (size_t beg, size_t end) {
+    auto& local = _this_local();
+    local.builder = this;
+    local.buffer  = &_buffers[_executor.this_worker_id()].data;
+    for(size_t i=beg; i<end; i++) {
+      callable(i);
+    }
+    local = Local{};
+  });
+}
+
+// Procedure: finalize
+// counts the degree of each task, grows its edge lists once, and
+// scatters the edges into the grown lists through atomic cursors
+inline void GraphBuilder::finalize() {
+
+  // prefix offsets of the buffers in the global edge order
+  std::vector<size_t> offsets(_buffers.size() + 1, 0);
+  for(size_t b=0; b<_buffers.size(); b++) {
+    offsets[b+1] = offsets[b] + _buffers[b].data.size();
+  }
+
+  size_t E = offsets.back();
+
+  if(E == 0) {
+    return;
+  }
+
+  auto for_each_edge = [&] (size_t beg, size_t end, auto&& f) {
+    size_t b = std::upper_bound(offsets.begin(), offsets.end(), beg)
+             - offsets.begin() - 1;
+    for(size_t e=beg; e<end; e++) {
+      while(e >= offsets[b+1]) {
+        ++b;
+      }
+      f(_buffers[b].data[e - offsets[b]]);
+    }
+  };
+
+  Node** nodes = _nodes();
+
+  // a single worker gains nothing from the parallel merge
+  if(_executor.num_workers() == 1) {
+    for(auto& buffer : _buffers) {
+      for(auto& edge : buffer.data) {
+        nodes[edge.from]->_precede(nodes[edge.to]);
+      }
+      std::vector<Edge>().swap(buffer.data);
+    }
+    return;
+  }
+
+  std::unique_ptr<std::atomic<size_t>[]> out(new std::atomic<size_t>[_size]());
+  std::unique_ptr<std::atomic<size_t>[]> in (new std::atomic<size_t>[_size]());
+
+  _parallel(E, [&] (size_t beg, size_t end) {
+    for_each_edge(beg, end, [&] (const Edge& edge) {
+      out[edge.from].fetch_add(1, std::memory_order_relaxed);
+      in [edge.to  ].fetch_add(1, std::memory_order_relaxed);
+    });
+  });
+
+  // turn the degrees into insertion cursors
+  _parallel(_size, [&] (size_t beg, size_t end) {
+    for(size_t i=beg; i<end; i++) {
+      auto& succs = nodes[i]->_successors;
+      auto& deps  = nodes[i]->_dependents;
+      size_t s = succs.size();
+      size_t d = deps.size();
+      succs.resize(s + out[i].load(std::memory_order_relaxed));
+      deps.resize(d + in[i].load(std::memory_order_relaxed));
+      out[i].store(s, std::memory_order_relaxed);
+      in [i].store(d, std::memory_order_relaxed);
+    }
+  });
+
+  _parallel(E, [&] (size_t beg, size_t end) {
+    for_each_edge(beg, end, [&] (const Edge& edge) {
+      Node* u = nodes[edge.from];
+      Node* v = nodes[edge.to];
+      u->_successors[out[edge.from].fetch_add(1, std::memory_order_relaxed)] = v;
+      v->_dependents[in [edge.to  ].fetch_add(1, std::memory_order_relaxed)] = u;
+    });
+  });
+
+  for(auto& buffer : _buffers) {
+    std::vector<Edge>().swap(buffer.data);
+  }
+}
+
+// Function: _nodes
+inline Node** GraphBuilder::_nodes() {
+  return _taskflow._graph._nodes.data() + _base;
+}
+
+// Function: _this_local
+inline GraphBuilder::Local& GraphBuilder::_this_local() {
+  thread_local Local local;
+  return local;
+}
+
+// Procedure: _parallel
+// runs f(beg, end) over blocks of [0, N) on the executor and waits
+template <typename F>
+void GraphBuilder::_parallel(size_t N, F&& f) {
+
+  if(N == 0) {
+    return;
+  }
+
+  size_t W = _executor.num_workers();
+  size_t G = std::max(size_t{1}, N / (W * 16));
+
+  std::atomic<size_t> next(0);
+
+  Taskflow taskflow;
+
+  for(size_t w=0; w<W && w*G<N; w++) {
+    taskflow.emplace([&next, &f, N, G] () {
+      size_t beg;
+      while((beg = next.fetch_add(G, std::memory_order_relaxed)) < N) {
+        f(beg, std::min(beg + G, N));
+      }
+    });
+  }
+
+  _executor.run(taskflow).wait();
+}
+
+}  // end of namespace tf -----------------------------------------------------
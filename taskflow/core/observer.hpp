@@ -24,7 +24,7 @@ using observer_stamp_t = std::chrono::time_point<std::chrono::steady_clock>;
 */
 struct Segment {
 
-  std::string name;
+  TaskName name;
   TaskType type;
 
   observer_stamp_t beg;
@@ -43,7 +43,7 @@ struct Segment {
   Segment() = default;
 
   Segment(
-    const std::string& n, TaskType t, observer_stamp_t b, observer_stamp_t e
+    const TaskName& n, TaskType t, observer_stamp_t b, observer_stamp_t e
   ) : name {n}, type {t}, beg {b}, end {e} {
   }
 
@@ -233,13 +233,13 @@ class ChromeObserver : public ObserverInterface {
   // data structure to record each task execution
   struct Segment {
 
-    std::string name;
+    TaskName name;
 
     observer_stamp_t beg;
     observer_stamp_t end;
 
     Segment(
-      const std::string& n,
+      const TaskName& n,
       observer_stamp_t b,
       observer_stamp_t e
     );
@@ -286,7 +286,7 @@ class ChromeObserver : public ObserverInterface {
     
 // constructor
 inline ChromeObserver::Segment::Segment(
-  const std::string& n, observer_stamp_t b, observer_stamp_t e
+  const TaskName& n, observer_stamp_t b, observer_stamp_t e
 ) :
   name {n}, beg {b}, end {e} {
 }
@@ -319,7 +319,7 @@ inline void ChromeObserver::on_exit(WorkerView wv, TaskView tv) {
   _timeline.stacks[w].pop();
 
   _timeline.segments[w].emplace_back(
-    tv.name(), beg, observer_stamp_t::clock::now()
+    tv.task_name(), beg, observer_stamp_t::clock::now()
   );
 }
 
@@ -705,7 +705,7 @@ inline void TFProfObserver::on_exit(WorkerView wv, TaskView tv) {
   _stacks[w].pop();
 
   _timeline.segments[w][_stacks[w].size()].emplace_back(
-    tv.name(), tv.type(), beg, observer_stamp_t::clock::now()
+    tv.task_name(), tv.type(), beg, observer_stamp_t::clock::now()
   );
 }
 
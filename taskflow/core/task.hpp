@@ -198,6 +198,7 @@ class Task {
   friend class Taskflow;
   friend class TaskView;
   friend class Executor;
+  friend class GraphBuilder;
 
   public:
 
@@ -265,6 +266,27 @@ class Task {
     */
     Task& name(const std::string& name);
 
+    /**
+    @brief assigns a numbered name to the task
+
+    @param prefix a @std_string acceptable prefix
+    @param number the number appended to the prefix
+
+    @return @c *this
+
+    The name is <tt>prefix-number</tt>.
+    */
+    Task& name(const std::string& prefix, size_t number);
+
+    /**
+    @brief assigns a name to the task
+
+    @param name a tf::TaskName, such as a numbered name of tf::TaskName::literal
+
+    @return @c *this
+    */
+    Task& name(const TaskName& name);
+
     /**
     @brief assigns a callable
 
@@ -539,6 +561,18 @@ inline bool Task::operator != (const Task& rhs) const {
 
 // Function: name
 inline Task& Task::name(const std::string& name) {
+  _node->_name = TaskName(name);
+  return *this;
+}
+
+// Function: name
+inline Task& Task::name(const std::string& prefix, size_t number) {
+  _node->_name = TaskName(prefix + '-' + std::to_string(number));
+  return *this;
+}
+
+// Function: name
+inline Task& Task::name(const TaskName& name) {
   _node->_name = name;
   return *this;
 }
@@ -574,7 +608,7 @@ inline void Task::reset_work() {
 
 // Function: name
 inline const std::string& Task::name() const {
-  return _node->_name;
+  return _node->name();
 }
 
 // Function: num_dependents
@@ -649,8 +683,8 @@ inline size_t Task::hash_value() const {
 // Procedure: dump
 inline void Task::dump(std::ostream& os) const {
   os << "task ";
-  if(name().empty()) os << _node;
-  else os << name();
+  if(_node->_name.empty()) os << _node;
+  else os << _node->_name;
   os << " [type=" << to_string(type()) << ']';
 }
 
@@ -758,9 +792,21 @@ class TaskView {
 
     /**
     @brief queries the name of the task
+
+    A task spawned by a parallel algorithm for a chunk of its range
+    carries a numbered name, such as @c loop-3, which is formatted
+    the first time its name is asked for.
     */
     const std::string& name() const;
 
+    /**
+    @brief queries the name of the task as a tf::TaskName
+
+    The returned object can be copied, e.g., to a per-task observer record,
+    without formatting a numbered name.
+    */
+    const TaskName& task_name() const;
+
     /**
     @brief queries the number of successors of the task
     */
@@ -817,6 +863,11 @@ inline TaskView::TaskView(const Node& node) : _node {node} {
 
 // Function: name
 inline const std::string& TaskView::name() const {
+  return _node.name();
+}
+
+// Function: task_name
+inline const TaskName& TaskView::task_name() const {
   return _node._name;
 }
 
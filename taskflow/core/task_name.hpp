@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <ostream>
+#include <utility>
+
+/**
+@file task_name.hpp
+@brief task name include file
+*/
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// Class: TaskName
+// ----------------------------------------------------------------------------
+
+/**
+@class TaskName
+
+@brief class to store the name of a task
+
+A task name is either empty, a string owned by the name,
+or a numbered name that pairs a string literal prefix with a number and is
+formatted as <tt>prefix-number</tt> only when it is printed
+or asked for by tf::Task::name or tf::TaskView::name.
+The parallel algorithms name the tasks they spawn for each chunk
+(e.g., the @c loop-3 task of tf::FlowBuilder::for_each) with numbered names,
+which costs neither a string nor a memory allocation per task,
+and an observer can record such a name without formatting it.
+
+@code{.cpp}
+tf::TaskName a("A");                                // owns the string "A"
+tf::TaskName b = tf::TaskName::literal("loop", 7);  // formatted as "loop-7"
+
+assert(a.str() == "A");
+assert(b.str() == "loop-7");
+assert(b != tf::TaskName("loop-7"));  // different representations
+@endcode
+*/
+class TaskName {
+
+  friend class Node;
+
+  public:
+
+    /**
+    @brief constructs an empty name
+    */
+    TaskName() = default;
+
+    /**
+    @brief constructs a name from a string
+    */
+    TaskName(std::string name);
+
+    /**
+    @brief constructs a numbered name from a string literal prefix
+
+    The literal is referenced directly and must outlive the name.
+    */
+    template <size_t N>
+    static TaskName literal(const char (&prefix)[N], size_t number);
+
+    /**
+    @brief queries if the name is empty
+    */
+    bool empty() const;
+
+    /**
+    @brief formats the name into a string
+    */
+    std::string str() const;
+
+    /**
+    @brief compares two names by their representations
+    */
+    bool operator == (const TaskName& rhs) const;
+
+    /**
+    @brief compares two names by their representations
+    */
+    bool operator != (const TaskName& rhs) const;
+
+    /**
+    @private
+    */
+    template <typename Archiver>
+    auto save(Archiver& ar) const -> decltype(ar(std::declval<std::string&>())) {
+      auto name = str();
+      return ar(name);
+    }
+
+    /**
+    @private
+    */
+    template <typename Archiver>
+    auto load(Archiver& ar) -> decltype(ar(std::declval<std::string&>())) {
+      std::string name;
+      auto sz = ar(name);
+      *this = TaskName(std::move(name));
+      return sz;
+    }
+
+  private:
+
+    friend std::ostream& operator << (std::ostream&, const TaskName&);
+
+    mutable std::string _name;
+    const char* _prefix {nullptr};
+    size_t _number {0};
+};
+
+// Constructor
+inline TaskName::TaskName(std::string name) : _name {std::move(name)} {
+}
+
+// Function: literal
+template <size_t N>
+TaskName TaskName::literal(const char (&prefix)[N], size_t number) {
+  TaskName name;
+  name._prefix = prefix;
+  name._number = number;
+  return name;
+}
+
+// Function: empty
+inline bool TaskName::empty() const {
+  return _prefix == nullptr && _name.empty();
+}
+
+// Function: str
+inline std::string TaskName::str() const {
+  if(_prefix == nullptr) {
+    return _name;
+  }
+  std::string name(_prefix);
+  name += '-';
+  name += std::to_string(_number);
+  return name;
+}
+
+// Operator: ==
+inline bool TaskName::operator == (const TaskName& rhs) const {
+  if(_prefix == nullptr || rhs._prefix == nullptr) {
+    return _prefix == rhs._prefix && _name == rhs._name;
+  }
+  return _number == rhs._number &&
+         (_prefix == rhs._prefix || std::strcmp(_prefix, rhs._prefix) == 0);
+}
+
+// Operator: !=
+inline bool TaskName::operator != (const TaskName& rhs) const {
+  return !(*this == rhs);
+}
+
+/**
+@brief overload of ostream inserter operator for TaskName
+*/
+inline std::ostream& operator << (std::ostream& os, const TaskName& name) {
+  if(name._prefix) {
+    os << name._prefix << '-' << name._number;
+  }
+  else {
+    os << name._name;
+  }
+  return os;
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -66,6 +66,11 @@ the taskflow to another.
 To minimize the overhead of task creation,
 our runtime leverages a global object pool to recycle
 tasks in a thread-safe manner.
+A taskflow can instead select another tf::NodePool,
+for instance, the pool owned by the executor that runs it,
+as long as the pool outlives the taskflow.
+A transient taskflow can also be constructed over a tf::MonotonicArena,
+from which its tasks are bump-allocated and reclaimed in bulk.
 
 Please refer to @ref Cookbook to learn more about each task type
 and how to submit a taskflow to an executor.
@@ -75,6 +80,7 @@ class Taskflow : public FlowBuilder {
   friend class Topology;
   friend class Executor;
   friend class FlowBuilder;
+  friend class GraphBuilder;
 
   struct Dumper {
     size_t id;
@@ -99,6 +105,57 @@ class Taskflow : public FlowBuilder {
     */
     Taskflow();
 
+    /**
+    @brief constructs a taskflow with the given name whose tasks are
+           allocated from the given node pool
+
+    @code{.cpp}
+    tf::Executor executor;
+    tf::Taskflow taskflow("tenant", executor.node_pool());
+    @endcode
+
+    The pool must outlive the taskflow.
+    */
+    Taskflow(const std::string& name, NodePool& pool);
+
+    /**
+    @brief constructs a taskflow whose tasks are allocated from the given
+           node pool
+    */
+    explicit Taskflow(NodePool& pool);
+
+    /**
+    @brief constructs a taskflow with the given name whose tasks are
+           bump-allocated from the given arena
+
+    Clearing or destroying the taskflow destroys its tasks and then
+    resets the arena in one step, which keeps the arena chunks
+    for the next taskflow built over it.
+    This is most useful for large taskflows that are built and discarded
+    repeatedly, such as per-request graphs:
+
+    @code{.cpp}
+    tf::MonotonicArena arena;
+    for(auto& request : requests) {
+      tf::Taskflow taskflow("request", arena);
+      build_graph(taskflow, request);
+      executor.run(taskflow).wait();
+    }  // bulk teardown
+    @endcode
+
+    The arena must outlive the taskflow and must not back any other
+    object at the same time.
+    Tasks spawned by subflows at runtime are still allocated from the
+    default node pool.
+    */
+    Taskflow(const std::string& name, MonotonicArena& arena);
+
+    /**
+    @brief constructs a taskflow whose tasks are bump-allocated from
+           the given arena
+    */
+    explicit Taskflow(MonotonicArena& arena);
+
     /**
     @brief constructs a taskflow from a moved taskflow
 
@@ -288,6 +345,32 @@ inline Taskflow::Taskflow(const std::string& name) :
 inline Taskflow::Taskflow() : FlowBuilder{_graph} {
 }
 
+// Constructor
+inline Taskflow::Taskflow(const std::string& name, NodePool& pool) :
+  FlowBuilder {_graph},
+  _name       {name},
+  _graph      {pool} {
+}
+
+// Constructor
+inline Taskflow::Taskflow(NodePool& pool) :
+  FlowBuilder {_graph},
+  _graph      {pool} {
+}
+
+// Constructor
+inline Taskflow::Taskflow(const std::string& name, MonotonicArena& arena) :
+  FlowBuilder {_graph},
+  _name       {name},
+  _graph      {arena} {
+}
+
+// Constructor
+inline Taskflow::Taskflow(MonotonicArena& arena) :
+  FlowBuilder {_graph},
+  _graph      {arena} {
+}
+
 // Move constructor
 inline Taskflow::Taskflow(Taskflow&& rhs) : FlowBuilder{_graph} {
 
@@ -483,14 +566,14 @@ inline void Taskflow::_dump(
 
     case Node::CUDAFLOW: {
       absl::get_if<Node::cudaFlow>(&node->_handle)->graph->dump(
-        os, node, node->_name
+        os, node, node->_name.str()
       );
     }
     break;
 
     case Node::SYCLFLOW: {
       absl::get_if<Node::syclFlow>(&node->_handle)->graph->dump(
-        os, node, node->_name
+        os, node, node->_name.str()
       );
     }
     break;
@@ -3,6 +3,7 @@
 #include "declarations.hpp"
 #include "tsq.hpp"
 #include "notifier.hpp"
+#include "../utility/object_pool.hpp"
 
 /**
 @file worker.hpp
@@ -28,6 +29,7 @@ using tf::WorkerInterface.
 class Worker {
 
   friend class Executor;
+  friend class Subflow;
   friend class WorkerView;
 
   public:
@@ -66,6 +68,7 @@ class Worker {
     Notifier::Waiter* _waiter;
     std::default_random_engine _rdgen { std::random_device{}() };
     TaskQueue<Node*> _wsq;
+    ObjectCache<Node> _node_cache;
 };
 
 // ----------------------------------------------------------------------------
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/executor.hpp"
+#include "core/graph_builder.hpp"
 #include "algorithm/critical.hpp"
 #include "algorithm/for_each.hpp"
 
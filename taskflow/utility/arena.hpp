@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+namespace tf {
+
+// Class: MonotonicArena
+//
+// The class implements a monotonic (bump-pointer) allocator over a list
+// of chunks. An allocation only advances a pointer in the current chunk,
+// and memory is never given back one object at a time.
+// Instead, reset rewinds the arena to its first chunk and keeps every
+// chunk for the next round of allocations, while release returns all
+// chunks to the system allocator.
+// Objects placed in the arena are not destroyed by the arena.
+// The arena is not thread-safe.
+//
+class MonotonicArena {
+
+  struct Chunk {
+    char* data;
+    size_t size;
+  };
+
+  public:
+
+    /**
+    @brief constructs an empty arena that grows by chunks of at least
+           @c chunk_size bytes
+    */
+    explicit MonotonicArena(size_t chunk_size = 65536);
+
+    /**
+    @brief destructs the arena and returns all chunks to the system allocator
+    */
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator = (const MonotonicArena&) = delete;
+
+    /**
+    @brief allocates @c bytes bytes of memory aligned to @c align
+    */
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t));
+
+    /**
+    @brief rewinds the arena and keeps its chunks for reuse
+    */
+    void reset();
+
+    /**
+    @brief rewinds the arena and returns all chunks to the system allocator
+    */
+    void release();
+
+    /**
+    @brief queries the number of bytes handed out since the last reset
+    */
+    size_t size() const;
+
+    /**
+    @brief queries the number of bytes owned by the arena
+    */
+    size_t capacity() const;
+
+  private:
+
+    const size_t _chunk_size;
+
+    std::vector<Chunk> _chunks;
+
+    size_t _next {0};
+    size_t _size {0};
+    size_t _capacity {0};
+
+    char* _ptr {nullptr};
+    char* _end {nullptr};
+
+    void _next_chunk(size_t);
+};
+
+// Constructor
+inline MonotonicArena::MonotonicArena(size_t chunk_size) :
+  _chunk_size {chunk_size} {
+}
+
+// Destructor
+inline MonotonicArena::~MonotonicArena() {
+  release();
+}
+
+// Function: allocate
+inline void* MonotonicArena::allocate(size_t bytes, size_t align) {
+
+  auto pad = [&] () {
+    return (align - reinterpret_cast<uintptr_t>(_ptr) % align) % align;
+  };
+
+  size_t p = pad();
+
+  if(p + bytes > static_cast<size_t>(_end - _ptr)) {
+    _next_chunk(bytes + align);
+    p = pad();
+  }
+
+  char* mem = _ptr + p;
+  _ptr = mem + bytes;
+  _size += p + bytes;
+
+  return mem;
+}
+
+// Procedure: reset
+inline void MonotonicArena::reset() {
+  _next = 0;
+  _size = 0;
+  _ptr  = nullptr;
+  _end  = nullptr;
+}
+
+// Procedure: release
+inline void MonotonicArena::release() {
+  for(auto& chunk : _chunks) {
+    ::operator delete(chunk.data);
+  }
+  _chunks.clear();
+  _capacity = 0;
+  reset();
+}
+
+// Function: size
+inline size_t MonotonicArena::size() const {
+  return _size;
+}
+
+// Function: capacity
+inline size_t MonotonicArena::capacity() const {
+  return _capacity;
+}
+
+// Procedure: _next_chunk
+// moves to the next chunk kept from a previous round that has at least
+// the given number of bytes, or appends a new chunk
+inline void MonotonicArena::_next_chunk(size_t bytes) {
+
+  while(_next < _chunks.size()) {
+    auto& chunk = _chunks[_next++];
+    if(chunk.size >= bytes) {
+      _ptr = chunk.data;
+      _end = chunk.data + chunk.size;
+      return;
+    }
+  }
+
+  size_t size = std::max(_chunk_size, bytes);
+
+  _chunks.push_back({static_cast<char*>(::operator new(size)), size});
+  _next = _chunks.size();
+  _capacity += size;
+
+  _ptr = _chunks.back().data;
+  _end = _ptr + size;
+}
+
+}  // end of namespace tf -----------------------------------------------------
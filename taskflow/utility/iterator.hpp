@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace tf {
 
@@ -19,4 +21,15 @@ is_range_invalid(T beg, T end, T step) {
           (beg > end && step >=  0));
 }
 
+template <typename I, typename = void>
+struct is_random_access_iterator : std::false_type {};
+
+template <typename I>
+struct is_random_access_iterator<
+  I, decltype(void(std::declval<typename std::iterator_traits<I>::iterator_category>()))
+> : std::is_base_of<
+  std::random_access_iterator_tag,
+  typename std::iterator_traits<I>::iterator_category
+> {};
+
 }  // end of namespace tf -----------------------------------------------------
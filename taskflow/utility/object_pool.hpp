@@ -17,6 +17,7 @@
 #include <mutex>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <cstddef>
 
 namespace tf {
@@ -25,6 +26,58 @@ namespace tf {
   template <typename T, size_t S> friend class ObjectPool;  \
   void* _object_pool_block
 
+// Class: ObjectCache
+//
+// The class implements a small magazine of free object slots that sits
+// in front of the local heaps of an ObjectPool.
+// A cache is owned by exactly one thread (e.g., a worker of an executor)
+// and is therefore accessed without any synchronization.
+// Cached slots are raw memory (the objects have been destroyed) and
+// keep their parent block in the first word of the slot.
+// When the cache runs empty, the pool refills C/2 slots under a single
+// acquisition of the local heap lock; when the cache runs full, the pool
+// flushes the older C/2 slots back to their blocks in one batch.
+// From the pool's point of view, cached slots remain allocated.
+//
+template <typename T, size_t C = 64>
+class ObjectCache {
+
+  template <typename U, size_t S> friend class ObjectPool;
+
+  static_assert(C >= 2 && C % 2 == 0, "cache capacity must be an even number");
+
+  public:
+
+    /**
+    @brief constructs an empty cache
+    */
+    ObjectCache() = default;
+
+    ObjectCache(const ObjectCache&) = delete;
+    ObjectCache& operator = (const ObjectCache&) = delete;
+
+    /**
+    @brief queries the number of free slots held by the cache
+    */
+    size_t size() const { return _size; }
+
+    /**
+    @brief queries the maximum number of free slots the cache can hold
+    */
+    constexpr size_t capacity() const { return C; }
+
+    /**
+    @brief queries if the cache holds no free slot
+    */
+    bool empty() const { return _size == 0; }
+
+  private:
+
+    size_t _size {0};
+
+    T* _slots[C];
+};
+
 // Class: ObjectPool
 //
 // The class implements an efficient thread-safe object pool motivated
@@ -127,11 +180,41 @@ class ObjectPool {
     template <typename... ArgsT>
     T* animate(ArgsT&&... args);
 
+    /**
+    @brief acquires a pointer to a object constructed from a given argument list
+           using a thread-owned cache in front of the local heaps
+    */
+    template <size_t C, typename... ArgsT>
+    T* animate(ObjectCache<T, C>& cache, ArgsT&&... args);
+
     /**
     @brief recycles a object pointed by @c ptr and destroys it
     */
     void recycle(T* ptr);
 
+    /**
+    @brief recycles a object pointed by @c ptr and destroys it
+           using a thread-owned cache in front of the local heaps
+    */
+    template <size_t C>
+    void recycle(ObjectCache<T, C>& cache, T* ptr);
+
+    /**
+    @brief returns all free slots held by the given cache to the pool
+    */
+    template <size_t C>
+    void flush(ObjectCache<T, C>& cache);
+
+    /**
+    @brief releases every block that holds no allocated object
+
+    @return the number of blocks returned to the system allocator
+
+    Blocks pinned by a slot sitting in an ObjectCache are not empty
+    and stay with the pool until the cache is flushed.
+    */
+    size_t trim();
+
     size_t num_bins_per_local_heap() const;
     size_t num_objects_per_bin() const;
     size_t num_objects_per_block() const;
@@ -171,8 +254,11 @@ class ObjectPool {
     size_t _bin(size_t) const;
 
     T* _allocate(Block*);
+    T* _acquire(LocalHeap&, Block*&);
 
     void _deallocate(Block*, T*);
+    void _release(LocalHeap*, Block*, T*);
+    void _release_n(T**, size_t);
     void _blocklist_init_head(Blocklist*);
     void _blocklist_add_impl(Blocklist*, Blocklist*, Blocklist*);
     void _blocklist_push_front(Blocklist*, Blocklist*);
@@ -573,19 +659,12 @@ void ObjectPool<T, S>::_deallocate(Block* s, T* ptr) {
   s->top = ptr;
 }
 
-// Function: allocate
+// Function: _acquire
+// take one slot from the local heap (the caller must hold the heap lock)
 template <typename T, size_t S>
-template <typename... ArgsT>
-T* ObjectPool<T, S>::animate(ArgsT&&... args) {
+T* ObjectPool<T, S>::_acquire(LocalHeap& h, Block*& s) {
 
-  //std::cout << "construct a new item\n";
-
-  // my logically mapped heap
-  LocalHeap& h = _this_heap();
-
-  Block* s {nullptr};
-
-  h.mutex.lock();
+  s = nullptr;
 
   // scan the list of superblocks from most full to least
   int f = static_cast<int>(F-1);
@@ -663,6 +742,25 @@ T* ObjectPool<T, S>::animate(ArgsT&&... args) {
   //          << "h.u " << h.u  << '\n'
   //          << "h.a " << h.a  << '\n';
 
+  return mem;
+}
+
+// Function: allocate
+template <typename T, size_t S>
+template <typename... ArgsT>
+T* ObjectPool<T, S>::animate(ArgsT&&... args) {
+
+  //std::cout << "construct a new item\n";
+
+  // my logically mapped heap
+  LocalHeap& h = _this_heap();
+
+  Block* s {nullptr};
+
+  h.mutex.lock();
+
+  T* mem = _acquire(h, s);
+
   h.mutex.unlock();
 
   //printf("allocate %p (s=%p)\n", mem, s);
@@ -674,6 +772,81 @@ T* ObjectPool<T, S>::animate(ArgsT&&... args) {
   return mem;
 }
 
+// Function: animate
+// allocate from the thread-owned cache and refill it in a batch when empty
+template <typename T, size_t S>
+template <size_t C, typename... ArgsT>
+T* ObjectPool<T, S>::animate(ObjectCache<T, C>& cache, ArgsT&&... args) {
+
+  if(cache._size == 0) {
+
+    LocalHeap& h = _this_heap();
+
+    std::lock_guard<std::mutex> lock(h.mutex);
+
+    while(cache._size < C/2) {
+      Block* s {nullptr};
+      T* mem = _acquire(h, s);
+      *(reinterpret_cast<Block**>(mem)) = s;
+      cache._slots[cache._size++] = mem;
+    }
+  }
+
+  T* mem = cache._slots[--cache._size];
+
+  Block* s = *(reinterpret_cast<Block**>(mem));
+
+  new (mem) T(std::forward<ArgsT>(args)...);
+
+  mem->_object_pool_block = s;
+
+  return mem;
+}
+
+// Procedure: _release
+// return one slot to its block (the caller must hold the lock of the heap
+// that currently owns the block, or the global heap lock if h is nullptr)
+template <typename T, size_t S>
+void ObjectPool<T, S>::_release(LocalHeap* h, Block* s, T* mem) {
+
+  // the block is in global heap
+  if(h == nullptr) {
+    _deallocate(s, mem);
+    s->u = s->u - 1;
+    return;
+  }
+
+  // deallocate the item from the superblock
+  size_t f = _bin(s->u);
+  _deallocate(s, mem);
+  s->u = s->u - 1;
+  h->u = h->u - 1;
+
+  size_t b = _bin(s->u);
+
+  if(b != f) {
+    //printf("move superblock from list[%d] to list[%d]\n", f, b);
+    _blocklist_move_front(&s->list_node, &h->lists[b]);
+  }
+
+  // transfer a mostly-empty superblock to global heap
+  if((h->u + K*M < h->a) && (h->u < ((F-1) * h->a / F))) {
+    for(size_t i=0; i<F; i++) {
+      if(!_blocklist_is_empty(&h->lists[i])) {
+        Block* x = _block_of(h->lists[i].next);
+        //printf("transfer a block (x.u=%lu/x.i=%lu) to the global heap\n", x->u, x->i);
+        assert(h->u > x->u && h->a > M);
+        h->u = h->u - x->u;
+        h->a = h->a - M;
+        x->heap = nullptr;
+        std::lock_guard<std::mutex> glock(_gheap.mutex);
+        _blocklist_move_front(&x->list_node, &_gheap.list);
+        break;
+      }
+    }
+  }
+}
+
 // Function: destruct
 template <typename T, size_t S>
 void ObjectPool<T, S>::recycle(T* mem) {
@@ -697,54 +870,110 @@ void ObjectPool<T, S>::recycle(T* mem) {
   do {
     LocalHeap* h = s->heap.load(std::memory_order_relaxed);
 
-    // the block is in global heap
-    if(h == nullptr) {
-      std::lock_guard<std::mutex> glock(_gheap.mutex);
+    std::lock_guard<std::mutex> lock(h ? h->mutex : _gheap.mutex);
+
+    if(s->heap == h) {
+      sync = true;
+      _release(h, s, mem);
+    }
+  } while(!sync);
+
+  //std::cout << "s.i " << s->i << '\n'
+  //          << "s.u " << s->u << '\n';
+}
+
+// Procedure: _release_n
+// return a batch of cached slots to their blocks, reusing the heap lock
+// across consecutive slots that belong to the same heap
+template <typename T, size_t S>
+void ObjectPool<T, S>::_release_n(T** mems, size_t n) {
+
+  std::unique_lock<std::mutex> lock;
+
+  for(size_t i=0; i<n; ++i) {
+
+    T* mem = mems[i];
+    Block* s = *(reinterpret_cast<Block**>(mem));
+
+    while(1) {
+      LocalHeap* h = s->heap.load(std::memory_order_relaxed);
+      std::mutex* m = h ? &h->mutex : &_gheap.mutex;
+
+      if(lock.mutex() != m) {
+        if(lock.owns_lock()) {
+          lock.unlock();
+        }
+        lock = std::unique_lock<std::mutex>(*m);
+      }
+
       if(s->heap == h) {
-        sync = true;
-        _deallocate(s, mem);
-        s->u = s->u - 1;
+        _release(h, s, mem);
+        break;
       }
     }
-    else {
-      std::lock_guard<std::mutex> llock(h->mutex);
-      if(s->heap == h) {
-        sync = true;
-        // deallocate the item from the superblock
-        size_t f = _bin(s->u);
-        _deallocate(s, mem);
-        s->u = s->u - 1;
-        h->u = h->u - 1;
-
-        size_t b = _bin(s->u);
-
-        if(b != f) {
-          //printf("move superblock from list[%d] to list[%d]\n", f, b);
-          _blocklist_move_front(&s->list_node, &h->lists[b]);
-        }
+  }
+}
 
-        // transfer a mostly-empty superblock to global heap
-        if((h->u + K*M < h->a) && (h->u < ((F-1) * h->a / F))) {
-          for(size_t i=0; i<F; i++) {
-            if(!_blocklist_is_empty(&h->lists[i])) {
-              Block* x = _block_of(h->lists[i].next);
-              //printf("transfer a block (x.u=%lu/x.i=%lu) to the global heap\n", x->u, x->i);
-              assert(h->u > x->u && h->a > M);
-              h->u = h->u - x->u;
-              h->a = h->a - M;
-              x->heap = nullptr;
-              std::lock_guard<std::mutex> glock(_gheap.mutex);
-              _blocklist_move_front(&x->list_node, &_gheap.list);
-              break;
-            }
-          }
-        }
+// Procedure: recycle
+// destroy the object into the thread-owned cache and flush the older half
+// of the cache in a batch when it is full
+template <typename T, size_t S>
+template <size_t C>
+void ObjectPool<T, S>::recycle(ObjectCache<T, C>& cache, T* mem) {
+
+  Block* s = static_cast<Block*>(mem->_object_pool_block);
+
+  mem->~T();
+
+  *(reinterpret_cast<Block**>(mem)) = s;
+
+  if(cache._size == C) {
+    _release_n(cache._slots, C/2);
+    std::copy(cache._slots + C/2, cache._slots + C, cache._slots);
+    cache._size = C/2;
+  }
+
+  cache._slots[cache._size++] = mem;
+}
+
+// Procedure: flush
+template <typename T, size_t S>
+template <size_t C>
+void ObjectPool<T, S>::flush(ObjectCache<T, C>& cache) {
+  _release_n(cache._slots, cache._size);
+  cache._size = 0;
+}
+
+// Function: trim
+template <typename T, size_t S>
+size_t ObjectPool<T, S>::trim() {
+
+  size_t n = 0;
+
+  // an empty block of a local heap always sits in the first bin
+  for(auto& h : _lheaps) {
+    std::lock_guard<std::mutex> lock(h.mutex);
+    _for_each_block_safe(&h.lists[0], [&] (Block* b) {
+      if(b->u == 0) {
+        _blocklist_del(&b->list_node);
+        h.a -= M;
+        delete b;
+        ++n;
       }
+    });
+  }
+
+  // global heap
+  std::lock_guard<std::mutex> glock(_gheap.mutex);
+  _for_each_block_safe(&_gheap.list, [&] (Block* b) {
+    if(b->u == 0) {
+      _blocklist_del(&b->list_node);
+      delete b;
+      ++n;
     }
-  } while(!sync);
+  });
 
-  //std::cout << "s.i " << s->i << '\n'
-  //          << "s.u " << s->u << '\n';
+  return n;
 }
 
 // Function: _this_heap
@@ -6,6 +6,8 @@
 #include <taskflow/algorithm/sort.hpp>
 #include <taskflow/algorithm/transform.hpp>
 
+#include <numeric>
+
 // ----------------------------------------------------------------------------
 // Data Type
 // ----------------------------------------------------------------------------
@@ -38,10 +40,174 @@ struct MoveOnly2{
 
 };
 
+// --------------------------------------------------------
+// Testcase: Partitioner
+// --------------------------------------------------------
+
+// runs the loop of every worker sequentially and checks that the chunks
+// cover [0, N) exactly once and arrive in increasing order per worker
+template <typename P>
+void partition(const P& part) {
+  for(size_t N=0; N<=300; N+=7) {
+    for(size_t W=1; W<=9; W++) {
+      std::vector<int> visits(N, 0);
+      std::atomic<size_t> next(0);
+      for(size_t w=0; w<W; w++) {
+        size_t prev = 0;
+        part.loop(N, W, w, next, [&](size_t beg, size_t end){
+          REQUIRE(beg < end);
+          REQUIRE(end <= N);
+          REQUIRE(beg >= prev);
+          prev = end;
+          for(size_t i=beg; i<end; i++) {
+            visits[i]++;
+          }
+        });
+      }
+      for(auto v : visits) {
+        REQUIRE(v == 1);
+      }
+
+      // a dynamic partitioner counts the claimed iterations in next,
+      // from which _launch_loop learns that no worker is left to spawn
+      if(P::type() == tf::PartitionerType::DYNAMIC) {
+        REQUIRE(next >= N);
+      }
+
+      // loop_until hands out no chunk after the one that stops a worker
+      next = 0;
+      for(size_t w=0; w<W; w++) {
+        bool stopped = false;
+        part.loop_until(N, W, w, next, [&](size_t beg, size_t){
+          REQUIRE(!stopped);
+          stopped = (beg >= N/2);
+          return stopped;
+        });
+      }
+    }
+  }
+}
+
+TEST_CASE("Partitioner" * doctest::timeout(300)) {
+  for(size_t c=0; c<=17; c=c*2+1) {
+    partition(tf::GuidedPartitioner(c));
+    partition(tf::DynamicPartitioner(c));
+    partition(tf::StaticPartitioner(c));
+    partition(tf::AdaptivePartitioner(c));
+    partition(tf::DeterministicPartitioner(c));
+  }
+}
+
+TEST_CASE("Partitioner.Adaptive" * doctest::timeout(300)) {
+
+  const size_t N = 1000000;
+
+  std::vector<size_t> sizes;
+  std::atomic<size_t> next(0);
+
+  auto record = [&](size_t beg, size_t end){ sizes.push_back(end - beg); };
+
+  // cheap chunks grow beyond the minimum chunk size
+  tf::AdaptivePartitioner(4).loop(N, 1, 0, next, record);
+  REQUIRE(sizes.front() == 4);
+  REQUIRE(*std::max_element(sizes.begin(), sizes.end()) > 4);
+  REQUIRE(sizes.size() < N/4);
+
+  // chunks never exceed the target and stay at the minimum chunk size
+  sizes.clear();
+  next = 0;
+  tf::AdaptivePartitioner(4, std::chrono::nanoseconds(0)).loop(
+    1000, 1, 0, next, record
+  );
+  REQUIRE(sizes.size() == 250);
+  for(auto s : sizes) {
+    REQUIRE(s == 4);
+  }
+}
+
+// the affinity partitioner hands out every chunk once per run, and a thread
+// gets back the chunks it ran in the previous run before any other chunk
+TEST_CASE("Partitioner.Affinity" * doctest::timeout(300)) {
+
+  for(size_t c=0; c<=17; c=c*2+1) {
+    for(size_t N=0; N<=300; N+=7) {
+      for(size_t W=1; W<=9; W++) {
+        tf::AffinityPartitioner part(c);
+        for(int run=0; run<3; run++) {
+          std::vector<int> visits(N, 0);
+          std::atomic<size_t> next(0);
+          tf::detail::prepare_partitioner(part, N, W);
+          for(size_t w=0; w<W; w++) {
+            part.loop(N, W, w, next, [&](size_t beg, size_t end){
+              REQUIRE(beg < end);
+              REQUIRE(end <= N);
+              for(size_t i=beg; i<end; i++) {
+                visits[i]++;
+              }
+            });
+          }
+          for(auto v : visits) {
+            REQUIRE(v == 1);
+          }
+        }
+      }
+    }
+  }
+
+  const size_t N = 1000;
+
+  tf::AffinityPartitioner part(100);
+  std::atomic<size_t> next(0);
+  std::vector<size_t> begs;
+
+  // this thread runs the first chunk and another thread runs the others
+  tf::detail::prepare_partitioner(part, N, 2);
+  part.loop_until(N, 2, 0, next, [](size_t, size_t){ return true; });
+  std::thread([&](){ part.loop(N, 2, 1, next, [](size_t, size_t){}); }).join();
+  REQUIRE(next == N);
+
+  // as the second worker, this thread starts with the first chunk and
+  // steals the others from the middle of the range
+  next = 0;
+  tf::detail::prepare_partitioner(part, N, 2);
+  part.loop(N, 2, 1, next, [&](size_t beg, size_t){ begs.push_back(beg); });
+  REQUIRE(begs.size() == 10);
+  REQUIRE(begs[0] == 0);
+  REQUIRE(begs[1] == 500);
+  REQUIRE(begs[9] == 400);
+
+  // a range the partitioner is not prepared for is still run in full,
+  // and an early stop sees its chunks in increasing order
+  for(size_t M : {size_t{1}, size_t{999}, size_t{1001}}) {
+    std::vector<int> visits(M, 0);
+    begs.clear();
+    next = 0;
+    part.loop_until(M, 2, 0, next, [&](size_t beg, size_t){
+      begs.push_back(beg);
+      return beg >= M/2;
+    });
+    REQUIRE(std::is_sorted(begs.begin(), begs.end()));
+    next = 0;
+    for(size_t w=0; w<2; w++) {
+      part.loop(M, 2, w, next, [&](size_t beg, size_t end){
+        REQUIRE(beg < end);
+        REQUIRE(end <= M);
+        for(size_t i=beg; i<end; i++) {
+          visits[i]++;
+        }
+      });
+    }
+    for(auto v : visits) {
+      REQUIRE(v == 1);
+    }
+  }
+}
+
 // --------------------------------------------------------
 // Testcase: for_each
 // --------------------------------------------------------
 
+template <typename P>
 void for_each(unsigned W) {
 
   tf::Executor executor(W);
@@ -63,7 +229,7 @@ void for_each(unsigned W) {
         taskflow.for_each_index(beg, end, s, [&](int i){
           counter++;
           vec[i-beg] = i;
-        });
+        }, P(c));
 
         executor.run(taskflow).wait();
         REQUIRE(counter == (n + s - 1) / s);
@@ -91,7 +257,7 @@ void for_each(unsigned W) {
       taskflow.for_each(vec.begin(), vec.begin() + n, [&](int& i){
         counter++;
         i = 1;
-      });
+      }, P(c));
 
       executor.run(taskflow).wait();
       REQUIRE(counter == n);
@@ -108,57 +274,126 @@ void for_each(unsigned W) {
 }
 
 TEST_CASE("ParallelFor.1thread" * doctest::timeout(300)) {
-  for_each(1);
+  for_each<tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("ParallelFor.2threads" * doctest::timeout(300)) {
-  for_each(2);
+  for_each<tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("ParallelFor.3threads" * doctest::timeout(300)) {
-  for_each(3);
+  for_each<tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("ParallelFor.4threads" * doctest::timeout(300)) {
-  for_each(4);
+  for_each<tf::GuidedPartitioner>(4);
 }
 
 TEST_CASE("ParallelFor.5threads" * doctest::timeout(300)) {
-  for_each(5);
+  for_each<tf::GuidedPartitioner>(5);
 }
 
 TEST_CASE("ParallelFor.6threads" * doctest::timeout(300)) {
-  for_each(6);
+  for_each<tf::GuidedPartitioner>(6);
 }
 
 TEST_CASE("ParallelFor.7threads" * doctest::timeout(300)) {
-  for_each(7);
+  for_each<tf::GuidedPartitioner>(7);
 }
 
 TEST_CASE("ParallelFor.8threads" * doctest::timeout(300)) {
-  for_each(8);
+  for_each<tf::GuidedPartitioner>(8);
 }
 
 TEST_CASE("ParallelFor.9threads" * doctest::timeout(300)) {
-  for_each(9);
+  for_each<tf::GuidedPartitioner>(9);
 }
 
 TEST_CASE("ParallelFor.10threads" * doctest::timeout(300)) {
-  for_each(10);
+  for_each<tf::GuidedPartitioner>(10);
 }
 
 TEST_CASE("ParallelFor.11threads" * doctest::timeout(300)) {
-  for_each(11);
+  for_each<tf::GuidedPartitioner>(11);
 }
 
 TEST_CASE("ParallelFor.12threads" * doctest::timeout(300)) {
-  for_each(12);
+  for_each<tf::GuidedPartitioner>(12);
+}
+
+// static
+TEST_CASE("ParallelFor.Static.1thread" * doctest::timeout(300)) {
+  for_each<tf::StaticPartitioner>(1);
+}
+
+TEST_CASE("ParallelFor.Static.2threads" * doctest::timeout(300)) {
+  for_each<tf::StaticPartitioner>(2);
+}
+
+TEST_CASE("ParallelFor.Static.4threads" * doctest::timeout(300)) {
+  for_each<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("ParallelFor.Static.8threads" * doctest::timeout(300)) {
+  for_each<tf::StaticPartitioner>(8);
+}
+
+// dynamic
+TEST_CASE("ParallelFor.Dynamic.1thread" * doctest::timeout(300)) {
+  for_each<tf::DynamicPartitioner>(1);
+}
+
+TEST_CASE("ParallelFor.Dynamic.2threads" * doctest::timeout(300)) {
+  for_each<tf::DynamicPartitioner>(2);
+}
+
+TEST_CASE("ParallelFor.Dynamic.4threads" * doctest::timeout(300)) {
+  for_each<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("ParallelFor.Dynamic.8threads" * doctest::timeout(300)) {
+  for_each<tf::DynamicPartitioner>(8);
+}
+
+// adaptive
+TEST_CASE("ParallelFor.Adaptive.1thread" * doctest::timeout(300)) {
+  for_each<tf::AdaptivePartitioner>(1);
+}
+
+TEST_CASE("ParallelFor.Adaptive.2threads" * doctest::timeout(300)) {
+  for_each<tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("ParallelFor.Adaptive.4threads" * doctest::timeout(300)) {
+  for_each<tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("ParallelFor.Adaptive.8threads" * doctest::timeout(300)) {
+  for_each<tf::AdaptivePartitioner>(8);
+}
+
+// affinity
+TEST_CASE("ParallelFor.Affinity.1thread" * doctest::timeout(300)) {
+  for_each<tf::AffinityPartitioner>(1);
+}
+
+TEST_CASE("ParallelFor.Affinity.2threads" * doctest::timeout(300)) {
+  for_each<tf::AffinityPartitioner>(2);
+}
+
+TEST_CASE("ParallelFor.Affinity.4threads" * doctest::timeout(300)) {
+  for_each<tf::AffinityPartitioner>(4);
+}
+
+TEST_CASE("ParallelFor.Affinity.8threads" * doctest::timeout(300)) {
+  for_each<tf::AffinityPartitioner>(8);
 }
 
 // ----------------------------------------------------------------------------
 // stateful_for_each
 // ----------------------------------------------------------------------------
 
+template <typename P>
 void stateful_for_each(unsigned W) {
 
   tf::Executor executor(W);
@@ -194,13 +429,13 @@ void stateful_for_each(unsigned W) {
       std::ref(beg), std::ref(end), [&](int& i){
       counter++;
       i = 8;
-    });
+    }, P(c));
 
     pf2 = taskflow.for_each_index(
       std::ref(ibeg), std::ref(iend), size_t{1}, [&] (size_t i) {
         counter++;
         vec[i] = -8;
-    });
+    }, P(c));
 
     init.precede(pf1, pf2);
 
@@ -222,57 +457,382 @@ void stateful_for_each(unsigned W) {
 
 // guided
 TEST_CASE("StatefulParallelFor.1thread" * doctest::timeout(300)) {
-  stateful_for_each(1);
+  stateful_for_each<tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("StatefulParallelFor.2threads" * doctest::timeout(300)) {
-  stateful_for_each(2);
+  stateful_for_each<tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("StatefulParallelFor.3threads" * doctest::timeout(300)) {
-  stateful_for_each(3);
+  stateful_for_each<tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("StatefulParallelFor.4threads" * doctest::timeout(300)) {
-  stateful_for_each(4);
+  stateful_for_each<tf::GuidedPartitioner>(4);
 }
 
 TEST_CASE("StatefulParallelFor.5threads" * doctest::timeout(300)) {
-  stateful_for_each(5);
+  stateful_for_each<tf::GuidedPartitioner>(5);
 }
 
 TEST_CASE("StatefulParallelFor.6threads" * doctest::timeout(300)) {
-  stateful_for_each(6);
+  stateful_for_each<tf::GuidedPartitioner>(6);
 }
 
 TEST_CASE("StatefulParallelFor.7threads" * doctest::timeout(300)) {
-  stateful_for_each(7);
+  stateful_for_each<tf::GuidedPartitioner>(7);
 }
 
 TEST_CASE("StatefulParallelFor.8threads" * doctest::timeout(300)) {
-  stateful_for_each(8);
+  stateful_for_each<tf::GuidedPartitioner>(8);
 }
 
 TEST_CASE("StatefulParallelFor.9threads" * doctest::timeout(300)) {
-  stateful_for_each(9);
+  stateful_for_each<tf::GuidedPartitioner>(9);
 }
 
 TEST_CASE("StatefulParallelFor.10threads" * doctest::timeout(300)) {
-  stateful_for_each(10);
+  stateful_for_each<tf::GuidedPartitioner>(10);
 }
 
 TEST_CASE("StatefulParallelFor.11threads" * doctest::timeout(300)) {
-  stateful_for_each(11);
+  stateful_for_each<tf::GuidedPartitioner>(11);
 }
 
 TEST_CASE("StatefulParallelFor.12threads" * doctest::timeout(300)) {
-  stateful_for_each(12);
+  stateful_for_each<tf::GuidedPartitioner>(12);
+}
+
+// static
+TEST_CASE("StatefulParallelFor.Static.1thread" * doctest::timeout(300)) {
+  stateful_for_each<tf::StaticPartitioner>(1);
+}
+
+TEST_CASE("StatefulParallelFor.Static.2threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::StaticPartitioner>(2);
+}
+
+TEST_CASE("StatefulParallelFor.Static.4threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("StatefulParallelFor.Static.8threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::StaticPartitioner>(8);
+}
+
+// dynamic
+TEST_CASE("StatefulParallelFor.Dynamic.1thread" * doctest::timeout(300)) {
+  stateful_for_each<tf::DynamicPartitioner>(1);
+}
+
+TEST_CASE("StatefulParallelFor.Dynamic.2threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::DynamicPartitioner>(2);
+}
+
+TEST_CASE("StatefulParallelFor.Dynamic.4threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("StatefulParallelFor.Dynamic.8threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::DynamicPartitioner>(8);
+}
+
+// adaptive
+TEST_CASE("StatefulParallelFor.Adaptive.1thread" * doctest::timeout(300)) {
+  stateful_for_each<tf::AdaptivePartitioner>(1);
+}
+
+TEST_CASE("StatefulParallelFor.Adaptive.2threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("StatefulParallelFor.Adaptive.4threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("StatefulParallelFor.Adaptive.8threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::AdaptivePartitioner>(8);
+}
+
+// affinity
+TEST_CASE("StatefulParallelFor.Affinity.1thread" * doctest::timeout(300)) {
+  stateful_for_each<tf::AffinityPartitioner>(1);
+}
+
+TEST_CASE("StatefulParallelFor.Affinity.4threads" * doctest::timeout(300)) {
+  stateful_for_each<tf::AffinityPartitioner>(4);
+}
+
+// --------------------------------------------------------
+// Testcase: for_each_range
+// --------------------------------------------------------
+
+template <typename P>
+void for_each_range(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=5000; n=n*3+1) {
+    for(size_t c : {0, 1, 7, 64}) {
+
+      std::vector<int> vec(n, 0);
+      std::list<int> lst(n, 0);
+      std::vector<int> idx(n, 0);
+      std::vector<int> pos(n, 0);
+      std::vector<int> mix(n, 0);
+      std::atomic<size_t> sum(0);
+
+      // one flag per worker index, raised while a chunk of that index runs
+      std::vector<std::atomic<int>> busy(W);
+      std::atomic<size_t> chunks(0);
+
+      tf::Taskflow taskflow;
+
+      taskflow.for_each_range(vec.begin(), vec.end(),
+        [&](std::vector<int>::iterator beg, std::vector<int>::iterator end){
+          REQUIRE(beg < end);
+          chunks++;
+          for(; beg!=end; ++beg) {
+            ++*beg;
+          }
+        }, P(c)
+      );
+
+      taskflow.for_each_range(lst.begin(), lst.end(),
+        [&](std::list<int>::iterator beg, std::list<int>::iterator end, size_t w){
+          REQUIRE(beg != end);
+          REQUIRE(w < W);
+          REQUIRE(busy[w]++ == 0);
+          for(; beg!=end; ++beg) {
+            ++*beg;
+          }
+          busy[w]--;
+        }, P(c)
+      );
+
+      taskflow.for_each_range(n, size_t{0}, [&](size_t, size_t){
+        REQUIRE(false);
+      }, P(c));
+
+      taskflow.for_each_range(size_t{0}, n, [&](size_t beg, size_t end){
+        REQUIRE(beg < end);
+        REQUIRE(end <= n);
+        for(size_t i=beg; i<end; i++) {
+          idx[i]++;
+        }
+      }, P(c));
+
+      // ends of different types
+      std::iota(mix.begin(), mix.end(), 0);
+      taskflow.for_each_range(mix.begin(), mix.cend(),
+        [&](std::vector<int>::const_iterator beg, std::vector<int>::const_iterator end){
+          sum += std::accumulate(beg, end, size_t{0});
+        }, P(c)
+      );
+
+      taskflow.for_each_range(0, n, [&](size_t beg, size_t end){
+        REQUIRE(beg < end);
+        REQUIRE(end <= n);
+        for(size_t i=beg; i<end; i++) {
+          pos[i]++;
+        }
+      }, P(c));
+
+      executor.run(taskflow).wait();
+
+      for(auto v : vec) REQUIRE(v == 1);
+      for(auto v : lst) REQUIRE(v == 1);
+      for(auto v : idx) REQUIRE(v == 1);
+      for(auto v : pos) REQUIRE(v == 1);
+      REQUIRE(sum == n * (n - (n > 0)) / 2);
+
+      REQUIRE(chunks <= n);
+      if(W > 1 && n > 1 && c == 1) {
+        REQUIRE(chunks > 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("ParallelForRange.1thread" * doctest::timeout(300)) {
+  for_each_range<tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("ParallelForRange.2threads" * doctest::timeout(300)) {
+  for_each_range<tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("ParallelForRange.4threads" * doctest::timeout(300)) {
+  for_each_range<tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("ParallelForRange.Static.4threads" * doctest::timeout(300)) {
+  for_each_range<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("ParallelForRange.Dynamic.4threads" * doctest::timeout(300)) {
+  for_each_range<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("ParallelForRange.Adaptive.4threads" * doctest::timeout(300)) {
+  for_each_range<tf::AdaptivePartitioner>(4);
+}
+
+// --------------------------------------------------------
+// Testcase: for_each_index over tiles
+// --------------------------------------------------------
+
+// every index of the box lies in exactly one tile, and no tile is
+// larger than the tile size
+template <typename P>
+void for_each_tile(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(int n : {0, 1, 7, 64, 100}) {
+    for(int t : {0, 1, 5, 32}) {
+
+      int m = n + 3;
+
+      // 2D with a negative beginning
+      std::vector<int> cells2(n * m, 0);
+      tf::IndexRange2D<int> range2({-2, 4}, {n-2, m+4}, {t, 2*t});
+
+      // 3D with a flat first dimension
+      std::vector<int> cells3(2 * n * m, 0);
+      tf::IndexRange3D<long> range3({0, 0, 0}, {2, n, m}, {1, t, t});
+
+      std::atomic<size_t> tiles2(0), tiles3(0);
+
+      tf::Taskflow taskflow;
+
+      taskflow.for_each_index(range2, [&](const tf::IndexRange2D<int>& tile){
+        REQUIRE(tile.size() > 0);
+        REQUIRE(tile.size(0) <= size_t(t ? t : n));
+        REQUIRE(tile.size(1) <= size_t(t ? 2*t : m));
+        tiles2++;
+        for(int i=tile.begin(0); i<tile.end(0); i++) {
+          for(int j=tile.begin(1); j<tile.end(1); j++) {
+            cells2[(i+2)*m + (j-4)]++;
+          }
+        }
+      }, P());
+
+      taskflow.for_each_index(range3, [&](const tf::IndexRange3D<long>& tile){
+        REQUIRE(tile.size(0) == 1);
+        tiles3++;
+        for(long k=tile.begin(0); k<tile.end(0); k++) {
+          for(long i=tile.begin(1); i<tile.end(1); i++) {
+            for(long j=tile.begin(2); j<tile.end(2); j++) {
+              cells3[(k*n + i)*m + j]++;
+            }
+          }
+        }
+      }, P());
+
+      executor.run(taskflow).wait();
+
+      for(auto c : cells2) REQUIRE(c == 1);
+      for(auto c : cells3) REQUIRE(c == 1);
+
+      REQUIRE(tiles2 == (n ? range2.num_tiles() : 0));
+      REQUIRE(tiles3 == (n ? range3.num_tiles() : 0));
+    }
+  }
+}
+
+TEST_CASE("ParallelForTile.1thread" * doctest::timeout(300)) {
+  for_each_tile<tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("ParallelForTile.2threads" * doctest::timeout(300)) {
+  for_each_tile<tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("ParallelForTile.4threads" * doctest::timeout(300)) {
+  for_each_tile<tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("ParallelForTile.Static.4threads" * doctest::timeout(300)) {
+  for_each_tile<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("ParallelForTile.Dynamic.4threads" * doctest::timeout(300)) {
+  for_each_tile<tf::DynamicPartitioner>(4);
+}
+
+// consecutive tiles form compact blocks of the grid
+TEST_CASE("ParallelForTile.Locality" * doctest::timeout(300)) {
+
+  // a single worker visits the tiles in order
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  // a grid of 16x16 tiles, wider in elements along the columns
+  tf::IndexRange2D<int> range({0, 0}, {128, 256}, {8, 16});
+
+  std::vector<std::pair<int, int>> tiles;
+
+  taskflow.for_each_index(range, [&](const tf::IndexRange2D<int>& tile){
+    tiles.emplace_back(tile.begin(0) / 8, tile.begin(1) / 16);
+  });
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(tiles.size() == 256);
+
+  // every 64 consecutive tiles form an 8x8 block, and every 32 an 8x4 block
+  // after halving the longer columns
+  for(size_t b : {64, 32}) {
+    for(size_t i=0; i<tiles.size(); i+=b) {
+      std::set<int> rows, cols;
+      for(size_t k=i; k<i+b; k++) {
+        rows.insert(tiles[k].first);
+        cols.insert(tiles[k].second);
+      }
+      REQUIRE(rows.size() == 8);
+      REQUIRE(cols.size() == b / 8);
+    }
+  }
+}
+
+// the range is decided when the task runs
+TEST_CASE("ParallelForTile.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  tf::IndexRange2D<int> range({0, 0}, {0, 0}, {0, 0});
+  std::vector<int> cells;
+
+  auto init = taskflow.emplace([&](){
+    range = tf::IndexRange2D<int>({0, 0}, {50, 60}, {7, 9});
+    cells.assign(50*60, 0);
+  });
+
+  auto loop = taskflow.for_each_index(std::ref(range),
+    [&](const tf::IndexRange2D<int>& tile){
+      for(int i=tile.begin(0); i<tile.end(0); i++) {
+        for(int j=tile.begin(1); j<tile.end(1); j++) {
+          cells[i*60 + j]++;
+        }
+      }
+    }
+  );
+
+  init.precede(loop);
+
+  executor.run(taskflow).wait();
+
+  for(auto c : cells) REQUIRE(c == 1);
 }
 
 // --------------------------------------------------------
 // Testcase: reduce
 // --------------------------------------------------------
 
+template <typename P>
 void reduce(unsigned W) {
 
   tf::Executor executor(W);
@@ -304,7 +864,7 @@ void reduce(unsigned W) {
       ptask = taskflow.reduce(
         std::ref(beg), std::ref(end), pmin, [](int& l, int& r){
         return std::min(l, r);
-      });
+      }, P(c));
 
       stask.precede(ptask);
 
@@ -319,51 +879,119 @@ void reduce(unsigned W) {
 
 // guided
 TEST_CASE("Reduce.1thread" * doctest::timeout(300)) {
-  reduce(1);
+  reduce<tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("Reduce.2threads" * doctest::timeout(300)) {
-  reduce(2);
+  reduce<tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("Reduce.3threads" * doctest::timeout(300)) {
-  reduce(3);
+  reduce<tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("Reduce.4threads" * doctest::timeout(300)) {
-  reduce(4);
+  reduce<tf::GuidedPartitioner>(4);
 }
 
 TEST_CASE("Reduce.5threads" * doctest::timeout(300)) {
-  reduce(5);
+  reduce<tf::GuidedPartitioner>(5);
 }
 
 TEST_CASE("Reduce.6threads" * doctest::timeout(300)) {
-  reduce(6);
+  reduce<tf::GuidedPartitioner>(6);
 }
 
 TEST_CASE("Reduce.7threads" * doctest::timeout(300)) {
-  reduce(7);
+  reduce<tf::GuidedPartitioner>(7);
 }
 
 TEST_CASE("Reduce.8threads" * doctest::timeout(300)) {
-  reduce(8);
+  reduce<tf::GuidedPartitioner>(8);
 }
 
 TEST_CASE("Reduce.9threads" * doctest::timeout(300)) {
-  reduce(9);
+  reduce<tf::GuidedPartitioner>(9);
 }
 
 TEST_CASE("Reduce.10threads" * doctest::timeout(300)) {
-  reduce(10);
+  reduce<tf::GuidedPartitioner>(10);
 }
 
 TEST_CASE("Reduce.11threads" * doctest::timeout(300)) {
-  reduce(11);
+  reduce<tf::GuidedPartitioner>(11);
 }
 
 TEST_CASE("Reduce.12threads" * doctest::timeout(300)) {
-  reduce(12);
+  reduce<tf::GuidedPartitioner>(12);
+}
+
+// static
+TEST_CASE("Reduce.Static.1thread" * doctest::timeout(300)) {
+  reduce<tf::StaticPartitioner>(1);
+}
+
+TEST_CASE("Reduce.Static.2threads" * doctest::timeout(300)) {
+  reduce<tf::StaticPartitioner>(2);
+}
+
+TEST_CASE("Reduce.Static.4threads" * doctest::timeout(300)) {
+  reduce<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("Reduce.Static.8threads" * doctest::timeout(300)) {
+  reduce<tf::StaticPartitioner>(8);
+}
+
+// dynamic
+TEST_CASE("Reduce.Dynamic.1thread" * doctest::timeout(300)) {
+  reduce<tf::DynamicPartitioner>(1);
+}
+
+TEST_CASE("Reduce.Dynamic.2threads" * doctest::timeout(300)) {
+  reduce<tf::DynamicPartitioner>(2);
+}
+
+TEST_CASE("Reduce.Dynamic.4threads" * doctest::timeout(300)) {
+  reduce<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("Reduce.Dynamic.8threads" * doctest::timeout(300)) {
+  reduce<tf::DynamicPartitioner>(8);
+}
+
+// adaptive
+TEST_CASE("Reduce.Adaptive.1thread" * doctest::timeout(300)) {
+  reduce<tf::AdaptivePartitioner>(1);
+}
+
+TEST_CASE("Reduce.Adaptive.2threads" * doctest::timeout(300)) {
+  reduce<tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("Reduce.Adaptive.4threads" * doctest::timeout(300)) {
+  reduce<tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("Reduce.Adaptive.8threads" * doctest::timeout(300)) {
+  reduce<tf::AdaptivePartitioner>(8);
+}
+
+// deterministic
+TEST_CASE("Reduce.Deterministic.1thread" * doctest::timeout(300)) {
+  reduce<tf::DeterministicPartitioner>(1);
+}
+
+TEST_CASE("Reduce.Deterministic.2threads" * doctest::timeout(300)) {
+  reduce<tf::DeterministicPartitioner>(2);
+}
+
+TEST_CASE("Reduce.Deterministic.4threads" * doctest::timeout(300)) {
+  reduce<tf::DeterministicPartitioner>(4);
+}
+
+TEST_CASE("Reduce.Deterministic.8threads" * doctest::timeout(300)) {
+  reduce<tf::DeterministicPartitioner>(8);
 }
 
 // ----------------------------------------------------------------------------
@@ -381,6 +1009,7 @@ class Data {
     int get() const { return _v; }
 };
 
+template <typename P>
 void transform_reduce(unsigned W) {
 
   tf::Executor executor(W);
@@ -410,7 +1039,8 @@ void transform_reduce(unsigned W) {
       ptask = taskflow.transform_reduce(
         std::ref(beg), std::ref(end), pmin,
         [] (int l, int r)   { return std::min(l, r); },
-        [] (const Data& data) { return data.get(); }
+        [] (const Data& data) { return data.get(); },
+        P(c)
       );
 
       stask.precede(ptask);
@@ -426,72 +1056,573 @@ void transform_reduce(unsigned W) {
 
 // guided
 TEST_CASE("TransformReduce.1thread" * doctest::timeout(300)) {
-  transform_reduce(1);
+  transform_reduce<tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("TransformReduce.2threads" * doctest::timeout(300)) {
-  transform_reduce(2);
+  transform_reduce<tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("TransformReduce.3threads" * doctest::timeout(300)) {
-  transform_reduce(3);
+  transform_reduce<tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("TransformReduce.4threads" * doctest::timeout(300)) {
-  transform_reduce(4);
+  transform_reduce<tf::GuidedPartitioner>(4);
 }
 
 TEST_CASE("TransformReduce.5threads" * doctest::timeout(300)) {
-  transform_reduce(5);
+  transform_reduce<tf::GuidedPartitioner>(5);
 }
 
 TEST_CASE("TransformReduce.6threads" * doctest::timeout(300)) {
-  transform_reduce(6);
+  transform_reduce<tf::GuidedPartitioner>(6);
 }
 
 TEST_CASE("TransformReduce.7threads" * doctest::timeout(300)) {
-  transform_reduce(7);
+  transform_reduce<tf::GuidedPartitioner>(7);
 }
 
 TEST_CASE("TransformReduce.8threads" * doctest::timeout(300)) {
-  transform_reduce(8);
+  transform_reduce<tf::GuidedPartitioner>(8);
 }
 
 TEST_CASE("TransformReduce.9threads" * doctest::timeout(300)) {
-  transform_reduce(9);
+  transform_reduce<tf::GuidedPartitioner>(9);
 }
 
 TEST_CASE("TransformReduce.10threads" * doctest::timeout(300)) {
-  transform_reduce(10);
+  transform_reduce<tf::GuidedPartitioner>(10);
 }
 
 TEST_CASE("TransformReduce.11threads" * doctest::timeout(300)) {
-  transform_reduce(11);
+  transform_reduce<tf::GuidedPartitioner>(11);
 }
 
 TEST_CASE("TransformReduce.12threads" * doctest::timeout(300)) {
-  transform_reduce(12);
+  transform_reduce<tf::GuidedPartitioner>(12);
 }
 
-// ----------------------------------------------------------------------------
-// Transform & Reduce on Movable Data
-// ----------------------------------------------------------------------------
+// static
+TEST_CASE("TransformReduce.Static.1thread" * doctest::timeout(300)) {
+  transform_reduce<tf::StaticPartitioner>(1);
+}
 
-void move_only_transform_reduce(unsigned W) {
+TEST_CASE("TransformReduce.Static.2threads" * doctest::timeout(300)) {
+  transform_reduce<tf::StaticPartitioner>(2);
+}
 
-  tf::Executor executor(W);
-  tf::Taskflow taskflow;
+TEST_CASE("TransformReduce.Static.4threads" * doctest::timeout(300)) {
+  transform_reduce<tf::StaticPartitioner>(4);
+}
 
-  const size_t N = 100000;
-  std::vector<MoveOnly1> vec(N);
+TEST_CASE("TransformReduce.Static.8threads" * doctest::timeout(300)) {
+  transform_reduce<tf::StaticPartitioner>(8);
+}
 
-  for(auto& i : vec) i.a = 1;
+// dynamic
+TEST_CASE("TransformReduce.Dynamic.1thread" * doctest::timeout(300)) {
+  transform_reduce<tf::DynamicPartitioner>(1);
+}
 
-  MoveOnly2 res;
-  res.b = 100;
+TEST_CASE("TransformReduce.Dynamic.2threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DynamicPartitioner>(2);
+}
 
-  taskflow.transform_reduce(vec.begin(), vec.end(), res,
-    [](MoveOnly2 m1, MoveOnly2 m2) {
+TEST_CASE("TransformReduce.Dynamic.4threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("TransformReduce.Dynamic.8threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DynamicPartitioner>(8);
+}
+
+// adaptive
+TEST_CASE("TransformReduce.Adaptive.1thread" * doctest::timeout(300)) {
+  transform_reduce<tf::AdaptivePartitioner>(1);
+}
+
+TEST_CASE("TransformReduce.Adaptive.2threads" * doctest::timeout(300)) {
+  transform_reduce<tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("TransformReduce.Adaptive.4threads" * doctest::timeout(300)) {
+  transform_reduce<tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("TransformReduce.Adaptive.8threads" * doctest::timeout(300)) {
+  transform_reduce<tf::AdaptivePartitioner>(8);
+}
+
+// deterministic
+TEST_CASE("TransformReduce.Deterministic.1thread" * doctest::timeout(300)) {
+  transform_reduce<tf::DeterministicPartitioner>(1);
+}
+
+TEST_CASE("TransformReduce.Deterministic.2threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DeterministicPartitioner>(2);
+}
+
+TEST_CASE("TransformReduce.Deterministic.4threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DeterministicPartitioner>(4);
+}
+
+TEST_CASE("TransformReduce.Deterministic.8threads" * doctest::timeout(300)) {
+  transform_reduce<tf::DeterministicPartitioner>(8);
+}
+
+// ----------------------------------------------------------------------------
+// Bidirectional Iterators
+// ----------------------------------------------------------------------------
+
+// iterators without random access walk from chunk to chunk
+template <typename P>
+void list_algorithms(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=1000; n=n*3+1) {
+
+    std::list<int> src(n), dst(n);
+    std::iota(src.begin(), src.end(), 0);
+
+    int sum = 0;
+    int sqr = 0;
+
+    tf::Taskflow taskflow;
+
+    auto A = taskflow.for_each(src.begin(), src.end(), [](int& i){ i *= 2; }, P(3));
+    auto B = taskflow.transform(src.begin(), src.end(), src.begin(), dst.begin(),
+      [](int a, int b){ return a + b; }, P(3)
+    );
+    auto C = taskflow.reduce(dst.begin(), dst.end(), sum, std::plus<int>(), P(3));
+    auto D = taskflow.transform_reduce(dst.begin(), dst.end(), sqr,
+      std::plus<int>(), [](int i){ return i / 4; }, P(3)
+    );
+
+    A.precede(B);
+    B.precede(C, D);
+
+    executor.run(taskflow).wait();
+
+    int i = 0;
+    int ref_sum = 0;
+    int ref_sqr = 0;
+    for(auto d : dst) {
+      REQUIRE(d == 4 * i++);
+      ref_sum += d;
+      ref_sqr += d / 4;
+    }
+    REQUIRE(sum == ref_sum);
+    REQUIRE(sqr == ref_sqr);
+  }
+}
+
+TEST_CASE("ListAlgorithms.4threads" * doctest::timeout(300)) {
+  list_algorithms<tf::GuidedPartitioner>(4);
+  list_algorithms<tf::DynamicPartitioner>(4);
+  list_algorithms<tf::StaticPartitioner>(4);
+  list_algorithms<tf::AdaptivePartitioner>(4);
+  list_algorithms<tf::DeterministicPartitioner>(4);
+}
+
+// ----------------------------------------------------------------------------
+// Deterministic Reduce
+// ----------------------------------------------------------------------------
+
+// floating-point sums with the deterministic partitioner are bitwise
+// identical across runs and numbers of workers
+void deterministic_reduce(size_t chunk_size) {
+
+  std::vector<double> vec(100000);
+  for(auto& d : vec) {
+    d = (::rand() % 2 ? 1e10 : 1e-10) * (::rand() % 1000 - 500);
+  }
+
+  double ref_sum = 0.0;
+  double ref_sqr = 0.0;
+  double ref_vec_sum = 0.0;
+
+  for(unsigned W=1; W<=8; W++) {
+
+    tf::Executor executor(W);
+
+    for(int r=0; r<5; r++) {
+
+      tf::Taskflow taskflow;
+
+      double sum = 1.0;
+      double sqr = 1.0;
+      double vec_sum = 1.0;
+
+      taskflow.reduce(vec.begin(), vec.end(), sum,
+        [](double a, double b){ return a + b; },
+        tf::DeterministicPartitioner(chunk_size)
+      );
+
+      taskflow.reduce(vec.begin(), vec.end(), vec_sum, std::plus<double>(),
+        tf::DeterministicPartitioner(chunk_size)
+      );
+
+      taskflow.transform_reduce(vec.begin(), vec.end(), sqr,
+        [](double a, double b){ return a + b; },
+        [](double d){ return d * d; },
+        tf::DeterministicPartitioner(chunk_size)
+      );
+
+      executor.run(taskflow).wait();
+
+      if(W == 1 && r == 0) {
+        ref_sum = sum;
+        ref_sqr = sqr;
+        ref_vec_sum = vec_sum;
+      }
+
+      REQUIRE(std::memcmp(&sum, &ref_sum, sizeof(double)) == 0);
+      REQUIRE(std::memcmp(&sqr, &ref_sqr, sizeof(double)) == 0);
+      REQUIRE(std::memcmp(&vec_sum, &ref_vec_sum, sizeof(double)) == 0);
+    }
+  }
+}
+
+TEST_CASE("Reduce.Deterministic.DefaultChunk" * doctest::timeout(300)) {
+  deterministic_reduce(0);
+}
+
+TEST_CASE("Reduce.Deterministic.Chunk7" * doctest::timeout(300)) {
+  deterministic_reduce(7);
+}
+
+TEST_CASE("Reduce.Deterministic.Chunk4096" * doctest::timeout(300)) {
+  deterministic_reduce(4096);
+}
+
+// ----------------------------------------------------------------------------
+// Vectorized Reduce
+// ----------------------------------------------------------------------------
+
+// arithmetic sums and products run through the vectorized kernel, which
+// must agree with the sequential loop; the sums of small multiples of 1/64
+// and the products of signs are exact in floating point, whatever the order
+template <typename T, typename P>
+void simd_reduce(unsigned W) {
+
+  tf::Executor executor(W);
+
+  std::vector<T> vec(5000), sgn(5000);
+  std::vector<bool> odd(5000);
+
+  for(size_t i=0; i<vec.size(); i++) {
+    vec[i] = static_cast<T>(::rand() % 64 - 32);
+    if(std::is_floating_point<T>::value) {
+      vec[i] /= 8;
+    }
+    sgn[i] = ::rand() % 2 ? T(1) : T(-1);
+    odd[i] = ::rand() % 2;
+  }
+
+  for(size_t n=0; n<=vec.size(); n=n*2+1) {
+    for(size_t c=0; c<=100; c=c*7+1) {
+
+      T sum = 1, prd = -1, sqr = 2;
+      int cnt = 0;
+
+      tf::Taskflow taskflow;
+
+      taskflow.reduce(vec.begin(), vec.begin() + n, sum, std::plus<T>(), P(c));
+      taskflow.reduce(sgn.cbegin(), sgn.cbegin() + n, prd, std::multiplies<>(), P(c));
+      taskflow.transform_reduce(vec.data(), vec.data() + n, sqr, std::plus<>(),
+        [](T v){ return v * v; }, P(c)
+      );
+      // std::vector<bool> is not contiguous and takes the generic loop
+      taskflow.transform_reduce(odd.begin(), odd.begin() + n, cnt, std::plus<int>(),
+        [](bool b){ return static_cast<int>(b); }, P(c)
+      );
+
+      executor.run(taskflow).wait();
+
+      T ref_sum = 1, ref_prd = -1, ref_sqr = 2;
+      int ref_cnt = 0;
+      for(size_t i=0; i<n; i++) {
+        ref_sum += vec[i];
+        ref_prd *= sgn[i];
+        ref_sqr += vec[i] * vec[i];
+        ref_cnt += odd[i];
+      }
+
+      REQUIRE(sum == ref_sum);
+      REQUIRE(prd == ref_prd);
+      REQUIRE(sqr == ref_sqr);
+      REQUIRE(cnt == ref_cnt);
+    }
+  }
+}
+
+template <typename P>
+void simd_reduce(unsigned W) {
+  simd_reduce<float, P>(W);
+  simd_reduce<double, P>(W);
+  simd_reduce<int, P>(W);
+}
+
+TEST_CASE("SimdReduce.1thread" * doctest::timeout(300)) {
+  simd_reduce<tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("SimdReduce.2threads" * doctest::timeout(300)) {
+  simd_reduce<tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("SimdReduce.4threads" * doctest::timeout(300)) {
+  simd_reduce<tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("SimdReduce.8threads" * doctest::timeout(300)) {
+  simd_reduce<tf::GuidedPartitioner>(8);
+}
+
+TEST_CASE("SimdReduce.Static.4threads" * doctest::timeout(300)) {
+  simd_reduce<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("SimdReduce.Dynamic.4threads" * doctest::timeout(300)) {
+  simd_reduce<tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("SimdReduce.Deterministic.4threads" * doctest::timeout(300)) {
+  simd_reduce<tf::DeterministicPartitioner>(4);
+}
+
+// the kernels of all instruction sets give the same bits, as none of them
+// contracts the transform into the sum with fused multiply-adds
+TEST_CASE("SimdReduce.Kernels" * doctest::timeout(300)) {
+
+  std::vector<double> vec(1000);
+  for(auto& v : vec) {
+    v = ::rand() / (RAND_MAX + 1.0) - 0.5;
+  }
+
+  std::plus<double> bop;
+  auto uop = [](double v){ return v * 1.1; };
+
+  for(size_t n=0; n<=vec.size(); n=n*2+1) {
+    double ref = tf::detail::simd_reduce_kernel<double>(vec.data(), n, bop, uop);
+    REQUIRE(tf::detail::simd_reduce<double>(vec.data(), n, bop, uop) == ref);
+#if defined(TF_SIMD_X86_DISPATCH)
+    if(tf::detail::simd_width() >= 32) {
+      REQUIRE(tf::detail::simd_reduce_avx2<double>(vec.data(), n, bop, uop) == ref);
+    }
+    if(tf::detail::simd_width() >= 64) {
+      REQUIRE(tf::detail::simd_reduce_avx512<double>(vec.data(), n, bop, uop) == ref);
+    }
+#endif
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Reduction by Key
+// ----------------------------------------------------------------------------
+
+// key spaces from much smaller than the input (private bins) to larger
+// than the input (shards)
+template <typename P>
+void histogram(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*7+1) {
+    for(size_t K : {1, 7, 1000, 300000}) {
+
+      std::vector<int> input(n);
+      for(auto& i : input) {
+        i = ::rand();
+      }
+
+      auto key = [K](int i){ return static_cast<size_t>(i) % K; };
+
+      // existing counts are added to
+      std::vector<size_t> bins(K, 1), golden(K, 1);
+      for(auto i : input) {
+        golden[key(i)]++;
+      }
+
+      tf::Taskflow taskflow;
+      taskflow.histogram(input.begin(), input.end(), bins, key, P());
+      executor.run(taskflow).wait();
+
+      REQUIRE(bins == golden);
+    }
+  }
+}
+
+TEST_CASE("Histogram.1thread" * doctest::timeout(300)) {
+  histogram<tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("Histogram.2threads" * doctest::timeout(300)) {
+  histogram<tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("Histogram.4threads" * doctest::timeout(300)) {
+  histogram<tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("Histogram.8threads" * doctest::timeout(300)) {
+  histogram<tf::GuidedPartitioner>(8);
+}
+
+TEST_CASE("Histogram.Static.4threads" * doctest::timeout(300)) {
+  histogram<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("Histogram.Dynamic.4threads" * doctest::timeout(300)) {
+  histogram<tf::DynamicPartitioner>(4);
+}
+
+// all elements fall into one hot bin
+TEST_CASE("Histogram.HotBin" * doctest::timeout(300)) {
+
+  std::list<int> input(100000, 3);
+
+  for(unsigned W=1; W<=8; W*=2) {
+
+    tf::Executor executor(W);
+    tf::Taskflow taskflow;
+
+    std::vector<int> bins(10, 0);
+
+    taskflow.histogram(input.begin(), input.end(), bins, [](int i){ return i; });
+    executor.run(taskflow).wait();
+
+    for(size_t k=0; k<bins.size(); k++) {
+      REQUIRE(bins[k] == (k == 3 ? 100000 : 0));
+    }
+  }
+}
+
+// concatenated strings of equal letters check that each transformed element
+// is reduced once, after the initial value of its key
+template <typename P>
+void reduce_by_key(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*7+1) {
+    for(size_t K : {1, 13, 200000}) {
+
+      std::vector<int> input(n);
+      for(auto& i : input) {
+        i = ::rand() % 1000000;
+      }
+
+      auto key = [K](int i){ return static_cast<size_t>(i) % K; };
+      auto max = [](int a, int b){ return std::max(a, b); };
+      auto neg = [](int i){ return -i; };
+      auto len = [](int i){ return std::string(i % 3, 'x'); };
+      auto cat = [](std::string a, std::string b){ return a + b; };
+
+      std::vector<long> sums(K, 5), sums_golden(K, 5);
+      std::vector<int> maxs(K, -1000000), maxs_golden(K, -1000000);
+      std::vector<std::string> strs(K, "<"), strs_golden(K, "<");
+
+      for(auto i : input) {
+        sums_golden[key(i)] += i;
+        maxs_golden[key(i)] = max(maxs_golden[key(i)], neg(i));
+        strs_golden[key(i)] += len(i);
+      }
+
+      tf::Taskflow taskflow;
+
+      taskflow.reduce_by_key(input.begin(), input.end(), sums, key,
+        std::plus<long>(), [](int i){ return long(i); }, P()
+      );
+      taskflow.reduce_by_key(input.begin(), input.end(), maxs, key, max, neg, P());
+      taskflow.reduce_by_key(input.begin(), input.end(), strs, key, cat, len, P());
+
+      executor.run(taskflow).wait();
+
+      REQUIRE(sums == sums_golden);
+      REQUIRE(maxs == maxs_golden);
+      REQUIRE(strs == strs_golden);
+    }
+  }
+}
+
+TEST_CASE("ReduceByKey.1thread" * doctest::timeout(300)) {
+  reduce_by_key<tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("ReduceByKey.2threads" * doctest::timeout(300)) {
+  reduce_by_key<tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("ReduceByKey.4threads" * doctest::timeout(300)) {
+  reduce_by_key<tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("ReduceByKey.8threads" * doctest::timeout(300)) {
+  reduce_by_key<tf::GuidedPartitioner>(8);
+}
+
+TEST_CASE("ReduceByKey.Static.4threads" * doctest::timeout(300)) {
+  reduce_by_key<tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("ReduceByKey.Dynamic.4threads" * doctest::timeout(300)) {
+  reduce_by_key<tf::DynamicPartitioner>(4);
+}
+
+// the range is decided when the task runs
+TEST_CASE("ReduceByKey.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data;
+  std::vector<int>::iterator first, last;
+  std::vector<int> bins(4, 0), sums(4, 0);
+
+  auto init = taskflow.emplace([&](){
+    data.resize(10000);
+    std::iota(data.begin(), data.end(), 0);
+    first = data.begin();
+    last  = data.end();
+  });
+
+  auto key = [](int i){ return i % 4; };
+
+  auto hist = taskflow.histogram(std::ref(first), std::ref(last), bins, key);
+  auto sum = taskflow.reduce_by_key(std::ref(first), std::ref(last), sums, key,
+    std::plus<int>(), [](int){ return 1; }
+  );
+
+  init.precede(hist, sum);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(bins == std::vector<int>(4, 2500));
+  REQUIRE(sums == std::vector<int>(4, 2500));
+}
+
+// ----------------------------------------------------------------------------
+// Transform & Reduce on Movable Data
+// ----------------------------------------------------------------------------
+
+void move_only_transform_reduce(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  const size_t N = 100000;
+  std::vector<MoveOnly1> vec(N);
+
+  for(auto& i : vec) i.a = 1;
+
+  MoveOnly2 res;
+  res.b = 100;
+
+  taskflow.transform_reduce(vec.begin(), vec.end(), res,
+    [](MoveOnly2 m1, MoveOnly2 m2) {
       MoveOnly2 res;
       res.b = m1.b + m2.b;
       return res;
@@ -732,11 +1863,402 @@ TEST_CASE("ParallelSort.MoveOnlyObject.4threads") {
   move_only_ps(4);
 }
 
+// ----------------------------------------------------------------------------
+// parallel stable sort
+// ----------------------------------------------------------------------------
+
+// sorts (key, position) pairs by key, such that the positions of equivalent
+// keys must remain increasing
+void pss_pairs(unsigned W, bool scratch) {
+
+  tf::Executor executor(W);
+
+  for(size_t N : {0, 1, 100, 4097, 10000, 100000, 300001}) {
+
+    std::vector<std::pair<int, size_t>> data(N), buffer(N);
+
+    for(size_t i=0; i<N; i++) {
+      data[i] = {::rand() % 100, i};
+    }
+
+    auto by_key = [](const auto& l, const auto& r){ return l.first < r.first; };
+
+    auto gold = data;
+    std::stable_sort(gold.begin(), gold.end(), by_key);
+
+    tf::Taskflow taskflow;
+
+    if(scratch) {
+      taskflow.stable_sort(data.begin(), data.end(), by_key, buffer.begin());
+    }
+    else {
+      taskflow.stable_sort(data.begin(), data.end(), by_key);
+    }
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(data == gold);
+  }
+}
+
+TEST_CASE("ParallelStableSort.pairs.1thread") {
+  pss_pairs(1, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.2threads") {
+  pss_pairs(2, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.3threads") {
+  pss_pairs(3, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.4threads") {
+  pss_pairs(4, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.7threads") {
+  pss_pairs(7, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.8threads") {
+  pss_pairs(8, false);
+}
+
+TEST_CASE("ParallelStableSort.pairs.Scratch.3threads") {
+  pss_pairs(3, true);
+}
+
+TEST_CASE("ParallelStableSort.pairs.Scratch.4threads") {
+  pss_pairs(4, true);
+}
+
+// a comparator that takes its arguments by value must not move
+// the elements out of the range
+TEST_CASE("ParallelStableSort.ByValueComparator") {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<std::string> data(100000);
+  for(auto& s : data) {
+    s = std::string(::rand() % 20, 'a' + ::rand() % 26);
+  }
+
+  auto by_size = [](std::string l, std::string r){ return l.size() < r.size(); };
+
+  auto gold = data;
+  std::stable_sort(gold.begin(), gold.end(), by_size);
+
+  taskflow.stable_sort(data.begin(), data.end(), by_size);
+  executor.run(taskflow).wait();
+
+  REQUIRE(data == gold);
+}
+
+void move_only_pss(unsigned W) {
+
+  std::vector<MoveOnly1> vec(1000000);
+  for(auto& i : vec) {
+    i.a = rand()%100;
+  }
+
+  tf::Taskflow taskflow;
+  tf::Executor executor(W);
+
+  taskflow.stable_sort(vec.begin(), vec.end(),
+    [](const MoveOnly1& m1, const MoveOnly1&m2) {
+      return m1.a < m2.a;
+    }
+  );
+
+  executor.run(taskflow).wait();
+
+  for(size_t i=1; i<vec.size(); i++) {
+    REQUIRE(vec[i-1].a <= vec[i].a);
+  }
+}
+
+TEST_CASE("ParallelStableSort.MoveOnlyObject.1thread") {
+  move_only_pss(1);
+}
+
+TEST_CASE("ParallelStableSort.MoveOnlyObject.4threads") {
+  move_only_pss(4);
+}
+
+// ----------------------------------------------------------------------------
+// parallel radix sort
+// ----------------------------------------------------------------------------
+
+template <typename T>
+void radix_sort(unsigned W) {
+
+  tf::Executor executor(W);
+
+  std::mt19937_64 rng(W);
+
+  for(size_t N : {0, 1, 100, 4097, 10000, 100000, 300001}) {
+
+    // mix negative, small, and full-range keys
+    std::vector<T> data(N);
+    for(auto& d : data) {
+      switch(rng() % 3) {
+        case 0: d = static_cast<T>(rng() % 16) - static_cast<T>(8); break;
+        case 1: d = static_cast<T>(rng()); break;
+        default: d = static_cast<T>(static_cast<int64_t>(rng() % 2000001) - 1000000); break;
+      }
+    }
+
+    auto gold = data;
+    std::sort(gold.begin(), gold.end());
+
+    tf::Taskflow taskflow;
+    taskflow.radix_sort(data.begin(), data.end());
+    executor.run(taskflow).wait();
+
+    REQUIRE(data == gold);
+  }
+}
+
+TEST_CASE("ParallelRadixSort.int8.4threads") {
+  radix_sort<int8_t>(4);
+}
+
+TEST_CASE("ParallelRadixSort.uint16.4threads") {
+  radix_sort<uint16_t>(4);
+}
+
+TEST_CASE("ParallelRadixSort.int32.1thread") {
+  radix_sort<int32_t>(1);
+}
+
+TEST_CASE("ParallelRadixSort.int32.2threads") {
+  radix_sort<int32_t>(2);
+}
+
+TEST_CASE("ParallelRadixSort.int32.3threads") {
+  radix_sort<int32_t>(3);
+}
+
+TEST_CASE("ParallelRadixSort.int32.8threads") {
+  radix_sort<int32_t>(8);
+}
+
+TEST_CASE("ParallelRadixSort.uint32.4threads") {
+  radix_sort<uint32_t>(4);
+}
+
+TEST_CASE("ParallelRadixSort.int64.4threads") {
+  radix_sort<int64_t>(4);
+}
+
+TEST_CASE("ParallelRadixSort.uint64.4threads") {
+  radix_sort<uint64_t>(4);
+}
+
+TEST_CASE("ParallelRadixSort.float.1thread") {
+  radix_sort<float>(1);
+}
+
+TEST_CASE("ParallelRadixSort.float.4threads") {
+  radix_sort<float>(4);
+}
+
+TEST_CASE("ParallelRadixSort.double.4threads") {
+  radix_sort<double>(4);
+}
+
+// infinities and signed zeros keep the order of the operator <
+TEST_CASE("ParallelRadixSort.SpecialFloats") {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  const double inf = std::numeric_limits<double>::infinity();
+  const double specials[] = {-inf, -1e300, -1.0, -1e-300, -0.0, 0.0, 1e-300, 1.0, 1e300, inf};
+
+  std::vector<double> data(100000);
+  for(auto& d : data) {
+    d = specials[::rand() % 10];
+  }
+
+  taskflow.sort(data.begin(), data.end());
+  executor.run(taskflow).wait();
+
+  REQUIRE(std::is_sorted(data.begin(), data.end()));
+}
+
+// sorts positions by their keys, such that the positions of equivalent
+// keys must remain increasing
+template <typename K>
+void sort_by_key(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t N : {0, 1, 100, 4097, 100000, 300001}) {
+
+    std::vector<K> keys(N);
+    std::vector<size_t> values(N);
+    std::vector<std::pair<K, size_t>> gold(N);
+
+    for(size_t i=0; i<N; i++) {
+      keys[i] = static_cast<K>(::rand() % 1000 - 500);
+      values[i] = i;
+      gold[i] = {keys[i], i};
+    }
+
+    std::stable_sort(gold.begin(), gold.end(),
+      [](const auto& l, const auto& r){ return l.first < r.first; }
+    );
+
+    tf::Taskflow taskflow;
+    taskflow.sort_by_key(keys.begin(), keys.end(), values.begin());
+    executor.run(taskflow).wait();
+
+    for(size_t i=0; i<N; i++) {
+      REQUIRE(keys[i] == gold[i].first);
+      REQUIRE(values[i] == gold[i].second);
+    }
+  }
+}
+
+TEST_CASE("ParallelSortByKey.int.1thread") {
+  sort_by_key<int>(1);
+}
+
+TEST_CASE("ParallelSortByKey.int.4threads") {
+  sort_by_key<int>(4);
+}
+
+TEST_CASE("ParallelSortByKey.int.7threads") {
+  sort_by_key<int>(7);
+}
+
+TEST_CASE("ParallelSortByKey.double.4threads") {
+  sort_by_key<double>(4);
+}
+
+TEST_CASE("ParallelSortByKey.int64.4threads") {
+  sort_by_key<int64_t>(4);
+}
+
+// keys of no radix order and custom comparators sort by comparison
+TEST_CASE("ParallelSortByKey.Comparator") {
+
+  tf::Executor executor(4);
+
+  const size_t N = 100000;
+
+  std::vector<std::string> keys(N);
+  std::vector<int> ikeys(N);
+  std::vector<size_t> values(N), ivalues(N);
+  std::vector<std::pair<std::string, size_t>> gold(N);
+  std::vector<std::pair<int, size_t>> igold(N);
+
+  for(size_t i=0; i<N; i++) {
+    keys[i] = std::to_string(::rand() % 1000);
+    ikeys[i] = ::rand() % 1000;
+    values[i] = ivalues[i] = i;
+    gold[i] = {keys[i], i};
+    igold[i] = {ikeys[i], i};
+  }
+
+  std::stable_sort(gold.begin(), gold.end(),
+    [](const auto& l, const auto& r){ return l.first < r.first; }
+  );
+  std::stable_sort(igold.begin(), igold.end(),
+    [](const auto& l, const auto& r){ return l.first > r.first; }
+  );
+
+  tf::Taskflow taskflow;
+  taskflow.sort_by_key(keys.begin(), keys.end(), values.begin());
+  taskflow.sort_by_key(
+    ikeys.begin(), ikeys.end(), ivalues.begin(), std::greater<int>()
+  );
+  executor.run(taskflow).wait();
+
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(keys[i] == gold[i].first);
+    REQUIRE(values[i] == gold[i].second);
+    REQUIRE(ikeys[i] == igold[i].first);
+    REQUIRE(ivalues[i] == igold[i].second);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// parallel merge
+// ----------------------------------------------------------------------------
+
+void parallel_merge(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n : {0, 1, 1000, 5000, 100000}) {
+    for(size_t m : {0, 7, 3000, 40000}) {
+
+      // tags tell the range and the position of equivalent keys
+      std::vector<std::pair<int, size_t>> a(n), b(m), out(n+m), gold(n+m);
+      std::vector<int> ia(n), ib(m), iout(n+m), igold(n+m);
+
+      for(size_t i=0; i<n; i++) {
+        ia[i] = ::rand() % 50;
+        a[i] = {ia[i], i};
+      }
+      for(size_t i=0; i<m; i++) {
+        ib[i] = ::rand() % 50;
+        b[i] = {ib[i], n+i};
+      }
+
+      auto by_key = [](const auto& l, const auto& r){ return l.first < r.first; };
+
+      std::sort(ia.begin(), ia.end());
+      std::sort(ib.begin(), ib.end());
+      std::stable_sort(a.begin(), a.end(), by_key);
+      std::stable_sort(b.begin(), b.end(), by_key);
+      std::merge(a.begin(), a.end(), b.begin(), b.end(), gold.begin(), by_key);
+      std::merge(ia.begin(), ia.end(), ib.begin(), ib.end(), igold.begin());
+
+      tf::Taskflow taskflow;
+
+      taskflow.merge(
+        a.cbegin(), a.cend(), b.cbegin(), b.cend(), out.begin(), by_key
+      );
+      taskflow.merge(ia.begin(), ia.end(), ib.begin(), ib.end(), iout.begin());
+
+      executor.run(taskflow).wait();
+
+      REQUIRE(out == gold);
+      REQUIRE(iout == igold);
+    }
+  }
+}
+
+TEST_CASE("ParallelMerge.1thread") {
+  parallel_merge(1);
+}
+
+TEST_CASE("ParallelMerge.2threads") {
+  parallel_merge(2);
+}
+
+TEST_CASE("ParallelMerge.3threads") {
+  parallel_merge(3);
+}
+
+TEST_CASE("ParallelMerge.4threads") {
+  parallel_merge(4);
+}
+
+TEST_CASE("ParallelMerge.8threads") {
+  parallel_merge(8);
+}
+
 // ----------------------------------------------------------------------------
 // parallel transform
 // ----------------------------------------------------------------------------
 
-template<class T>
+template<class T, class P>
 void parallel_transform(size_t W) {
 
   std::srand(static_cast<unsigned int>(time(NULL)));
@@ -770,7 +2292,8 @@ void parallel_transform(size_t W) {
       std::ref(src_beg), std::ref(src_end), std::ref(tgt_beg),
       [] (const auto& in) {
         return std::to_string(in+10);
-      }
+      },
+      P()
     );
 
     from.precede(to);
@@ -787,26 +2310,56 @@ void parallel_transform(size_t W) {
 }
 
 TEST_CASE("ParallelTransform.1thread") {
-  parallel_transform<std::vector<int>>(1);
-  parallel_transform<std::list<int>>(1);
+  parallel_transform<std::vector<int>, tf::GuidedPartitioner>(1);
+  parallel_transform<std::list<int>, tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("ParallelTransform.2threads") {
-  parallel_transform<std::vector<int>>(2);
-  parallel_transform<std::list<int>>(2);
+  parallel_transform<std::vector<int>, tf::GuidedPartitioner>(2);
+  parallel_transform<std::list<int>, tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("ParallelTransform.3threads") {
-  parallel_transform<std::vector<int>>(3);
-  parallel_transform<std::list<int>>(3);
+  parallel_transform<std::vector<int>, tf::GuidedPartitioner>(3);
+  parallel_transform<std::list<int>, tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("ParallelTransform.4threads") {
-  parallel_transform<std::vector<int>>(4);
-  parallel_transform<std::list<int>>(4);
+  parallel_transform<std::vector<int>, tf::GuidedPartitioner>(4);
+  parallel_transform<std::list<int>, tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("ParallelTransform.Static.2threads") {
+  parallel_transform<std::vector<int>, tf::StaticPartitioner>(2);
+  parallel_transform<std::list<int>, tf::StaticPartitioner>(2);
+}
+
+TEST_CASE("ParallelTransform.Static.4threads") {
+  parallel_transform<std::vector<int>, tf::StaticPartitioner>(4);
+  parallel_transform<std::list<int>, tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("ParallelTransform.Dynamic.2threads") {
+  parallel_transform<std::vector<int>, tf::DynamicPartitioner>(2);
+  parallel_transform<std::list<int>, tf::DynamicPartitioner>(2);
+}
+
+TEST_CASE("ParallelTransform.Dynamic.4threads") {
+  parallel_transform<std::vector<int>, tf::DynamicPartitioner>(4);
+  parallel_transform<std::list<int>, tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("ParallelTransform.Adaptive.2threads") {
+  parallel_transform<std::vector<int>, tf::AdaptivePartitioner>(2);
+  parallel_transform<std::list<int>, tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("ParallelTransform.Adaptive.4threads") {
+  parallel_transform<std::vector<int>, tf::AdaptivePartitioner>(4);
+  parallel_transform<std::list<int>, tf::AdaptivePartitioner>(4);
 }
 
-template<class T>
+template<class T, class P>
 void parallel_transform2(size_t W) {
 
   std::srand(static_cast<unsigned int>(time(NULL)));
@@ -840,7 +2393,8 @@ void parallel_transform2(size_t W) {
       std::ref(src_beg), std::ref(src_end), std::ref(src_beg), std::ref(tgt_beg),
       [] (const auto& in1, const auto& in2) {
         return std::to_string(in1 + in2 + 10);
-      }
+      },
+      P()
     );
 
     from.precede(to);
@@ -857,23 +2411,53 @@ void parallel_transform2(size_t W) {
 }
 
 TEST_CASE("parallel_transform2.1thread") {
-  parallel_transform2<std::vector<int>>(1);
-  parallel_transform2<std::list<int>>(1);
+  parallel_transform2<std::vector<int>, tf::GuidedPartitioner>(1);
+  parallel_transform2<std::list<int>, tf::GuidedPartitioner>(1);
 }
 
 TEST_CASE("parallel_transform2.2threads") {
-  parallel_transform2<std::vector<int>>(2);
-  parallel_transform2<std::list<int>>(2);
+  parallel_transform2<std::vector<int>, tf::GuidedPartitioner>(2);
+  parallel_transform2<std::list<int>, tf::GuidedPartitioner>(2);
 }
 
 TEST_CASE("parallel_transform2.3threads") {
-  parallel_transform2<std::vector<int>>(3);
-  parallel_transform2<std::list<int>>(3);
+  parallel_transform2<std::vector<int>, tf::GuidedPartitioner>(3);
+  parallel_transform2<std::list<int>, tf::GuidedPartitioner>(3);
 }
 
 TEST_CASE("parallel_transform2.4threads") {
-  parallel_transform2<std::vector<int>>(4);
-  parallel_transform2<std::list<int>>(4);
+  parallel_transform2<std::vector<int>, tf::GuidedPartitioner>(4);
+  parallel_transform2<std::list<int>, tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("parallel_transform2.Static.2threads") {
+  parallel_transform2<std::vector<int>, tf::StaticPartitioner>(2);
+  parallel_transform2<std::list<int>, tf::StaticPartitioner>(2);
+}
+
+TEST_CASE("parallel_transform2.Static.4threads") {
+  parallel_transform2<std::vector<int>, tf::StaticPartitioner>(4);
+  parallel_transform2<std::list<int>, tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("parallel_transform2.Dynamic.2threads") {
+  parallel_transform2<std::vector<int>, tf::DynamicPartitioner>(2);
+  parallel_transform2<std::list<int>, tf::DynamicPartitioner>(2);
+}
+
+TEST_CASE("parallel_transform2.Dynamic.4threads") {
+  parallel_transform2<std::vector<int>, tf::DynamicPartitioner>(4);
+  parallel_transform2<std::list<int>, tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("parallel_transform2.Adaptive.2threads") {
+  parallel_transform2<std::vector<int>, tf::AdaptivePartitioner>(2);
+  parallel_transform2<std::list<int>, tf::AdaptivePartitioner>(2);
+}
+
+TEST_CASE("parallel_transform2.Adaptive.4threads") {
+  parallel_transform2<std::vector<int>, tf::AdaptivePartitioner>(4);
+  parallel_transform2<std::list<int>, tf::AdaptivePartitioner>(4);
 }
 
 void parallel_transform3(size_t W) {
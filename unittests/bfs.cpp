@@ -0,0 +1,174 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/bfs.hpp>
+
+// undirected graph in CSR format
+template <typename O, typename V>
+struct Graph {
+  std::vector<O> offsets;
+  std::vector<V> edges;
+};
+
+// builds the CSR of the undirected graph of n vertices and the given edges
+template <typename O, typename V>
+Graph<O, V> make_csr(size_t n, const std::vector<std::pair<size_t, size_t>>& list) {
+  Graph<O, V> g;
+  g.offsets.assign(n + 1, 0);
+  for(auto [u, v] : list) {
+    g.offsets[u+1]++;
+    g.offsets[v+1]++;
+  }
+  for(size_t i=0; i<n; i++) {
+    g.offsets[i+1] += g.offsets[i];
+  }
+  g.edges.resize(g.offsets[n]);
+  auto pos = g.offsets;
+  for(auto [u, v] : list) {
+    g.edges[pos[u]++] = static_cast<V>(v);
+    g.edges[pos[v]++] = static_cast<V>(u);
+  }
+  return g;
+}
+
+// levels of the sequential breadth-first search
+template <typename L, typename O, typename V>
+std::vector<L> bfs_levels(const Graph<O, V>& g, size_t source) {
+  size_t n = g.offsets.size() - 1;
+  std::vector<L> levels(n, static_cast<L>(-1));
+  std::vector<size_t> queue {source};
+  levels[source] = 0;
+  for(size_t i=0; i<queue.size(); i++) {
+    size_t u = queue[i];
+    for(auto e=g.offsets[u]; e<g.offsets[u+1]; e++) {
+      size_t v = g.edges[e];
+      if(levels[v] == static_cast<L>(-1)) {
+        levels[v] = static_cast<L>(levels[u] + 1);
+        queue.push_back(v);
+      }
+    }
+  }
+  return levels;
+}
+
+// random graphs of a few shapes: sparse ones with many levels and some
+// unreached vertices, dense ones with large frontiers that go bottom-up,
+// stars, paths, and dense ones with a path that goes top-down again
+std::vector<std::pair<size_t, size_t>> make_edges(size_t n, int shape) {
+  std::vector<std::pair<size_t, size_t>> list;
+  switch(shape) {
+    case 0:
+      for(size_t i=0; i<n; i++) {
+        list.emplace_back(::rand() % n, ::rand() % n);
+      }
+    break;
+
+    case 1:
+      for(size_t i=0; i<16*n; i++) {
+        list.emplace_back(::rand() % n, ::rand() % n);
+      }
+    break;
+
+    case 2:
+      for(size_t i=1; i<n; i++) {
+        list.emplace_back(0, i);
+      }
+    break;
+
+    case 3:
+      for(size_t i=1; i<n; i++) {
+        list.emplace_back(i-1, i);
+      }
+    break;
+
+    default:
+      for(size_t i=0; i<8*n; i++) {
+        list.emplace_back(::rand() % (n/2 + 1), ::rand() % (n/2 + 1));
+      }
+      for(size_t i=n/2+1; i<n; i++) {
+        list.emplace_back(i-1, i);
+      }
+    break;
+  }
+  return list;
+}
+
+template <typename O, typename V, typename L>
+void bfs(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n : {1, 2, 10, 1000, 5000, 20000, 100000}) {
+    for(int shape=0; shape<5; shape++) {
+
+      auto g = make_csr<O, V>(n, make_edges(n, shape));
+
+      size_t source = ::rand() % n;
+
+      std::vector<L> levels(n, 0);
+
+      tf::Taskflow taskflow;
+      taskflow.bfs(
+        g.offsets.begin(), g.offsets.end(), g.edges.begin(), source, levels.begin()
+      );
+      executor.run(taskflow).wait();
+
+      REQUIRE(levels == bfs_levels<L>(g, source));
+    }
+  }
+}
+
+TEST_CASE("BFS.1thread" * doctest::timeout(300)) {
+  bfs<size_t, uint32_t, int>(1);
+}
+
+TEST_CASE("BFS.2threads" * doctest::timeout(300)) {
+  bfs<size_t, uint32_t, int>(2);
+}
+
+TEST_CASE("BFS.4threads" * doctest::timeout(300)) {
+  bfs<size_t, uint32_t, int>(4);
+}
+
+TEST_CASE("BFS.8threads" * doctest::timeout(300)) {
+  bfs<size_t, uint32_t, int>(8);
+}
+
+TEST_CASE("BFS.UnsignedLevels.4threads" * doctest::timeout(300)) {
+  bfs<uint32_t, size_t, unsigned>(4);
+}
+
+// the graph is built by an earlier task
+TEST_CASE("BFS.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  Graph<size_t, uint32_t> g;
+  std::vector<int> levels;
+  std::vector<size_t>::iterator ob, oe;
+  std::vector<uint32_t>::iterator e;
+  std::vector<int>::iterator l;
+  size_t source = 0;
+
+  auto init = taskflow.emplace([&](){
+    g = make_csr<size_t, uint32_t>(50000, make_edges(50000, 1));
+    levels.resize(50000);
+    ob = g.offsets.begin();
+    oe = g.offsets.end();
+    e = g.edges.begin();
+    l = levels.begin();
+    source = 7;
+  });
+
+  auto search = taskflow.bfs(
+    std::ref(ob), std::ref(oe), std::ref(e), std::ref(source), std::ref(l)
+  );
+
+  init.precede(search);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(levels == bfs_levels<int>(g, 7));
+}
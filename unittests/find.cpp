@@ -0,0 +1,233 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/find.hpp>
+
+// --------------------------------------------------------
+// Testcase: find_if / find_if_not
+// --------------------------------------------------------
+
+template <typename C, typename P>
+void find_if(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=50000; n=n*3+1) {
+    for(size_t c : {0, 1, 3, 7, 99}) {
+
+      C input(n);
+      for(auto& i : input) {
+        i = ::rand() % 4000;
+      }
+
+      // a value matched at a random position, or nowhere
+      int target = ::rand() % 5000;
+
+      auto is_target = [target](int i) { return i == target; };
+      auto below = [target](int i) { return i < target + 2000; };
+
+      auto res1 = input.end();
+      auto res2 = input.end();
+
+      tf::Taskflow taskflow;
+
+      taskflow.find_if(input.begin(), input.end(), res1, is_target, P(c));
+      taskflow.find_if_not(input.begin(), input.end(), res2, below, P(c));
+
+      executor.run(taskflow).wait();
+
+      REQUIRE(res1 == std::find_if(input.begin(), input.end(), is_target));
+      REQUIRE(res2 == std::find_if_not(input.begin(), input.end(), below));
+    }
+  }
+}
+
+TEST_CASE("FindIf.1thread" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("FindIf.2threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("FindIf.4threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("FindIf.8threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::GuidedPartitioner>(8);
+}
+
+TEST_CASE("FindIf.Static.4threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("FindIf.Dynamic.4threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("FindIf.Adaptive.4threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("FindIf.Affinity.4threads" * doctest::timeout(300)) {
+  find_if<std::vector<int>, tf::AffinityPartitioner>(4);
+}
+
+TEST_CASE("FindIf.List.4threads" * doctest::timeout(300)) {
+  find_if<std::list<int>, tf::GuidedPartitioner>(4);
+}
+
+// the workers stop scanning soon after the match
+TEST_CASE("FindIf.EarlyTermination" * doctest::timeout(300)) {
+
+  const size_t N = 1000000;
+
+  std::vector<int> input(N, 0);
+  input[100] = 1;
+
+  for(unsigned W=2; W<=8; W*=2) {
+
+    tf::Executor executor(W);
+    tf::Taskflow taskflow;
+
+    std::atomic<size_t> calls(0);
+    auto res = input.end();
+
+    taskflow.find_if(input.begin(), input.end(), res, [&](int i){
+      calls.fetch_add(1, std::memory_order_relaxed);
+      return i == 1;
+    });
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(res == input.begin() + 100);
+    REQUIRE(calls < N/2);
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: min_element / max_element
+// --------------------------------------------------------
+
+template <typename C, typename P>
+void minmax_element(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=50000; n=n*3+1) {
+    for(size_t c : {0, 1, 3, 7, 99}) {
+
+      // many equivalent elements check that the first one is found
+      C input(n);
+      for(auto& i : input) {
+        i = ::rand() % 10;
+      }
+
+      auto min = input.end();
+      auto max = input.end();
+
+      tf::Taskflow taskflow;
+
+      taskflow.min_element(input.begin(), input.end(), min, std::less<int>(), P(c));
+      taskflow.max_element(input.begin(), input.end(), max, std::less<int>(), P(c));
+
+      executor.run(taskflow).wait();
+
+      REQUIRE(min == std::min_element(input.begin(), input.end()));
+      REQUIRE(max == std::max_element(input.begin(), input.end()));
+    }
+  }
+}
+
+TEST_CASE("MinMaxElement.1thread" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::GuidedPartitioner>(1);
+}
+
+TEST_CASE("MinMaxElement.2threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::GuidedPartitioner>(2);
+}
+
+TEST_CASE("MinMaxElement.4threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.8threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::GuidedPartitioner>(8);
+}
+
+TEST_CASE("MinMaxElement.Static.4threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::StaticPartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.Dynamic.4threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::DynamicPartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.Adaptive.4threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::AdaptivePartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.List.4threads" * doctest::timeout(300)) {
+  minmax_element<std::list<int>, tf::GuidedPartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.Affinity.4threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::AffinityPartitioner>(4);
+}
+
+TEST_CASE("MinMaxElement.Affinity.8threads" * doctest::timeout(300)) {
+  minmax_element<std::vector<int>, tf::AffinityPartitioner>(8);
+}
+
+// an affinity partitioner reused across runs hands each worker the chunks
+// it ran before, out of increasing order, and ties still go to the first
+// element
+void affinity_minmax_element(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t c : {0, 1, 7, 999}) {
+
+    std::vector<int> input(100000, 0);
+
+    tf::AffinityPartitioner min_part(c), max_part(c), find_part(c);
+
+    for(int r=0; r<20; r++) {
+
+      auto min = input.end();
+      auto max = input.end();
+      auto res = input.end();
+
+      tf::Taskflow taskflow;
+
+      taskflow.min_element(input.begin(), input.end(), min, std::less<int>(), min_part);
+      taskflow.max_element(input.begin(), input.end(), max, std::less<int>(), max_part);
+      taskflow.find_if(input.begin(), input.end(), res,
+        [](int i){ return i == 1; }, find_part
+      );
+
+      executor.run(taskflow).wait();
+
+      REQUIRE(min == std::min_element(input.begin(), input.end()));
+      REQUIRE(max == std::max_element(input.begin(), input.end()));
+      REQUIRE(res == std::find(input.begin(), input.end(), 1));
+
+      // all zeros in the first runs, then a few distinct values
+      if(r >= 10) {
+        for(auto& i : input) {
+          i = ::rand() % 4;
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("MinMaxElement.Affinity.Reuse.4threads" * doctest::timeout(300)) {
+  affinity_minmax_element(4);
+}
+
+TEST_CASE("MinMaxElement.Affinity.Reuse.8threads" * doctest::timeout(300)) {
+  affinity_minmax_element(8);
+}
@@ -0,0 +1,199 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+
+// --------------------------------------------------------
+// Testcase: GraphBuilder.Chain
+// --------------------------------------------------------
+void graph_builder_chain(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t N : {0, 1, 2, 10, 1000, 65536}) {
+
+    tf::Taskflow taskflow;
+    tf::GraphBuilder builder(taskflow, executor);
+
+    builder.reserve(N);
+
+    REQUIRE(builder.size() == N);
+    REQUIRE(taskflow.num_tasks() == N);
+
+    std::vector<size_t> order;
+    order.reserve(N);
+
+    builder.build([&](size_t i){
+      builder.task(i).work([&order, i](){ order.push_back(i); });
+      if(i+1 < N) {
+        builder.precede(i, i+1);
+      }
+    });
+
+    builder.finalize();
+
+    for(size_t i=0; i<N; i++) {
+      REQUIRE(builder.task(i).num_successors() == (i+1 < N ? 1 : 0));
+      REQUIRE(builder.task(i).num_dependents() == (i > 0 ? 1 : 0));
+    }
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(order.size() == N);
+    for(size_t i=0; i<N; i++) {
+      REQUIRE(order[i] == i);
+    }
+  }
+}
+
+TEST_CASE("GraphBuilder.Chain.1thread" * doctest::timeout(300)) {
+  graph_builder_chain(1);
+}
+
+TEST_CASE("GraphBuilder.Chain.2threads" * doctest::timeout(300)) {
+  graph_builder_chain(2);
+}
+
+TEST_CASE("GraphBuilder.Chain.4threads" * doctest::timeout(300)) {
+  graph_builder_chain(4);
+}
+
+TEST_CASE("GraphBuilder.Chain.8threads" * doctest::timeout(300)) {
+  graph_builder_chain(8);
+}
+
+// --------------------------------------------------------
+// Testcase: GraphBuilder.Layered
+// --------------------------------------------------------
+void graph_builder_layered(unsigned W) {
+
+  const size_t L = 64;   // number of layers
+  const size_t M = 128;  // number of tasks per layer
+  const size_t N = L*M;
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  // an existing task runs before all the reserved ones
+  std::atomic<size_t> counter(0);
+  std::atomic<bool> violated(false);
+
+  auto source = taskflow.emplace([&](){
+    if(counter % N) {
+      violated = true;
+    }
+  });
+
+  tf::GraphBuilder builder(taskflow, executor);
+
+  // reserve the layers in two batches
+  builder.reserve(N/2);
+  builder.reserve(N - N/2);
+
+  REQUIRE(builder.size() == N);
+  REQUIRE(taskflow.num_tasks() == N + 1);
+
+  std::vector<size_t> level(N, 0);
+
+  builder.build([&](size_t i){
+    size_t l = i / M;
+    builder.task(i).work([&, i, l](){
+      // all predecessors in the previous layer have finished
+      for(size_t k=0; k<M && l>0; k++) {
+        if(level[(l-1)*M + k] != l) {
+          violated = true;
+        }
+      }
+      level[i] = l + 1;
+      counter.fetch_add(1, std::memory_order_relaxed);
+    });
+    // every task of layer l+1 depends on every task of layer l
+    if(l+1 < L) {
+      for(size_t k=0; k<M; k++) {
+        builder.precede(i, (l+1)*M + k);
+      }
+    }
+  });
+
+  // edges added by a thread outside the executor
+  for(size_t k=0; k<M; k++) {
+    source.precede(builder.task(k));
+  }
+
+  builder.finalize();
+
+  for(size_t i=0; i<N; i++) {
+    size_t l = i / M;
+    REQUIRE(builder.task(i).num_successors() == (l+1 < L ? M : 0));
+    REQUIRE(builder.task(i).num_dependents() == (l > 0 ? M : 1));
+  }
+
+  executor.run_n(taskflow, 2).wait();
+
+  REQUIRE(counter == 2*N);
+  REQUIRE(violated == false);
+}
+
+TEST_CASE("GraphBuilder.Layered.1thread" * doctest::timeout(300)) {
+  graph_builder_layered(1);
+}
+
+TEST_CASE("GraphBuilder.Layered.2threads" * doctest::timeout(300)) {
+  graph_builder_layered(2);
+}
+
+TEST_CASE("GraphBuilder.Layered.4threads" * doctest::timeout(300)) {
+  graph_builder_layered(4);
+}
+
+TEST_CASE("GraphBuilder.Layered.8threads" * doctest::timeout(300)) {
+  graph_builder_layered(8);
+}
+
+// --------------------------------------------------------
+// Testcase: GraphBuilder.External
+// --------------------------------------------------------
+TEST_CASE("GraphBuilder.External" * doctest::timeout(300)) {
+
+  const size_t N = 10000;
+
+  tf::Executor executor(4);
+  tf::MonotonicArena arena;
+  tf::Taskflow taskflow(arena);
+
+  std::atomic<size_t> counter(0);
+
+  {
+    tf::GraphBuilder builder(taskflow, executor);
+    builder.reserve(N);
+
+    for(size_t i=0; i<N; i++) {
+      builder.task(i).work([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    // user threads add the edges of a binary tree rooted at task 0
+    std::vector<std::thread> threads;
+    for(size_t t=0; t<4; t++) {
+      threads.emplace_back([&, t](){
+        for(size_t i=1+t; i<N; i+=4) {
+          builder.precede((i-1)/2, i);
+        }
+      });
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+
+    // the destructor merges the pending edges
+  }
+
+  size_t edges = 0;
+  taskflow.for_each_task([&](tf::Task task){
+    edges += task.num_successors();
+    REQUIRE(task.num_dependents() <= 1);
+  });
+  REQUIRE(edges == N-1);
+
+  executor.run(taskflow).wait();
+  REQUIRE(counter == N);
+}
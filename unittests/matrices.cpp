@@ -0,0 +1,196 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/matmul.hpp>
+#include <taskflow/algorithm/transpose.hpp>
+
+// reference product of the row-major M x K matrix A and K x N matrix B
+template <typename T>
+std::vector<T> naive_matmul(
+  const std::vector<T>& A, const std::vector<T>& B, size_t M, size_t K, size_t N
+) {
+  std::vector<T> C(M*N, 0);
+  for(size_t i=0; i<M; i++) {
+    for(size_t k=0; k<K; k++) {
+      for(size_t j=0; j<N; j++) {
+        C[i*N + j] += A[i*K + k] * B[k*N + j];
+      }
+    }
+  }
+  return C;
+}
+
+// small integers keep the products exact in either order of the sums
+template <typename T>
+std::vector<T> random_matrix(size_t rows, size_t cols) {
+  std::vector<T> m(rows*cols);
+  for(auto& v : m) {
+    v = static_cast<T>(::rand() % 9 - 4);
+  }
+  return m;
+}
+
+// --------------------------------------------------------
+// Testcase: matmul
+// --------------------------------------------------------
+
+template <typename T>
+void matmul(unsigned W) {
+
+  tf::Executor executor(W);
+
+  // sizes around and beyond the register and cache blocks
+  const size_t sizes[][3] = {
+    {0, 5, 7}, {5, 0, 7}, {5, 7, 0}, {1, 1, 1}, {7, 3, 5}, {6, 64, 32},
+    {33, 129, 65}, {100, 300, 17}, {257, 513, 129}, {130, 70, 2100}
+  };
+
+  for(auto& s : sizes) {
+
+    size_t M = s[0], K = s[1], N = s[2];
+
+    auto A = random_matrix<T>(M, K);
+    auto B = random_matrix<T>(K, N);
+    std::vector<T> C(M*N, T(-1));
+
+    tf::Taskflow taskflow;
+    taskflow.matmul(A.data(), B.data(), C.data(), M, K, N);
+    executor.run(taskflow).wait();
+
+    REQUIRE(C == naive_matmul(A, B, M, K, N));
+  }
+}
+
+TEST_CASE("Matmul.float.1thread" * doctest::timeout(300)) {
+  matmul<float>(1);
+}
+
+TEST_CASE("Matmul.float.2threads" * doctest::timeout(300)) {
+  matmul<float>(2);
+}
+
+TEST_CASE("Matmul.float.4threads" * doctest::timeout(300)) {
+  matmul<float>(4);
+}
+
+TEST_CASE("Matmul.float.8threads" * doctest::timeout(300)) {
+  matmul<float>(8);
+}
+
+TEST_CASE("Matmul.double.1thread" * doctest::timeout(300)) {
+  matmul<double>(1);
+}
+
+TEST_CASE("Matmul.double.2threads" * doctest::timeout(300)) {
+  matmul<double>(2);
+}
+
+TEST_CASE("Matmul.double.4threads" * doctest::timeout(300)) {
+  matmul<double>(4);
+}
+
+TEST_CASE("Matmul.double.8threads" * doctest::timeout(300)) {
+  matmul<double>(8);
+}
+
+// every micro-kernel the processor can run, not only the widest one
+template <typename T, size_t VB>
+void matmul_kernel() {
+
+  using S = tf::detail::GemmShape<T, VB>;
+
+  size_t M = 2*S::MC + 5, K = S::KC + 3, N = S::NR + 1;
+
+  auto A = random_matrix<T>(M, K);
+  auto B = random_matrix<T>(K, N);
+  std::vector<T> C(M*N);
+
+  tf::detail::GemmWorkspace<T, VB> ws;
+
+  for(size_t i0=0; i0<M; i0+=S::MC) {
+    tf::detail::gemm_tile<T, VB>(
+      A.data(), B.data(), C.data(), K, N, i0, std::min(S::MC, M - i0), 0, N, ws
+    );
+  }
+
+  REQUIRE(C == naive_matmul(A, B, M, K, N));
+}
+
+TEST_CASE("Matmul.Kernels" * doctest::timeout(300)) {
+
+  matmul_kernel<float, 0>();
+  matmul_kernel<double, 0>();
+
+#if defined(TF_SIMD_VECTOR_EXTENSIONS)
+  matmul_kernel<float, 16>();
+  matmul_kernel<double, 16>();
+#endif
+
+#if defined(TF_SIMD_X86_DISPATCH)
+  if(tf::detail::simd_width() >= 32) {
+    matmul_kernel<float, 32>();
+    matmul_kernel<double, 32>();
+  }
+  if(tf::detail::simd_width() >= 64) {
+    matmul_kernel<float, 64>();
+    matmul_kernel<double, 64>();
+  }
+#endif
+}
+
+// --------------------------------------------------------
+// Testcase: transpose
+// --------------------------------------------------------
+
+template <typename T>
+void transpose(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t rows : {0, 1, 7, 64, 65, 300}) {
+    for(size_t cols : {0, 1, 31, 64, 129, 1000}) {
+
+      std::vector<T> in(rows*cols);
+      std::vector<T> out(rows*cols);
+
+      for(size_t i=0; i<in.size(); i++) {
+        in[i] = static_cast<T>(i);
+      }
+
+      tf::Taskflow taskflow;
+      taskflow.transpose(in.data(), out.data(), rows, cols);
+      executor.run(taskflow).wait();
+
+      for(size_t i=0; i<rows; i++) {
+        for(size_t j=0; j<cols; j++) {
+          REQUIRE(out[j*rows + i] == in[i*cols + j]);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Transpose.int.1thread" * doctest::timeout(300)) {
+  transpose<int>(1);
+}
+
+TEST_CASE("Transpose.int.2threads" * doctest::timeout(300)) {
+  transpose<int>(2);
+}
+
+TEST_CASE("Transpose.int.4threads" * doctest::timeout(300)) {
+  transpose<int>(4);
+}
+
+TEST_CASE("Transpose.int.8threads" * doctest::timeout(300)) {
+  transpose<int>(8);
+}
+
+TEST_CASE("Transpose.double.4threads" * doctest::timeout(300)) {
+  transpose<double>(4);
+}
+
+TEST_CASE("Transpose.char.4threads" * doctest::timeout(300)) {
+  transpose<char>(4);
+}
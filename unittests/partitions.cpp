@@ -0,0 +1,225 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/partition.hpp>
+
+// --------------------------------------------------------
+// Testcase: copy_if / remove_if
+// --------------------------------------------------------
+
+template <typename C>
+void compaction(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+    // selectivity in percent of the kept elements
+    for(int s : {0, 1, 50, 99, 100}) {
+
+      C input(n);
+      for(auto& i : input) {
+        i = ::rand() % 100;
+      }
+
+      auto pred = [s](int i) { return i < s; };
+
+      std::vector<int> output(n, -1), golden(n, -1);
+      auto removed = input;
+      auto removed_golden = input;
+
+      auto res1 = output.begin();
+      auto res2 = removed.begin();
+
+      tf::Taskflow taskflow;
+
+      taskflow.copy_if(input.begin(), input.end(), output.begin(), res1, pred);
+      taskflow.remove_if(removed.begin(), removed.end(), res2, pred);
+
+      executor.run(taskflow).wait();
+
+      auto end1 = std::copy_if(input.begin(), input.end(), golden.begin(), pred);
+      auto end2 = std::remove_if(removed_golden.begin(), removed_golden.end(), pred);
+
+      REQUIRE(std::distance(output.begin(), res1) == std::distance(golden.begin(), end1));
+      REQUIRE(std::distance(removed.begin(), res2) == std::distance(removed_golden.begin(), end2));
+      REQUIRE(output == golden);
+      REQUIRE(std::equal(removed.begin(), res2, removed_golden.begin()));
+    }
+  }
+}
+
+TEST_CASE("Compaction.1thread" * doctest::timeout(300)) {
+  compaction<std::vector<int>>(1);
+}
+
+TEST_CASE("Compaction.2threads" * doctest::timeout(300)) {
+  compaction<std::vector<int>>(2);
+}
+
+TEST_CASE("Compaction.3threads" * doctest::timeout(300)) {
+  compaction<std::vector<int>>(3);
+}
+
+TEST_CASE("Compaction.4threads" * doctest::timeout(300)) {
+  compaction<std::vector<int>>(4);
+}
+
+TEST_CASE("Compaction.8threads" * doctest::timeout(300)) {
+  compaction<std::vector<int>>(8);
+}
+
+TEST_CASE("Compaction.List.4threads" * doctest::timeout(300)) {
+  compaction<std::list<int>>(4);
+}
+
+// --------------------------------------------------------
+// Testcase: partition / stable_partition
+// --------------------------------------------------------
+
+template <typename C>
+void partition(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+    for(int s : {0, 1, 50, 99, 100}) {
+
+      // the values tell the positions to check the stability
+      C input(n);
+      int k = 0;
+      for(auto& i : input) {
+        i = (::rand() % 100) * 1000000 + k++;
+      }
+
+      auto pred = [s](int i) { return i / 1000000 < s; };
+
+      auto unstable = input;
+      auto stable = input;
+      auto golden = input;
+
+      auto res1 = unstable.begin();
+      auto res2 = stable.begin();
+
+      tf::Taskflow taskflow;
+
+      taskflow.partition(unstable.begin(), unstable.end(), res1, pred);
+      taskflow.stable_partition(stable.begin(), stable.end(), res2, pred);
+
+      executor.run(taskflow).wait();
+
+      auto mid = std::stable_partition(golden.begin(), golden.end(), pred);
+      auto T = std::distance(golden.begin(), mid);
+
+      REQUIRE(std::distance(unstable.begin(), res1) == T);
+      REQUIRE(std::distance(stable.begin(), res2) == T);
+      REQUIRE(std::is_partitioned(unstable.begin(), unstable.end(), pred));
+
+      std::vector<int> sorted(unstable.begin(), unstable.end());
+      std::vector<int> sorted_golden(golden.begin(), golden.end());
+      std::sort(sorted.begin(), sorted.end());
+      std::sort(sorted_golden.begin(), sorted_golden.end());
+      REQUIRE(sorted == sorted_golden);
+      REQUIRE(stable == golden);
+    }
+  }
+}
+
+TEST_CASE("Partition.1thread" * doctest::timeout(300)) {
+  partition<std::vector<int>>(1);
+}
+
+TEST_CASE("Partition.2threads" * doctest::timeout(300)) {
+  partition<std::vector<int>>(2);
+}
+
+TEST_CASE("Partition.3threads" * doctest::timeout(300)) {
+  partition<std::vector<int>>(3);
+}
+
+TEST_CASE("Partition.4threads" * doctest::timeout(300)) {
+  partition<std::vector<int>>(4);
+}
+
+TEST_CASE("Partition.8threads" * doctest::timeout(300)) {
+  partition<std::vector<int>>(8);
+}
+
+TEST_CASE("Partition.List.4threads" * doctest::timeout(300)) {
+  partition<std::list<int>>(4);
+}
+
+// the elements are moved, never copied
+TEST_CASE("Partition.MoveOnly" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  const size_t N = 50000;
+
+  std::vector<std::unique_ptr<int>> removed(N), unstable(N), stable(N);
+
+  for(size_t i=0; i<N; i++) {
+    removed[i] = std::make_unique<int>(i);
+    unstable[i] = std::make_unique<int>(i);
+    stable[i] = std::make_unique<int>(i);
+  }
+
+  auto odd = [](const std::unique_ptr<int>& p) { return *p % 2 == 1; };
+
+  auto res1 = removed.begin();
+  auto res2 = unstable.begin();
+  auto res3 = stable.begin();
+
+  taskflow.remove_if(removed.begin(), removed.end(), res1, odd);
+  taskflow.partition(unstable.begin(), unstable.end(), res2, odd);
+  taskflow.stable_partition(stable.begin(), stable.end(), res3, odd);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(res1 == removed.begin() + N/2);
+  REQUIRE(res2 == unstable.begin() + N/2);
+  REQUIRE(res3 == stable.begin() + N/2);
+
+  for(size_t i=0; i<N/2; i++) {
+    REQUIRE(*removed[i] == static_cast<int>(2*i));
+    REQUIRE(*stable[i] == static_cast<int>(2*i+1));
+    REQUIRE(*stable[N/2+i] == static_cast<int>(2*i));
+  }
+
+  REQUIRE(std::is_partitioned(unstable.begin(), unstable.end(), odd));
+}
+
+// the range is decided when the task runs
+TEST_CASE("Partition.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data, out;
+  std::vector<int>::iterator first, last, d_first, res;
+
+  auto init = taskflow.emplace([&](){
+    data.resize(100000);
+    out.resize(100000);
+    std::iota(data.begin(), data.end(), 0);
+    first = data.begin();
+    last = data.end();
+    d_first = out.begin();
+  });
+
+  auto copy = taskflow.copy_if(
+    std::ref(first), std::ref(last), std::ref(d_first), res,
+    [](int i){ return i % 3 == 0; }
+  );
+
+  init.precede(copy);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(res == out.begin() + 33334);
+
+  for(int i=0; i<33334; i++) {
+    REQUIRE(out[i] == 3*i);
+  }
+}
@@ -0,0 +1,293 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/scan.hpp>
+
+// sequential references, as std::inclusive_scan requires C++17
+template <typename I, typename O, typename B, typename U, typename T>
+void reference_scan(I first, I last, O out, B bop, U uop, T init, bool inclusive) {
+  for(; first!=last; ++first, ++out) {
+    auto v = uop(*first);
+    if(inclusive) {
+      init = bop(init, v);
+      *out = init;
+    }
+    else {
+      *out = init;
+      init = bop(init, v);
+    }
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: inclusive_scan
+// --------------------------------------------------------
+
+void inclusive_scan(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+
+    std::vector<int> input(n), output(n), inplace(n), golden(n);
+    std::vector<int> init_output(n), init_golden(n);
+
+    for(auto& i : input) {
+      i = ::rand() % 100 - 50;
+    }
+    inplace = input;
+
+    auto identity = [](int i){ return i; };
+
+    reference_scan(input.begin(), input.end(), golden.begin(),
+      std::plus<int>(), identity, 0, true
+    );
+    reference_scan(input.begin(), input.end(), init_golden.begin(),
+      std::plus<int>(), identity, 7, true
+    );
+
+    tf::Taskflow taskflow;
+
+    taskflow.inclusive_scan(
+      input.begin(), input.end(), output.begin(), std::plus<int>()
+    );
+    taskflow.inclusive_scan(
+      input.begin(), input.end(), init_output.begin(), std::plus<int>(), 7
+    );
+    taskflow.inclusive_scan(
+      inplace.begin(), inplace.end(), inplace.begin(), std::plus<int>()
+    );
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(output == golden);
+    REQUIRE(init_output == init_golden);
+    REQUIRE(inplace == golden);
+  }
+}
+
+TEST_CASE("InclusiveScan.1thread" * doctest::timeout(300)) {
+  inclusive_scan(1);
+}
+
+TEST_CASE("InclusiveScan.2threads" * doctest::timeout(300)) {
+  inclusive_scan(2);
+}
+
+TEST_CASE("InclusiveScan.3threads" * doctest::timeout(300)) {
+  inclusive_scan(3);
+}
+
+TEST_CASE("InclusiveScan.4threads" * doctest::timeout(300)) {
+  inclusive_scan(4);
+}
+
+TEST_CASE("InclusiveScan.8threads" * doctest::timeout(300)) {
+  inclusive_scan(8);
+}
+
+TEST_CASE("InclusiveScan.12threads" * doctest::timeout(300)) {
+  inclusive_scan(12);
+}
+
+// --------------------------------------------------------
+// Testcase: exclusive_scan
+// --------------------------------------------------------
+
+void exclusive_scan(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+
+    std::vector<int> input(n), output(n), inplace(n), golden(n);
+
+    for(auto& i : input) {
+      i = ::rand() % 100 - 50;
+    }
+    inplace = input;
+
+    reference_scan(input.begin(), input.end(), golden.begin(),
+      std::plus<int>(), [](int i){ return i; }, -3, false
+    );
+
+    tf::Taskflow taskflow;
+
+    taskflow.exclusive_scan(
+      input.begin(), input.end(), output.begin(), -3, std::plus<int>()
+    );
+    taskflow.exclusive_scan(
+      inplace.begin(), inplace.end(), inplace.begin(), -3, std::plus<int>()
+    );
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(output == golden);
+    REQUIRE(inplace == golden);
+  }
+}
+
+TEST_CASE("ExclusiveScan.1thread" * doctest::timeout(300)) {
+  exclusive_scan(1);
+}
+
+TEST_CASE("ExclusiveScan.2threads" * doctest::timeout(300)) {
+  exclusive_scan(2);
+}
+
+TEST_CASE("ExclusiveScan.3threads" * doctest::timeout(300)) {
+  exclusive_scan(3);
+}
+
+TEST_CASE("ExclusiveScan.4threads" * doctest::timeout(300)) {
+  exclusive_scan(4);
+}
+
+TEST_CASE("ExclusiveScan.8threads" * doctest::timeout(300)) {
+  exclusive_scan(8);
+}
+
+TEST_CASE("ExclusiveScan.12threads" * doctest::timeout(300)) {
+  exclusive_scan(12);
+}
+
+// --------------------------------------------------------
+// Testcase: transform_inclusive_scan / transform_exclusive_scan
+// --------------------------------------------------------
+
+void transform_scan(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+
+    std::vector<std::string> input(n);
+    std::vector<size_t> inc(n), inc_init(n), exc(n);
+    std::vector<size_t> inc_golden(n), inc_init_golden(n), exc_golden(n);
+
+    for(auto& s : input) {
+      s = std::string(::rand() % 10, 'x');
+    }
+
+    auto length = [](const std::string& s){ return s.size(); };
+
+    reference_scan(input.begin(), input.end(), inc_golden.begin(),
+      std::plus<size_t>(), length, size_t{0}, true
+    );
+    reference_scan(input.begin(), input.end(), inc_init_golden.begin(),
+      std::plus<size_t>(), length, size_t{5}, true
+    );
+    reference_scan(input.begin(), input.end(), exc_golden.begin(),
+      std::plus<size_t>(), length, size_t{5}, false
+    );
+
+    tf::Taskflow taskflow;
+
+    taskflow.transform_inclusive_scan(
+      input.begin(), input.end(), inc.begin(), std::plus<size_t>(), length
+    );
+    taskflow.transform_inclusive_scan(
+      input.begin(), input.end(), inc_init.begin(), std::plus<size_t>(), length,
+      size_t{5}
+    );
+    taskflow.transform_exclusive_scan(
+      input.begin(), input.end(), exc.begin(), size_t{5}, std::plus<size_t>(),
+      length
+    );
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(inc == inc_golden);
+    REQUIRE(inc_init == inc_init_golden);
+    REQUIRE(exc == exc_golden);
+  }
+}
+
+TEST_CASE("TransformScan.1thread" * doctest::timeout(300)) {
+  transform_scan(1);
+}
+
+TEST_CASE("TransformScan.2threads" * doctest::timeout(300)) {
+  transform_scan(2);
+}
+
+TEST_CASE("TransformScan.4threads" * doctest::timeout(300)) {
+  transform_scan(4);
+}
+
+TEST_CASE("TransformScan.8threads" * doctest::timeout(300)) {
+  transform_scan(8);
+}
+
+// --------------------------------------------------------
+// Testcase: non-commutative and stateful scans
+// --------------------------------------------------------
+
+// string concatenation is associative but not commutative
+TEST_CASE("Scan.NonCommutative" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+
+  for(size_t n : {1, 63, 64, 1000, 4099}) {
+
+    std::list<std::string> input;
+    for(size_t i=0; i<n; i++) {
+      input.push_back(std::string(1, 'a' + i % 26));
+    }
+
+    std::vector<std::string> inc(n), exc(n), inc_golden(n), exc_golden(n);
+
+    auto identity = [](const std::string& s){ return s; };
+    auto concat = [](const std::string& a, const std::string& b){ return a + b; };
+
+    reference_scan(input.begin(), input.end(), inc_golden.begin(),
+      concat, identity, std::string("<"), true
+    );
+    reference_scan(input.begin(), input.end(), exc_golden.begin(),
+      concat, identity, std::string("<"), false
+    );
+
+    tf::Taskflow taskflow;
+
+    taskflow.inclusive_scan(
+      input.begin(), input.end(), inc.begin(), concat, std::string("<")
+    );
+    taskflow.exclusive_scan(
+      input.begin(), input.end(), exc.begin(), std::string("<"), concat
+    );
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(inc == inc_golden);
+    REQUIRE(exc == exc_golden);
+  }
+}
+
+// the range is decided when the scan task runs
+TEST_CASE("Scan.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data;
+  std::vector<int>::iterator first, last;
+
+  auto init = taskflow.emplace([&](){
+    data.assign(10000, 1);
+    first = data.begin();
+    last  = data.end();
+  });
+
+  auto scan = taskflow.inclusive_scan(
+    std::ref(first), std::ref(last), std::ref(first), std::plus<int>()
+  );
+
+  init.precede(scan);
+
+  executor.run(taskflow).wait();
+
+  for(size_t i=0; i<data.size(); i++) {
+    REQUIRE(data[i] == static_cast<int>(i+1));
+  }
+}
@@ -0,0 +1,210 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/segmented.hpp>
+
+// an affine map x -> a*x + b, whose composition is associative but
+// not commutative, such that the order of the reduction matters
+struct Affine {
+  uint32_t a {1};
+  uint32_t b {0};
+
+  bool operator == (const Affine& rhs) const {
+    return a == rhs.a && b == rhs.b;
+  }
+};
+
+Affine compose(const Affine& f, const Affine& g) {
+  return Affine{g.a * f.a, g.a * f.b + g.b};
+}
+
+// offsets of segments of a few shapes, starting at lo: empty segments,
+// a single long one, many short ones, and lengths of a skewed distribution
+// with long segments among empty ones
+std::vector<size_t> make_offsets(size_t S, size_t lo, int shape) {
+  std::vector<size_t> offsets {lo};
+  for(size_t s=0; s<S; s++) {
+    size_t len = 0;
+    switch(shape) {
+      case 0: len = 0;                                      break;
+      case 1: len = (s == S/2) ? 100000 : 0;                break;
+      case 2: len = ::rand() % 4;                           break;
+      default: len = (::rand() % 8 == 0) ? ::rand() % 2000 : ::rand() % 3; break;
+    }
+    offsets.push_back(offsets.back() + len);
+  }
+  return offsets;
+}
+
+template <typename T, typename BOP>
+std::vector<T> segmented_reduce_seq(
+  const std::vector<T>& values, const std::vector<size_t>& offsets,
+  std::vector<T> out, BOP bop, const T* init
+) {
+  for(size_t s=0; s+1<offsets.size(); s++) {
+    auto b = values.begin() + offsets[s];
+    auto e = values.begin() + offsets[s+1];
+    if(init) {
+      out[s] = std::accumulate(b, e, *init, bop);
+    }
+    else if(b != e) {
+      out[s] = std::accumulate(std::next(b), e, *b, bop);
+    }
+  }
+  return out;
+}
+
+template <typename T, typename BOP>
+std::vector<T> segmented_scan_seq(
+  const std::vector<T>& values, const std::vector<size_t>& offsets,
+  std::vector<T> out, BOP bop, const T* init
+) {
+  for(size_t s=0; s+1<offsets.size(); s++) {
+    auto b = values.begin() + offsets[s];
+    auto e = values.begin() + offsets[s+1];
+    auto d = out.begin() + offsets[s];
+    if(init) {
+      std::inclusive_scan(b, e, d, bop, *init);
+    }
+    else {
+      std::inclusive_scan(b, e, d, bop);
+    }
+  }
+  return out;
+}
+
+// --------------------------------------------------------
+// Testcase: segmented_reduce / segmented_inclusive_scan
+// --------------------------------------------------------
+
+void segmented(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t S : {0, 1, 2, 100, 5000, 20000}) {
+    for(int shape=0; shape<4; shape++) {
+
+      size_t lo = ::rand() % 3;
+
+      auto offsets = make_offsets(S, lo, shape);
+
+      std::vector<Affine> values(offsets.back());
+      for(auto& v : values) {
+        v.a = ::rand() % 7 + 1;
+        v.b = ::rand() % 100;
+      }
+
+      Affine init {3, 1};
+      Affine untouched {0, 0};
+
+      std::vector<Affine> r1(S, untouched), r2(S, untouched);
+      std::vector<Affine> s1(values.size(), untouched), s2(values.size(), untouched);
+
+      tf::Taskflow taskflow;
+
+      taskflow.segmented_reduce(
+        values.begin(), offsets.begin(), offsets.end(), r1.begin(), compose
+      );
+      taskflow.segmented_reduce(
+        values.begin(), offsets.begin(), offsets.end(), r2.begin(), init, compose
+      );
+      taskflow.segmented_inclusive_scan(
+        values.begin(), offsets.begin(), offsets.end(), s1.begin(), compose
+      );
+      taskflow.segmented_inclusive_scan(
+        values.begin(), offsets.begin(), offsets.end(), s2.begin(), compose, init
+      );
+
+      executor.run(taskflow).wait();
+
+      std::vector<Affine> r0(S, untouched), s0(values.size(), untouched);
+
+      REQUIRE(r1 == segmented_reduce_seq(values, offsets, r0, compose, (Affine*)nullptr));
+      REQUIRE(r2 == segmented_reduce_seq(values, offsets, r0, compose, &init));
+      REQUIRE(s1 == segmented_scan_seq(values, offsets, s0, compose, (Affine*)nullptr));
+      REQUIRE(s2 == segmented_scan_seq(values, offsets, s0, compose, &init));
+    }
+  }
+}
+
+TEST_CASE("Segmented.1thread" * doctest::timeout(300)) {
+  segmented(1);
+}
+
+TEST_CASE("Segmented.2threads" * doctest::timeout(300)) {
+  segmented(2);
+}
+
+TEST_CASE("Segmented.3threads" * doctest::timeout(300)) {
+  segmented(3);
+}
+
+TEST_CASE("Segmented.4threads" * doctest::timeout(300)) {
+  segmented(4);
+}
+
+TEST_CASE("Segmented.8threads" * doctest::timeout(300)) {
+  segmented(8);
+}
+
+// the scan runs in place over integer offsets
+TEST_CASE("SegmentedScan.InPlace" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  auto offsets = make_offsets(20000, 0, 3);
+
+  std::vector<int> data(offsets.back());
+  for(auto& d : data) {
+    d = ::rand() % 10;
+  }
+
+  std::vector<int> offs(offsets.begin(), offsets.end());
+
+  auto golden = segmented_scan_seq(
+    data, offsets, data, std::plus<int>(), (int*)nullptr
+  );
+
+  taskflow.segmented_inclusive_scan(
+    data.begin(), offs.begin(), offs.end(), data.begin(), std::plus<int>()
+  );
+  executor.run(taskflow).wait();
+
+  REQUIRE(data == golden);
+}
+
+// the segments are built by an earlier task
+TEST_CASE("SegmentedReduce.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<size_t> offsets;
+  std::vector<long> values, sums;
+  std::vector<long>::iterator v, d;
+  std::vector<size_t>::iterator ob, oe;
+
+  auto init = taskflow.emplace([&](){
+    offsets = make_offsets(50000, 0, 2);
+    values.assign(offsets.back(), 1);
+    sums.resize(50000);
+    v  = values.begin();
+    d  = sums.begin();
+    ob = offsets.begin();
+    oe = offsets.end();
+  });
+
+  auto reduce = taskflow.segmented_reduce(
+    std::ref(v), std::ref(ob), std::ref(oe), std::ref(d), 0l, std::plus<long>()
+  );
+
+  init.precede(reduce);
+
+  executor.run(taskflow).wait();
+
+  for(size_t s=0; s<sums.size(); s++) {
+    REQUIRE(sums[s] == static_cast<long>(offsets[s+1] - offsets[s]));
+  }
+}
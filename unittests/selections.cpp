@@ -0,0 +1,226 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/select.hpp>
+
+// --------------------------------------------------------
+// Testcase: nth_element
+// --------------------------------------------------------
+
+template <typename T, typename C>
+void nth_element(unsigned W, int range, C comp) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=300000; n=n*5+1) {
+    for(double f : {0.0, 0.001, 0.5, 0.999}) {
+
+      size_t m = static_cast<size_t>(f * n);
+
+      // few distinct values check equivalent elements around nth
+      std::vector<T> data(n);
+      for(auto& d : data) {
+        d = static_cast<T>(::rand() % range);
+      }
+
+      auto sorted = data;
+      std::sort(sorted.begin(), sorted.end(), comp);
+
+      tf::Taskflow taskflow;
+      taskflow.nth_element(data.begin(), data.begin() + m, data.end(), comp);
+      executor.run(taskflow).wait();
+
+      if(m == n) {
+        continue;
+      }
+
+      REQUIRE(data[m] == sorted[m]);
+      for(size_t i=0; i<m; i++) {
+        REQUIRE(!comp(data[m], data[i]));
+      }
+      for(size_t i=m+1; i<n; i++) {
+        REQUIRE(!comp(data[i], data[m]));
+      }
+
+      std::sort(data.begin(), data.end(), comp);
+      REQUIRE(data == sorted);
+    }
+  }
+}
+
+TEST_CASE("NthElement.1thread" * doctest::timeout(300)) {
+  nth_element<int>(1, 1000000, std::less<int>());
+}
+
+TEST_CASE("NthElement.2threads" * doctest::timeout(300)) {
+  nth_element<int>(2, 1000000, std::less<int>());
+}
+
+TEST_CASE("NthElement.4threads" * doctest::timeout(300)) {
+  nth_element<int>(4, 1000000, std::less<int>());
+}
+
+TEST_CASE("NthElement.8threads" * doctest::timeout(300)) {
+  nth_element<int>(8, 1000000, std::less<int>());
+}
+
+TEST_CASE("NthElement.Duplicates.4threads" * doctest::timeout(300)) {
+  nth_element<int>(4, 3, std::less<int>());
+}
+
+TEST_CASE("NthElement.Greater.4threads" * doctest::timeout(300)) {
+  nth_element<double>(4, 1000000, std::greater<double>());
+}
+
+// --------------------------------------------------------
+// Testcase: partial_sort
+// --------------------------------------------------------
+
+template <typename T, typename C>
+void partial_sort(unsigned W, int range, C comp) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=300000; n=n*5+1) {
+    for(double f : {0.0, 0.001, 0.5, 1.0}) {
+
+      size_t m = static_cast<size_t>(f * n);
+
+      std::vector<T> data(n);
+      for(auto& d : data) {
+        d = static_cast<T>(::rand() % range);
+      }
+
+      auto sorted = data;
+      std::sort(sorted.begin(), sorted.end(), comp);
+
+      tf::Taskflow taskflow;
+      taskflow.partial_sort(data.begin(), data.begin() + m, data.end(), comp);
+      executor.run(taskflow).wait();
+
+      REQUIRE(std::equal(data.begin(), data.begin() + m, sorted.begin()));
+
+      std::sort(data.begin() + m, data.end(), comp);
+      REQUIRE(data == sorted);
+    }
+  }
+}
+
+TEST_CASE("PartialSort.1thread" * doctest::timeout(300)) {
+  partial_sort<int>(1, 1000000, std::less<int>());
+}
+
+TEST_CASE("PartialSort.2threads" * doctest::timeout(300)) {
+  partial_sort<int>(2, 1000000, std::less<int>());
+}
+
+TEST_CASE("PartialSort.4threads" * doctest::timeout(300)) {
+  partial_sort<int>(4, 1000000, std::less<int>());
+}
+
+TEST_CASE("PartialSort.8threads" * doctest::timeout(300)) {
+  partial_sort<int>(8, 1000000, std::less<int>());
+}
+
+TEST_CASE("PartialSort.Duplicates.4threads" * doctest::timeout(300)) {
+  partial_sort<int>(4, 3, std::less<int>());
+}
+
+TEST_CASE("PartialSort.Greater.4threads" * doctest::timeout(300)) {
+  partial_sort<double>(4, 1000000, std::greater<double>());
+}
+
+// --------------------------------------------------------
+// Testcase: top_k
+// --------------------------------------------------------
+
+template <typename T, typename C>
+void top_k(unsigned W, int range, C comp) {
+
+  tf::Executor executor(W);
+
+  for(size_t n=0; n<=300000; n=n*5+1) {
+    for(size_t k : {0, 1, 10, 1000, 100000, 1000000}) {
+
+      std::vector<T> data(n);
+      for(auto& d : data) {
+        d = static_cast<T>(::rand() % range);
+      }
+      auto input = data;
+
+      size_t K = std::min(k, n);
+
+      // the output past the top-k elements is left untouched
+      std::vector<T> top(K + 1, static_cast<T>(-1));
+
+      tf::Taskflow taskflow;
+      taskflow.top_k(data.begin(), data.end(), k, top.begin(), comp);
+      executor.run(taskflow).wait();
+
+      std::sort(input.begin(), input.end(), comp);
+
+      REQUIRE(data.size() == n);
+      REQUIRE(std::equal(top.begin(), top.begin() + K, input.begin()));
+      REQUIRE(top[K] == static_cast<T>(-1));
+    }
+  }
+}
+
+TEST_CASE("TopK.1thread" * doctest::timeout(300)) {
+  top_k<int>(1, 1000000, std::less<int>());
+}
+
+TEST_CASE("TopK.2threads" * doctest::timeout(300)) {
+  top_k<int>(2, 1000000, std::less<int>());
+}
+
+TEST_CASE("TopK.4threads" * doctest::timeout(300)) {
+  top_k<int>(4, 1000000, std::less<int>());
+}
+
+TEST_CASE("TopK.8threads" * doctest::timeout(300)) {
+  top_k<int>(8, 1000000, std::less<int>());
+}
+
+TEST_CASE("TopK.Duplicates.4threads" * doctest::timeout(300)) {
+  top_k<int>(4, 3, std::less<int>());
+}
+
+TEST_CASE("TopK.Greater.4threads" * doctest::timeout(300)) {
+  top_k<double>(4, 1000000, std::greater<double>());
+}
+
+// the input range is read-only and the result goes to a stateful range
+TEST_CASE("TopK.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data;
+  std::vector<int> top;
+  std::vector<int>::const_iterator beg, end;
+  std::vector<int>::iterator out;
+
+  auto init = taskflow.emplace([&](){
+    data.resize(100000);
+    for(auto& d : data) {
+      d = ::rand();
+    }
+    top.resize(100);
+    beg = data.cbegin();
+    end = data.cend();
+    out = top.begin();
+  });
+
+  auto select = taskflow.top_k(
+    std::ref(beg), std::ref(end), 100, std::ref(out), std::greater<int>()
+  );
+
+  init.precede(select);
+
+  executor.run(taskflow).wait();
+
+  std::sort(data.begin(), data.end(), std::greater<int>());
+  REQUIRE(std::equal(top.begin(), top.end(), data.begin()));
+}
@@ -0,0 +1,218 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/set.hpp>
+
+// an element of a multiset: equivalent elements share the key and
+// the tag tells where an output element comes from
+struct Item {
+  int key {0};
+  int tag {0};
+
+  bool operator == (const Item& rhs) const {
+    return key == rhs.key && tag == rhs.tag;
+  }
+};
+
+// a sorted range of n items with keys in [0, k) and tags from t upward
+std::vector<Item> make_items(size_t n, int k, int t) {
+  std::vector<Item> items(n);
+  for(auto& i : items) {
+    i.key = ::rand() % k;
+    i.tag = t++;
+  }
+  std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b){
+    return a.key < b.key;
+  });
+  return items;
+}
+
+// --------------------------------------------------------
+// Testcase: set_intersection / set_union / set_difference
+// --------------------------------------------------------
+
+void set_operations(unsigned W) {
+
+  tf::Executor executor(W);
+
+  auto comp = [](const Item& a, const Item& b){ return a.key < b.key; };
+
+  for(size_t n : {0, 1, 1000, 4000, 50000}) {
+    for(size_t m : {0, 1, 3000, 50000}) {
+      // few keys with long runs of equivalent items, or many keys
+      for(int k : {1, 7, 1000, 1000000}) {
+
+        auto a = make_items(n, k, 0);
+        auto b = make_items(m, k, 1000000);
+
+        std::vector<Item> i1(n+m), u1(n+m), d1(n+m);
+        std::vector<Item> i2(n+m), u2(n+m), d2(n+m);
+
+        auto ri = i1.begin();
+        auto ru = u1.begin();
+        auto rd = d1.begin();
+
+        tf::Taskflow taskflow;
+
+        taskflow.set_intersection(a.begin(), a.end(), b.begin(), b.end(), i1.begin(), ri, comp);
+        taskflow.set_union(a.begin(), a.end(), b.begin(), b.end(), u1.begin(), ru, comp);
+        taskflow.set_difference(a.begin(), a.end(), b.begin(), b.end(), d1.begin(), rd, comp);
+
+        executor.run(taskflow).wait();
+
+        auto ei = std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), i2.begin(), comp);
+        auto eu = std::set_union(a.begin(), a.end(), b.begin(), b.end(), u2.begin(), comp);
+        auto ed = std::set_difference(a.begin(), a.end(), b.begin(), b.end(), d2.begin(), comp);
+
+        REQUIRE(std::distance(i1.begin(), ri) == std::distance(i2.begin(), ei));
+        REQUIRE(std::distance(u1.begin(), ru) == std::distance(u2.begin(), eu));
+        REQUIRE(std::distance(d1.begin(), rd) == std::distance(d2.begin(), ed));
+        REQUIRE(i1 == i2);
+        REQUIRE(u1 == u2);
+        REQUIRE(d1 == d2);
+      }
+    }
+  }
+}
+
+TEST_CASE("SetOperations.1thread" * doctest::timeout(300)) {
+  set_operations(1);
+}
+
+TEST_CASE("SetOperations.2threads" * doctest::timeout(300)) {
+  set_operations(2);
+}
+
+TEST_CASE("SetOperations.3threads" * doctest::timeout(300)) {
+  set_operations(3);
+}
+
+TEST_CASE("SetOperations.4threads" * doctest::timeout(300)) {
+  set_operations(4);
+}
+
+TEST_CASE("SetOperations.8threads" * doctest::timeout(300)) {
+  set_operations(8);
+}
+
+// the ranges are sorted in descending order and built by an earlier task
+TEST_CASE("SetOperations.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<int> a, b, output, golden;
+  std::vector<int>::iterator b1, e1, b2, e2, d, result;
+
+  auto init = taskflow.emplace([&](){
+    for(int i=0; i<100000; i++) {
+      a.push_back(::rand() % 50000);
+      b.push_back(::rand() % 50000);
+    }
+    std::sort(a.begin(), a.end(), std::greater<int>());
+    std::sort(b.begin(), b.end(), std::greater<int>());
+    output.resize(a.size() + b.size());
+    b1 = a.begin();
+    e1 = a.end();
+    b2 = b.begin();
+    e2 = b.end();
+    d  = output.begin();
+  });
+
+  auto un = taskflow.set_union(
+    std::ref(b1), std::ref(e1), std::ref(b2), std::ref(e2), std::ref(d),
+    result, std::greater<int>()
+  );
+
+  init.precede(un);
+
+  executor.run(taskflow).wait();
+
+  std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+    std::back_inserter(golden), std::greater<int>()
+  );
+
+  REQUIRE(std::distance(output.begin(), result) == golden.size());
+  REQUIRE(std::equal(golden.begin(), golden.end(), output.begin()));
+}
+
+// --------------------------------------------------------
+// Testcase: unique
+// --------------------------------------------------------
+
+void unique(unsigned W) {
+
+  tf::Executor executor(W);
+
+  auto pred = [](const Item& a, const Item& b){ return a.key == b.key; };
+
+  for(size_t n=0; n<=100000; n=n*3+1) {
+    // runs of equivalent items from a single one to the whole range,
+    // or items of random keys
+    for(int k : {1, 2, 10, 1000, -1}) {
+
+      std::vector<Item> items(n);
+      for(size_t i=0; i<n; i++) {
+        items[i].key = k < 0 ? ::rand() % 4 : static_cast<int>(i * k / (n + 1));
+        items[i].tag = static_cast<int>(i);
+      }
+
+      auto golden = items;
+      auto result = items.begin();
+
+      tf::Taskflow taskflow;
+      taskflow.unique(items.begin(), items.end(), result, pred);
+      executor.run(taskflow).wait();
+
+      auto end = std::unique(golden.begin(), golden.end(), pred);
+
+      REQUIRE(std::distance(items.begin(), result) == std::distance(golden.begin(), end));
+      REQUIRE(std::equal(items.begin(), result, golden.begin()));
+    }
+  }
+}
+
+TEST_CASE("Unique.1thread" * doctest::timeout(300)) {
+  unique(1);
+}
+
+TEST_CASE("Unique.2threads" * doctest::timeout(300)) {
+  unique(2);
+}
+
+TEST_CASE("Unique.3threads" * doctest::timeout(300)) {
+  unique(3);
+}
+
+TEST_CASE("Unique.4threads" * doctest::timeout(300)) {
+  unique(4);
+}
+
+TEST_CASE("Unique.8threads" * doctest::timeout(300)) {
+  unique(8);
+}
+
+// the default predicate over a sorted range, as to deduplicate IDs
+TEST_CASE("Unique.SortedIDs" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::vector<uint64_t> ids(200000);
+  for(auto& id : ids) {
+    id = ::rand() % 50000;
+  }
+  std::sort(ids.begin(), ids.end());
+
+  auto golden = ids;
+  auto result = ids.begin();
+
+  taskflow.unique(ids.begin(), ids.end(), result);
+  executor.run(taskflow).wait();
+
+  golden.erase(std::unique(golden.begin(), golden.end()), golden.end());
+
+  REQUIRE(std::distance(ids.begin(), result) == golden.size());
+  REQUIRE(std::equal(golden.begin(), golden.end(), ids.begin()));
+}
@@ -4,6 +4,8 @@
 #include <taskflow/taskflow.hpp>
 #include <taskflow/algorithm/reduce.hpp>
 
+#include <set>
+
 // --------------------------------------------------------
 // Testcase: JoinedSubflow
 // --------------------------------------------------------
@@ -471,3 +473,467 @@ TEST_CASE("FibSubflow.7threads") {
 TEST_CASE("FibSubflow.8threads") {
   fibonacci(8);
 }
+
+// --------------------------------------------------------
+// Testcase: NodePool
+// --------------------------------------------------------
+void executor_node_pool(unsigned W) {
+
+  constexpr int max_depth {12};
+
+  tf::Executor executor(W);
+
+  // the executor allocates tasks from its own pool
+  size_t global = tf::node_pool().num_allocated_objects();
+
+  {
+    std::atomic<int> counter {0};
+    std::atomic<int> asyncs {0};
+
+    tf::Taskflow taskflow(executor.node_pool());
+
+    taskflow.emplace([&](tf::Subflow& subflow){
+      mix_spawn(max_depth, counter, 0, subflow);
+    });
+
+    taskflow.emplace([&](tf::Subflow& subflow){
+      for(int i=0; i<100; i++) {
+        subflow.silent_async([&](){ asyncs.fetch_add(1, std::memory_order_relaxed); });
+      }
+      subflow.join();
+    });
+
+    for(int r=1; r<=3; r++) {
+      executor.run(taskflow).wait();
+      REQUIRE(counter == r*((1<<max_depth) - 1));
+      REQUIRE(asyncs == r*100);
+    }
+
+    REQUIRE(executor.node_pool().num_allocated_objects() >= taskflow.num_tasks());
+    REQUIRE(tf::node_pool().num_allocated_objects() == global);
+  }
+
+  // only the slots cached by the workers remain allocated
+  REQUIRE(executor.node_pool().num_allocated_objects() <= W*64);
+
+  auto capacity = executor.node_pool().capacity();
+  REQUIRE(executor.node_pool().trim() > 0);
+  REQUIRE(executor.node_pool().capacity() < capacity);
+
+  // the executor keeps working after its pool is trimmed
+  std::atomic<int> counter {0};
+  tf::Taskflow taskflow(executor.node_pool());
+  taskflow.emplace([&](tf::Subflow& subflow){
+    join_spawn(max_depth, counter, 0, subflow);
+  });
+  executor.run(taskflow).wait();
+  REQUIRE(counter == (1<<max_depth) - 1);
+}
+
+TEST_CASE("NodePool.1thread" * doctest::timeout(300)) {
+  executor_node_pool(1);
+}
+
+TEST_CASE("NodePool.2threads" * doctest::timeout(300)) {
+  executor_node_pool(2);
+}
+
+TEST_CASE("NodePool.4threads" * doctest::timeout(300)) {
+  executor_node_pool(4);
+}
+
+TEST_CASE("NodePool.8threads" * doctest::timeout(300)) {
+  executor_node_pool(8);
+}
+
+// --------------------------------------------------------
+// Testcase: NodePoolRunAndWait
+// --------------------------------------------------------
+void node_pool_run_and_wait(unsigned W) {
+
+  constexpr int max_depth {8};
+
+  tf::Executor executor(W);
+  tf::NodePool pool;
+
+  size_t global = tf::node_pool().num_allocated_objects();
+
+  std::atomic<int> counter {0};
+  std::atomic<int> detached {0};
+
+  {
+    // a graph run by Executor::run_and_wait has no topology, and its
+    // subflows draw from the pool of the graph that holds them
+    tf::Taskflow inner(pool);
+    inner.emplace([&](tf::Subflow& subflow){
+      join_spawn(max_depth, counter, 0, subflow);
+    });
+
+    tf::Taskflow taskflow(executor.node_pool());
+    taskflow.emplace([&](){
+      executor.run_and_wait(inner);
+    });
+
+    // a detached subflow of Runtime::run_and_wait is merged into the
+    // running taskflow, which uses a pool other than the executor's
+    tf::Taskflow detach(pool);
+    detach.emplace([&](tf::Runtime& rt){
+      rt.run_and_wait([&](tf::Subflow& sf){
+        for(int i=0; i<10; i++) {
+          sf.emplace([&](){ detached++; });
+        }
+        sf.detach();
+      });
+    });
+
+    for(int r=1; r<=3; r++) {
+      executor.run(taskflow).wait();
+      REQUIRE(counter == r*((1<<max_depth) - 1));
+      executor.run(detach).wait();
+      REQUIRE(detached == r*10);
+    }
+
+    REQUIRE(tf::node_pool().num_allocated_objects() == global);
+  }
+
+  REQUIRE(pool.num_allocated_objects() == 0);
+}
+
+TEST_CASE("NodePoolRunAndWait.1thread" * doctest::timeout(300)) {
+  node_pool_run_and_wait(1);
+}
+
+TEST_CASE("NodePoolRunAndWait.2threads" * doctest::timeout(300)) {
+  node_pool_run_and_wait(2);
+}
+
+TEST_CASE("NodePoolRunAndWait.4threads" * doctest::timeout(300)) {
+  node_pool_run_and_wait(4);
+}
+
+// --------------------------------------------------------
+// Testcase: RuntimeRunAndWait
+// --------------------------------------------------------
+
+// a subflow of a runtime draws from the pool of the running taskflow, or from
+// the node pool of the executor when the runtime has no topology, as in
+// a graph of Executor::run_and_wait or a branch of parallel_invoke
+void runtime_run_and_wait(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+  tf::Taskflow inner;
+
+  std::atomic<int> counter {0};
+
+  auto spawn = [&] (tf::Runtime& rt) {
+    rt.run_and_wait([&](tf::Subflow& sf){
+      for(int i=0; i<10; i++) {
+        sf.emplace([&](){ counter++; });
+      }
+    });
+  };
+
+  inner.emplace(spawn);
+
+  auto A = taskflow.emplace(spawn);
+  auto B = taskflow.emplace([&](tf::Runtime& rt){
+    rt.parallel_invoke(spawn, spawn);
+  });
+  auto C = taskflow.emplace([&](){
+    executor.run_and_wait(inner);
+  });
+
+  A.precede(B);
+  B.precede(C);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(counter == 40);
+}
+
+TEST_CASE("RuntimeRunAndWait.1thread" * doctest::timeout(300)) {
+  runtime_run_and_wait(1);
+}
+
+TEST_CASE("RuntimeRunAndWait.2threads" * doctest::timeout(300)) {
+  runtime_run_and_wait(2);
+}
+
+TEST_CASE("RuntimeRunAndWait.4threads" * doctest::timeout(300)) {
+  runtime_run_and_wait(4);
+}
+
+// --------------------------------------------------------
+// Testcase: Arena
+// --------------------------------------------------------
+void arena_taskflow(unsigned W) {
+
+  constexpr int max_depth {8};
+  constexpr size_t N {1000};
+
+  tf::Executor executor(W);
+  tf::MonotonicArena arena;
+
+  size_t capacity = 0;
+
+  for(int r=0; r<5; r++) {
+
+    std::atomic<int> counter {0};
+    std::atomic<size_t> sum {0};
+
+    tf::Taskflow taskflow("arena", arena);
+
+    // a chain of static tasks
+    tf::Task prev;
+    for(size_t i=0; i<N; i++) {
+      auto task = taskflow.emplace([&, i](){ sum.fetch_add(i, std::memory_order_relaxed); });
+      if(!prev.empty()) {
+        prev.precede(task);
+      }
+      prev = task;
+    }
+
+    // subflows spawned at runtime are detached into the arena taskflow
+    taskflow.emplace([&](tf::Subflow& subflow){
+      mix_spawn(max_depth, counter, 0, subflow);
+    });
+
+    REQUIRE(taskflow.num_tasks() == N + 1);
+
+    executor.run_n(taskflow, 2).wait();
+
+    REQUIRE(sum == N*(N-1));
+    REQUIRE(counter == 2*((1<<max_depth) - 1));
+
+    // the taskflow can be moved and still owns the arena
+    tf::Taskflow moved(std::move(taskflow));
+    REQUIRE(taskflow.empty());
+    REQUIRE(arena.size() > 0);
+
+    sum = 0;
+    executor.run(moved).wait();
+    REQUIRE(sum == N*(N-1)/2);
+
+    // chunks are reused by the next round
+    if(r == 0) {
+      capacity = arena.capacity();
+    }
+    REQUIRE(arena.capacity() == capacity);
+  }
+
+  // the taskflow resets the arena on destruction
+  REQUIRE(arena.size() == 0);
+}
+
+TEST_CASE("Arena.1thread" * doctest::timeout(300)) {
+  arena_taskflow(1);
+}
+
+TEST_CASE("Arena.2threads" * doctest::timeout(300)) {
+  arena_taskflow(2);
+}
+
+TEST_CASE("Arena.4threads" * doctest::timeout(300)) {
+  arena_taskflow(4);
+}
+
+TEST_CASE("Arena.8threads" * doctest::timeout(300)) {
+  arena_taskflow(8);
+}
+
+// --------------------------------------------------------
+// Testcase: NumberedNames
+// --------------------------------------------------------
+void numbered_names(unsigned W) {
+
+  constexpr size_t N {100};
+
+  tf::Executor executor(W);
+  auto observer = executor.make_observer<tf::ChromeObserver>();
+
+  tf::Taskflow taskflow;
+
+  auto A = taskflow.emplace([](){}).name("A");
+  auto B = taskflow.emplace([&](tf::Subflow& subflow){
+    for(size_t i=0; i<N; i++) {
+      subflow.emplace([](){}).name("layer", i);
+    }
+  }).name("B");
+
+  A.precede(B);
+
+  REQUIRE(A.name() == "A");
+  REQUIRE(B.name() == "B");
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(observer->num_tasks() == N + 2);
+
+  auto dump = observer->dump();
+  REQUIRE(dump.find("\"name\":\"A\"") != std::string::npos);
+  REQUIRE(dump.find("\"name\":\"B\"") != std::string::npos);
+  for(size_t i=0; i<N; i++) {
+    auto name = "\"name\":\"layer-" + std::to_string(i) + "\"";
+    REQUIRE(dump.find(name) != std::string::npos);
+  }
+
+  // the last assignment wins, and the name is kept by reference
+  const std::string& name = A.name();
+  A.name("C", 1);
+  REQUIRE(name == "C-1");
+  A.name(tf::TaskName::literal("E", 2));
+  REQUIRE(A.name() == "E-2");
+  REQUIRE(name == "E-2");
+  A.name("D");
+  REQUIRE(name == "D");
+  A.name("");
+  REQUIRE(name.empty());
+}
+
+// records the names of the tasks through tf::TaskView::name
+class NameObserver : public tf::ObserverInterface {
+
+  public:
+
+  void set_up(size_t) override {}
+
+  void on_entry(tf::WorkerView, tf::TaskView tv) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    names.insert(tv.name());
+  }
+
+  void on_exit(tf::WorkerView, tf::TaskView) override {}
+
+  std::mutex mutex;
+  std::set<std::string> names;
+};
+
+// the tasks a parallel algorithm spawns for its chunks carry numbered names
+// that observers record without formatting them
+void algorithm_task_names(unsigned W) {
+
+  tf::Executor executor(W);
+  auto observer = executor.make_observer<tf::ChromeObserver>();
+  auto names = executor.make_observer<NameObserver>();
+
+  std::vector<int> data(100000, 1);
+  int sum = 0;
+
+  tf::Taskflow taskflow;
+  taskflow.reduce(data.begin(), data.end(), sum, std::plus<int>()).name("reduce");
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(sum == 100000);
+
+  auto dump = observer->dump();
+  REQUIRE(dump.find("\"name\":\"reduce\"") != std::string::npos);
+  REQUIRE(names->names.count("reduce") == 1);
+  if(W > 1) {
+    REQUIRE(dump.find("\"name\":\"loop-") != std::string::npos);
+    REQUIRE(names->names.count("loop-0") == 1);
+  }
+  REQUIRE(names->names.count("") == 0);
+}
+
+TEST_CASE("AlgorithmTaskNames.1thread" * doctest::timeout(300)) {
+  algorithm_task_names(1);
+}
+
+TEST_CASE("AlgorithmTaskNames.4threads" * doctest::timeout(300)) {
+  algorithm_task_names(4);
+}
+
+TEST_CASE("NumberedNames.1thread" * doctest::timeout(300)) {
+  numbered_names(1);
+}
+
+TEST_CASE("NumberedNames.4threads" * doctest::timeout(300)) {
+  numbered_names(4);
+}
+
+// --------------------------------------------------------
+// Testcase: ParallelInvoke
+// --------------------------------------------------------
+
+int fibonacci_invoke(int n, tf::Runtime& rt) {
+  if (n < 2) return n;
+  int res1, res2;
+  rt.parallel_invoke(
+    [&res1, n] (tf::Runtime& rt1) { res1 = fibonacci_invoke(n - 1, rt1); },
+    [&res2, n] (tf::Runtime& rt2) { res2 = fibonacci_invoke(n - 2, rt2); }
+  );
+  return res1 + res2;
+}
+
+void parallel_invoke(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  int res = -1;
+  std::atomic<int> counter {0};
+  std::vector<int> data(1000);
+
+  // recursive fork-join on runtime tasks
+  taskflow.emplace([&res] (tf::Runtime& rt) {
+    res = fibonacci_invoke(20, rt);
+  });
+
+  // static and runtime callables from a subflow, with and without
+  // tasks of the subflow
+  auto B = taskflow.emplace([&] (tf::Subflow& sbf) {
+    sbf.parallel_invoke([&](){ counter++; });
+    REQUIRE(counter == 1);
+    sbf.parallel_invoke(
+      [&](){ counter++; },
+      [&](tf::Runtime&){ counter++; },
+      [&](){ std::iota(data.begin(), data.end(), 0); },
+      [&](tf::Runtime& rt){
+        rt.parallel_invoke([&](){ counter++; }, [&](){ counter++; });
+      }
+    );
+    REQUIRE(counter == 5);
+    REQUIRE(data[999] == 999);
+    sbf.emplace([&](){ counter++; });
+    sbf.emplace([&](tf::Subflow& sbf2){
+      sbf2.parallel_invoke([&](){ counter++; }, [&](){ counter++; });
+    });
+  });
+
+  // an exception of the calling worker waits for the other callables
+  auto C = taskflow.emplace([&] (tf::Runtime& rt) {
+    REQUIRE_THROWS_AS(rt.parallel_invoke(
+      [](){ throw std::runtime_error("x"); },
+      [&](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        counter++;
+      }
+    ), std::runtime_error);
+    REQUIRE(counter == 9);
+  });
+
+  B.precede(C);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(res == 6765);
+  REQUIRE(counter == 9);
+}
+
+TEST_CASE("ParallelInvoke.1thread" * doctest::timeout(300)) {
+  parallel_invoke(1);
+}
+
+TEST_CASE("ParallelInvoke.2threads" * doctest::timeout(300)) {
+  parallel_invoke(2);
+}
+
+TEST_CASE("ParallelInvoke.4threads" * doctest::timeout(300)) {
+  parallel_invoke(4);
+}
+
+TEST_CASE("ParallelInvoke.8threads" * doctest::timeout(300)) {
+  parallel_invoke(8);
+}
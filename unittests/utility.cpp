@@ -4,10 +4,12 @@
 
 #include <taskflow/utility/traits.hpp>
 #include <taskflow/utility/object_pool.hpp>
+#include <taskflow/utility/arena.hpp>
 #include <taskflow/utility/small_vector.hpp>
 #include <taskflow/utility/uuid.hpp>
 #include <taskflow/utility/iterator.hpp>
 #include <taskflow/utility/math.hpp>
+#include <taskflow/core/task_name.hpp>
 
 // --------------------------------------------------------
 // Testcase: SmallVector
@@ -437,6 +439,343 @@ TEST_CASE("ObjectPool.16threads" * doctest::timeout(300)) {
   threaded_objectpool<Poolable>(16);
 }
 
+// --------------------------------------------------------
+// Testcase: ObjectPool.Cache
+// --------------------------------------------------------
+
+template <typename T>
+void threaded_objectpool_cache(unsigned W) {
+
+  tf::ObjectPool<T> pool;
+
+  std::vector<std::thread> threads;
+
+  for(unsigned w=0; w<W; ++w) {
+    threads.emplace_back([&pool](){
+      tf::ObjectCache<T> cache;
+      std::vector<T*> items;
+      for(int r=0; r<4; ++r) {
+        for(int i=0; i<16384; ++i) {
+          auto item = pool.animate(cache);
+          item->a = i;
+          items.push_back(item);
+        }
+        for(int i=0; i<16384; ++i) {
+          REQUIRE(items[i]->a == i);
+        }
+        for(auto item : items) {
+          pool.recycle(cache, item);
+        }
+        REQUIRE(cache.size() <= cache.capacity());
+        items.clear();
+      }
+      pool.flush(cache);
+      REQUIRE(cache.empty());
+    });
+  }
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+  REQUIRE(pool.num_allocated_objects() == 0);
+  REQUIRE(pool.num_available_objects() == pool.capacity());
+}
+
+TEST_CASE("ObjectPool.Cache.Sequential" * doctest::timeout(300)) {
+
+  tf::ObjectPool<Poolable> pool(1);
+  tf::ObjectCache<Poolable, 8> cache;
+
+  REQUIRE(cache.empty());
+  REQUIRE(cache.capacity() == 8);
+
+  std::set<Poolable*> set;
+
+  // the first allocation refills half of the cache in a batch
+  auto item = pool.animate(cache);
+  set.insert(item);
+  REQUIRE(cache.size() == 3);
+  REQUIRE(pool.num_allocated_objects() == 4);
+
+  for(size_t i=1; i<100; ++i) {
+    item = pool.animate(cache);
+    REQUIRE(set.find(item) == set.end());
+    set.insert(item);
+  }
+
+  // recycling objects never grows the cache beyond its capacity
+  for(auto s : set) {
+    pool.recycle(cache, s);
+    REQUIRE(cache.size() <= cache.capacity());
+  }
+
+  REQUIRE(pool.num_allocated_objects() == cache.size());
+
+  // cached slots are reused before touching the local heaps
+  std::vector<Poolable*> items;
+  for(size_t i=0, n=cache.size(); i<n; ++i) {
+    items.push_back(pool.animate(cache));
+    REQUIRE(set.find(items.back()) != set.end());
+  }
+  REQUIRE(cache.empty());
+
+  for(auto s : items) {
+    pool.recycle(s);
+  }
+
+  pool.flush(cache);
+  REQUIRE(cache.empty());
+  REQUIRE(pool.num_allocated_objects() == 0);
+  REQUIRE(pool.num_available_objects() == pool.capacity());
+}
+
+TEST_CASE("ObjectPool.Cache.1thread" * doctest::timeout(300)) {
+  threaded_objectpool_cache<Poolable>(1);
+}
+
+TEST_CASE("ObjectPool.Cache.2threads" * doctest::timeout(300)) {
+  threaded_objectpool_cache<Poolable>(2);
+}
+
+TEST_CASE("ObjectPool.Cache.4threads" * doctest::timeout(300)) {
+  threaded_objectpool_cache<Poolable>(4);
+}
+
+TEST_CASE("ObjectPool.Cache.8threads" * doctest::timeout(300)) {
+  threaded_objectpool_cache<Poolable>(8);
+}
+
+TEST_CASE("ObjectPool.Cache.16threads" * doctest::timeout(300)) {
+  threaded_objectpool_cache<Poolable>(16);
+}
+
+// --------------------------------------------------------
+// Testcase: ObjectPool.Trim
+// --------------------------------------------------------
+
+TEST_CASE("ObjectPool.Trim" * doctest::timeout(300)) {
+
+  for(unsigned w=1; w<=4; w++) {
+
+    tf::ObjectPool<Poolable> pool(w);
+
+    REQUIRE(pool.trim() == 0);
+
+    size_t M = pool.num_objects_per_block();
+    size_t N = 10*M;
+
+    std::vector<Poolable*> items;
+
+    for(size_t i=0; i<N; ++i) {
+      items.push_back(pool.animate());
+    }
+
+    // nothing to release while every block is in use
+    REQUIRE(pool.trim() == 0);
+    REQUIRE(pool.capacity() == N);
+
+    // keep one object alive so its block stays with the pool
+    auto alive = items.back();
+    items.pop_back();
+
+    for(auto item : items) {
+      pool.recycle(item);
+    }
+
+    REQUIRE(pool.trim() == 9);
+    REQUIRE(pool.capacity() == M);
+    REQUIRE(pool.num_allocated_objects() == 1);
+
+    pool.recycle(alive);
+
+    REQUIRE(pool.trim() == 1);
+    REQUIRE(pool.capacity() == 0);
+    REQUIRE(pool.num_available_objects() == 0);
+
+    // the pool keeps working after being trimmed
+    items.clear();
+    for(size_t i=0; i<N; ++i) {
+      items.push_back(pool.animate());
+    }
+    REQUIRE(pool.num_allocated_objects() == N);
+
+    for(auto item : items) {
+      pool.recycle(item);
+    }
+    REQUIRE(pool.trim() == 10);
+    REQUIRE(pool.capacity() == 0);
+  }
+}
+
+TEST_CASE("ObjectPool.Trim.Threaded" * doctest::timeout(300)) {
+
+  tf::ObjectPool<Poolable> pool(4);
+  tf::ObjectCache<Poolable> cache;
+
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> threads;
+
+  // threads keep animating and recycling objects while the pool is trimmed
+  for(unsigned w=0; w<4; w++) {
+    threads.emplace_back([&](){
+      std::vector<Poolable*> items;
+      while(!stop) {
+        for(size_t i=0; i<1000; ++i) {
+          items.push_back(pool.animate());
+        }
+        for(auto item : items) {
+          pool.recycle(item);
+        }
+        items.clear();
+      }
+    });
+  }
+
+  for(size_t i=0; i<1000; ++i) {
+    pool.trim();
+  }
+
+  stop = true;
+
+  for(auto& t : threads) {
+    t.join();
+  }
+
+  // slots held by a cache pin their block until it is flushed
+  auto item = pool.animate(cache);
+  pool.recycle(cache, item);
+  pool.trim();
+  REQUIRE(pool.capacity() > 0);
+
+  pool.flush(cache);
+  pool.trim();
+  REQUIRE(pool.num_allocated_objects() == 0);
+  REQUIRE(pool.capacity() == 0);
+}
+
+// --------------------------------------------------------
+// Testcase: MonotonicArena
+// --------------------------------------------------------
+
+TEST_CASE("MonotonicArena" * doctest::timeout(300)) {
+
+  tf::MonotonicArena arena(1024);
+
+  REQUIRE(arena.size() == 0);
+  REQUIRE(arena.capacity() == 0);
+
+  // allocations are aligned and do not overlap
+  std::vector<std::pair<char*, size_t>> blocks;
+  for(size_t i=1; i<=1000; ++i) {
+    size_t bytes = i % 97 + 1;
+    size_t align = size_t{1} << (i % 7);
+    auto ptr = static_cast<char*>(arena.allocate(bytes, align));
+    REQUIRE(reinterpret_cast<uintptr_t>(ptr) % align == 0);
+    std::memset(ptr, static_cast<int>(i), bytes);
+    blocks.emplace_back(ptr, bytes);
+  }
+
+  for(size_t i=0; i<blocks.size(); ++i) {
+    for(size_t b=0; b<blocks[i].second; ++b) {
+      REQUIRE(blocks[i].first[b] == static_cast<char>(i+1));
+    }
+  }
+
+  REQUIRE(arena.size() > 0);
+  REQUIRE(arena.size() <= arena.capacity());
+
+  // a request larger than a chunk gets a chunk of its own
+  auto big = arena.allocate(4096);
+  REQUIRE(big != nullptr);
+
+  // reset keeps the chunks, and the same sequence reuses them
+  auto capacity = arena.capacity();
+  arena.reset();
+  REQUIRE(arena.size() == 0);
+  REQUIRE(arena.capacity() == capacity);
+
+  for(size_t i=1; i<=1000; ++i) {
+    size_t bytes = i % 97 + 1;
+    size_t align = size_t{1} << (i % 7);
+    REQUIRE(arena.allocate(bytes, align) == blocks[i-1].first);
+  }
+  REQUIRE(arena.allocate(4096) == big);
+  REQUIRE(arena.capacity() == capacity);
+
+  // release gives back every chunk
+  arena.release();
+  REQUIRE(arena.size() == 0);
+  REQUIRE(arena.capacity() == 0);
+
+  auto ptr = arena.allocate(8);
+  REQUIRE(ptr != nullptr);
+  REQUIRE(arena.capacity() == 1024);
+}
+
+// --------------------------------------------------------
+// Testcase: TaskName
+// --------------------------------------------------------
+
+TEST_CASE("TaskName" * doctest::timeout(300)) {
+
+  tf::TaskName empty;
+  REQUIRE(empty.empty());
+  REQUIRE(empty.str() == "");
+  REQUIRE(tf::TaskName(std::string()).empty());
+  REQUIRE(empty == tf::TaskName(std::string()));
+
+  // plain names own their strings and compare equal across copies
+  tf::TaskName a(std::string("A"));
+  tf::TaskName b(std::string("A"));
+  REQUIRE(!a.empty());
+  REQUIRE(a.str() == "A");
+  REQUIRE(a == b);
+  REQUIRE(a != tf::TaskName(std::string("B")));
+
+  // numbered names are formatted on demand
+  tf::TaskName n1 = tf::TaskName::literal("layer", 3);
+  tf::TaskName n2 = tf::TaskName::literal("layer", 3);
+  REQUIRE(!n1.empty());
+  REQUIRE(n1.str() == "layer-3");
+  REQUIRE(n1 == n2);
+  REQUIRE(n1 != tf::TaskName::literal("layer", 4));
+  REQUIRE(n1 != tf::TaskName::literal("loop", 3));
+  REQUIRE(n1 != tf::TaskName(std::string("layer-3")));
+
+  std::ostringstream oss;
+  oss << a << ' ' << n2 << ' ' << empty << '|';
+  REQUIRE(oss.str() == "A layer-3 |");
+}
+
+TEST_CASE("TaskName.Threaded" * doctest::timeout(300)) {
+
+  const size_t T = 8;
+  const size_t N = 1000;
+
+  std::vector<std::vector<tf::TaskName>> names(T);
+  std::vector<std::thread> threads;
+
+  for(size_t t=0; t<T; ++t) {
+    threads.emplace_back([&names, t, N] () {
+      for(size_t i=0; i<N; ++i) {
+        names[t].emplace_back("name-" + std::to_string(i % 100));
+      }
+    });
+  }
+
+  for(auto& thread : threads) {
+    thread.join();
+  }
+
+  for(size_t t=0; t<T; ++t) {
+    for(size_t i=0; i<N; ++i) {
+      REQUIRE(names[t][i].str() == "name-" + std::to_string(i % 100));
+      REQUIRE(names[t][i] == names[0][i]);
+    }
+  }
+}
+
 // --------------------------------------------------------
 // Testcase: Reference Wrapper
 // --------------------------------------------------------
@@ -0,0 +1,124 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/wavefront.hpp>
+
+// --------------------------------------------------------
+// Testcase: wavefront
+// --------------------------------------------------------
+
+// every cell runs once, after its north and west neighbors
+void wavefront(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t M : {0, 1, 2, 7, 64, 300}) {
+    for(size_t N : {0, 1, 3, 64, 257}) {
+
+      std::vector<std::atomic<int>> done(M*N);
+
+      // the number of monotone paths from (0, 0) modulo a prime,
+      // which depends on the order of the cells
+      std::vector<uint64_t> paths(M*N, 0), golden(M*N, 0);
+
+      for(size_t i=0; i<M; i++) {
+        for(size_t j=0; j<N; j++) {
+          golden[i*N+j] = (i == 0 || j == 0) ? 1 :
+            (golden[(i-1)*N+j] + golden[i*N+j-1]) % 1000000007;
+        }
+      }
+
+      tf::Taskflow taskflow;
+
+      taskflow.wavefront(M, N, [&](size_t i, size_t j){
+        REQUIRE(i < M);
+        REQUIRE(j < N);
+        REQUIRE((i == 0 || done[(i-1)*N+j] == 1));
+        REQUIRE((j == 0 || done[i*N+j-1] == 1));
+        paths[i*N+j] = (i == 0 || j == 0) ? 1 :
+          (paths[(i-1)*N+j] + paths[i*N+j-1]) % 1000000007;
+        REQUIRE(done[i*N+j]++ == 0);
+      });
+
+      executor.run(taskflow).wait();
+
+      for(auto& d : done) {
+        REQUIRE(d == 1);
+      }
+      REQUIRE(paths == golden);
+    }
+  }
+}
+
+TEST_CASE("Wavefront.1thread" * doctest::timeout(300)) {
+  wavefront(1);
+}
+
+TEST_CASE("Wavefront.2threads" * doctest::timeout(300)) {
+  wavefront(2);
+}
+
+TEST_CASE("Wavefront.3threads" * doctest::timeout(300)) {
+  wavefront(3);
+}
+
+TEST_CASE("Wavefront.4threads" * doctest::timeout(300)) {
+  wavefront(4);
+}
+
+TEST_CASE("Wavefront.8threads" * doctest::timeout(300)) {
+  wavefront(8);
+}
+
+// the cells of an anti-diagonal may run at the same time
+TEST_CASE("Wavefront.Concurrency" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  std::atomic<int> running(0);
+  std::atomic<int> peak(0);
+
+  taskflow.wavefront(64, 64, [&](size_t, size_t){
+    int r = ++running;
+    for(int p = peak; r > p && !peak.compare_exchange_weak(p, r););
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    --running;
+  });
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(peak > 1);
+  REQUIRE(peak <= 4);
+}
+
+// the grid is decided when the task runs, and the taskflow can rerun
+TEST_CASE("Wavefront.Stateful" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  size_t M = 0, N = 0;
+  std::vector<int> cells;
+
+  auto init = taskflow.emplace([&](){
+    M += 10;
+    N += 20;
+    cells.assign(M*N, 0);
+  });
+
+  auto grid = taskflow.wavefront(std::ref(M), std::ref(N), [&](size_t i, size_t j){
+    cells[i*N+j]++;
+  });
+
+  init.precede(grid);
+
+  for(int r=1; r<=3; r++) {
+    executor.run(taskflow).wait();
+    REQUIRE(cells.size() == size_t(r*10 * r*20));
+    for(auto c : cells) {
+      REQUIRE(c == 1);
+    }
+  }
+}